@@ -7,6 +7,7 @@ to interact with Unreal Editor through the Python remote execution protocol.
 
 __version__ = "0.1.0"
 
+from .async_remote_client import AsyncRemoteExecutionClient
 from .autoconfig import get_bundled_site_packages
 from .editor.subsystems import EditorSubsystems
 from .editor.types import EditorInstance
@@ -14,6 +15,7 @@ from .core.pip_install import pip_install, pip_list
 from .remote_client import RemoteExecutionClient
 
 __all__ = [
+    "AsyncRemoteExecutionClient",
     "EditorSubsystems",
     "EditorInstance",
     "RemoteExecutionClient",
@@ -0,0 +1,650 @@
+"""
+UE-MCP asyncio Remote Execution Client
+
+asyncio transport for UE5's Python Remote Execution protocol. Discovery uses a
+datagram endpoint on the multicast group, the command connection uses asyncio
+streams, and every command is an asyncio future resolved by a single reader
+task. Waiting for the editor therefore never blocks the event loop or a worker
+thread, and any number of tool calls, health checks and watchers can wait on
+the same connection concurrently.
+
+Same protocol, method names and result dictionaries as RemoteExecutionClient
+(remote_client.py), with the network methods being coroutines.
+"""
+
+import asyncio
+import json
+import logging
+import socket
+from collections import deque
+from dataclasses import dataclass
+from typing import Any, Optional
+
+from .remote_client import JsonStreamDecoder, RemoteExecutionClient
+
+logger = logging.getLogger(__name__)
+
+
+@dataclass
+class _AsyncPendingCommand:
+    """A command submitted on the command channel, matched to its response in FIFO order."""
+
+    request_id: int
+    payload: bytes
+    future: asyncio.Future
+    abandoned: bool = False
+
+
+class _MulticastProtocol(asyncio.DatagramProtocol):
+    """Hands multicast datagrams to the client."""
+
+    def __init__(self, client: "AsyncRemoteExecutionClient"):
+        self._client = client
+
+    def datagram_received(self, data: bytes, addr: tuple[str, int]) -> None:
+        self._client._on_multicast_message(data)
+
+    def error_received(self, exc: Exception) -> None:
+        logger.debug(f"Multicast socket error: {exc}")
+
+
+class AsyncRemoteExecutionClient:
+    """
+    Execute commands in UE5 editor via Python Remote Execution (asyncio).
+
+    Requires:
+    - Python plugin with remote execution enabled
+    - UE5 project with proper configuration
+    """
+
+    # Protocol constants
+    MAGIC = RemoteExecutionClient.MAGIC
+    PROTOCOL_VERSION = RemoteExecutionClient.PROTOCOL_VERSION
+    BUFFER_SIZE = RemoteExecutionClient.BUFFER_SIZE
+    DEFAULT_MAX_IN_FLIGHT = RemoteExecutionClient.DEFAULT_MAX_IN_FLIGHT
+
+    # How long the editor gets to connect back after open_connection
+    CONNECT_TIMEOUT = 1.0
+
+    ExecTypes = RemoteExecutionClient.ExecTypes
+
+    def __init__(
+        self,
+        multicast_group: tuple[str, int] = ("239.0.0.1", 6766),
+        multicast_bind_address: str = "0.0.0.0",
+        project_name: str = "",
+        expected_node_id: Optional[str] = None,
+        expected_pid: Optional[int] = None,
+        max_in_flight: int = DEFAULT_MAX_IN_FLIGHT,
+    ):
+        """
+        Initialize AsyncRemoteExecutionClient.
+
+        Args:
+            multicast_group: Multicast group (ip, port) for discovery
+            multicast_bind_address: Address to bind multicast socket
+            project_name: Project name to filter UE5 instances
+            expected_node_id: If set, only connect to this specific node_id
+            expected_pid: If set, verify the editor process ID matches
+            max_in_flight: Commands written to the connection before waiting for responses
+        """
+        self.multicast_group = multicast_group
+        self.multicast_bind_address = multicast_bind_address
+        self.project_name = project_name
+        self.expected_node_id = expected_node_id
+        self.expected_pid = expected_pid
+        self.unreal_node_id: Optional[str] = None
+
+        # Discovery: pongs by node_id while a discovery window is open; the event
+        # ends the window early once expected_node_id has answered
+        self._mcast_transport: Optional[asyncio.DatagramTransport] = None
+        self._pongs: Optional[dict[str, dict[str, Any]]] = None
+        self._expected_answered: Optional[asyncio.Event] = None
+
+        # Command channel state: responses are matched to commands in FIFO order
+        self.max_in_flight = max(1, max_in_flight)
+        self._reader: Optional[asyncio.StreamReader] = None
+        self._writer: Optional[asyncio.StreamWriter] = None
+        self._reader_task: Optional[asyncio.Task] = None
+        self._connection_error: Optional[Exception] = None
+        self._decoder = JsonStreamDecoder()
+        self._next_request_id = 1
+        self._in_flight: deque[_AsyncPendingCommand] = deque()
+        self._queued: deque[_AsyncPendingCommand] = deque()
+
+    # =========================================================================
+    # Multicast (discovery)
+    # =========================================================================
+
+    async def _ensure_multicast(self) -> None:
+        """Open the multicast datagram endpoint if needed."""
+        if self._mcast_transport is not None and not self._mcast_transport.is_closing():
+            return
+        # Same socket options as the sync client; the transport owns the socket
+        sock = RemoteExecutionClient(
+            multicast_group=self.multicast_group,
+            multicast_bind_address=self.multicast_bind_address,
+        )._create_multicast_socket()
+        sock.setblocking(False)
+        loop = asyncio.get_running_loop()
+        self._mcast_transport, _ = await loop.create_datagram_endpoint(
+            lambda: _MulticastProtocol(self), sock=sock
+        )
+
+    def _send_message(self, message: dict[str, Any]) -> None:
+        """Send a JSON message to the multicast group."""
+        if self._mcast_transport is None:
+            raise ConnectionError("Multicast endpoint is not open")
+        self._mcast_transport.sendto(json.dumps(message).encode(), self.multicast_group)
+
+    def _on_multicast_message(self, data: bytes) -> None:
+        """Record pongs while a discovery window is open (filtered like the sync client)."""
+        if self._pongs is None:
+            return
+        try:
+            message = json.loads(data.decode("utf-8"))
+        except (UnicodeDecodeError, json.JSONDecodeError):
+            return
+        if not isinstance(message, dict) or message.get("type") != "pong":
+            return
+
+        node_id = message.get("source")
+        if self.expected_node_id and node_id != self.expected_node_id:
+            logger.debug(f"Ignoring node {node_id} (expected {self.expected_node_id})")
+            return
+        if self.project_name and "data" in message:
+            if message["data"].get("project_name") != self.project_name:
+                return
+        self._pongs.setdefault(node_id, message)
+        if self.expected_node_id and self._expected_answered is not None:
+            self._expected_answered.set()
+
+    async def discover(self, timeout: float = 1.0) -> list[dict[str, Any]]:
+        """
+        Ping the multicast group and collect pongs for timeout seconds.
+
+        With expected_node_id set only that node is accepted, so discovery returns
+        as soon as it answers.
+
+        Args:
+            timeout: Discovery window in seconds
+
+        Returns:
+            One pong message per discovered node, in arrival order
+        """
+        await self._ensure_multicast()
+        self._pongs = {}
+        self._expected_answered = asyncio.Event()
+        try:
+            self._send_message(
+                {
+                    "version": self.PROTOCOL_VERSION,
+                    "magic": self.MAGIC,
+                    "source": "ue_mcp",
+                    "type": "ping",
+                }
+            )
+            try:
+                await asyncio.wait_for(self._expected_answered.wait(), timeout)
+            except asyncio.TimeoutError:
+                pass
+            return list(self._pongs.values())
+        finally:
+            self._pongs = None
+            self._expected_answered = None
+
+    def _select(self, pong: dict[str, Any]) -> None:
+        self.unreal_node_id = pong.get("source")
+        project = pong.get("data", {}).get("project_name", "Unknown")
+        engine = pong.get("data", {}).get("engine_version", "Unknown")
+        logger.info(f"Connecting to: {project} (UE {engine}) [node: {self.unreal_node_id}]")
+
+    async def find_unreal_instance(self, timeout: float = 5.0) -> bool:
+        """
+        Find a running UE5 instance (selects the first one that answers).
+
+        Args:
+            timeout: Discovery timeout in seconds
+
+        Returns:
+            True if instance found, False otherwise
+        """
+        try:
+            logger.info("Searching for UE5 instances...")
+            pongs = await self.discover(timeout)
+            if not pongs:
+                logger.error("No UE5 instances discovered on network")
+                return False
+            if len(pongs) > 1:
+                logger.warning(f"{len(pongs)} instances discovered, selected first match")
+            self._select(pongs[0])
+            return True
+        except Exception as e:
+            logger.error(f"Failed to find UE5: {e}")
+            return False
+
+    async def find_and_verify_instance(self, timeout: float = 5.0) -> bool:
+        """
+        Find a UE5 instance and, if expected_pid is set, connect to the one with that PID.
+
+        Without expected_pid this only selects the first instance; with it, each
+        discovered instance is connected to until one reports the expected PID.
+
+        Args:
+            timeout: Discovery timeout in seconds
+
+        Returns:
+            True if a matching instance is found (and connected when verifying), False otherwise
+        """
+        try:
+            logger.info("Searching for UE5 instances...")
+            if self.expected_pid:
+                logger.info(f"Filter: expected_pid={self.expected_pid}")
+            pongs = await self.discover(timeout)
+            if not pongs:
+                logger.error("No UE5 instances discovered on network")
+                return False
+
+            logger.info(f"Discovered {len(pongs)} UE5 instance(s)")
+            if self.expected_pid is None:
+                if len(pongs) > 1:
+                    logger.warning(f"{len(pongs)} instances discovered, selected first match")
+                self._select(pongs[0])
+                return True
+
+            for pong in pongs:
+                self._select(pong)
+                if not await self.open_connection():
+                    logger.debug(f"Failed to open connection to node {self.unreal_node_id}")
+                    continue
+                if await self.verify_pid(self.expected_pid):
+                    return True
+                logger.debug(f"PID mismatch for node {self.unreal_node_id}, trying next")
+                self._close_command_channel()
+
+            logger.error(
+                f"No instance found with PID {self.expected_pid} among "
+                f"{len(pongs)} discovered instances"
+            )
+            self.unreal_node_id = None
+            return False
+
+        except Exception as e:
+            logger.error(f"Failed to find and verify UE5 instance: {e}")
+            return False
+
+    async def reconnect(self, node_id: str) -> bool:
+        """
+        Reopen the command connection to a known node, without discovery.
+
+        Sends open_connection straight to node_id and, if expected_pid is set,
+        verifies the PID over the new connection. Takes one connection setup and
+        one round trip instead of a discovery window.
+
+        Args:
+            node_id: Node ID the editor answered with before (see EndpointCache)
+
+        Returns:
+            True if connected (and verified), False otherwise
+        """
+        self.unreal_node_id = node_id
+        if await self.open_connection():
+            if self.expected_pid is None or await self.verify_pid(self.expected_pid):
+                logger.info(f"Reconnected directly to node {node_id}")
+                return True
+            self._close_command_channel()
+        logger.debug(f"Direct reconnect to node {node_id} failed")
+        self.unreal_node_id = None
+        return False
+
+    # =========================================================================
+    # Command connection
+    # =========================================================================
+
+    async def open_connection(self) -> bool:
+        """
+        Open the command connection to the selected UE5 instance.
+
+        Listens on an ephemeral port, asks the editor (over multicast) to connect
+        to it, and starts the response reader task.
+
+        Returns:
+            True if connection established, False otherwise
+        """
+        if not self.unreal_node_id:
+            logger.error("Must find UE5 instance first")
+            return False
+
+        loop = asyncio.get_running_loop()
+        connected: asyncio.Future = loop.create_future()
+
+        def on_connect(reader: asyncio.StreamReader, writer: asyncio.StreamWriter) -> None:
+            if connected.done():
+                writer.close()
+            else:
+                connected.set_result((reader, writer))
+
+        server = None
+        try:
+            await self._ensure_multicast()
+            server = await asyncio.start_server(on_connect, "127.0.0.1", 0)
+            cmd_port = server.sockets[0].getsockname()[1]
+            self._send_message(
+                {
+                    "type": "open_connection",
+                    "version": self.PROTOCOL_VERSION,
+                    "magic": self.MAGIC,
+                    "source": "ue_mcp",
+                    "dest": self.unreal_node_id,
+                    "data": {"command_ip": "127.0.0.1", "command_port": cmd_port},
+                }
+            )
+            reader, writer = await asyncio.wait_for(connected, self.CONNECT_TIMEOUT)
+        except Exception as e:
+            logger.error(f"Failed to open connection: {e!r}")
+            return False
+        finally:
+            # Stop listening; the accepted connection stays open
+            if server is not None:
+                server.close()
+
+        self._close_command_channel()
+        sock = writer.get_extra_info("socket")
+        if sock is not None:
+            sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self._reader, self._writer = reader, writer
+        self._connection_error = None
+        self._reader_task = loop.create_task(self._read_responses(reader))
+        logger.info("Command connection established")
+        return True
+
+    async def _read_responses(self, reader: asyncio.StreamReader) -> None:
+        """Reader task: dispatch responses to the in-flight commands in FIFO order."""
+        try:
+            while True:
+                data = await reader.read(self.BUFFER_SIZE)
+                if not data:
+                    raise ConnectionResetError("Command connection closed by UE5")
+                for message in self._decoder.feed(data):
+                    if message.get("type") == "command":
+                        continue  # Ignore echo
+                    if not self._in_flight:
+                        logger.debug(f"Discarding unexpected message: {message.get('type')}")
+                        continue
+                    pending = self._in_flight.popleft()
+                    if not pending.future.done():
+                        pending.future.set_result(message)
+                self._send_queued()
+        except asyncio.CancelledError:
+            raise
+        except Exception as e:
+            logger.error(f"Connection lost during command execution: {e}")
+            self._connection_error = e
+            self._fail_pending(e)
+
+    def _fail_pending(self, error: Exception) -> None:
+        """Fail every submitted command with error."""
+        for pending in (*self._in_flight, *self._queued):
+            if pending.future.done():
+                continue
+            if pending.abandoned:
+                pending.future.cancel()  # Nobody awaits it any more
+            else:
+                pending.future.set_exception(error)
+        self._in_flight.clear()
+        self._queued.clear()
+
+    def _send_queued(self) -> None:
+        """Write queued commands while fewer than max_in_flight are awaiting responses."""
+        while self._queued and len(self._in_flight) < self.max_in_flight:
+            pending = self._queued.popleft()
+            if pending.abandoned:
+                continue
+            self._writer.write(pending.payload)
+            self._in_flight.append(pending)
+
+    def _command_payload(self, command: str, exec_type: Optional[str]) -> bytes:
+        cmd_msg = {
+            "type": "command",
+            "version": self.PROTOCOL_VERSION,
+            "magic": self.MAGIC,
+            "source": "ue_mcp",
+            "dest": self.unreal_node_id,
+            "data": {
+                "command": command,
+                "unattended": True,
+                "exec_mode": exec_type or self.ExecTypes.EXECUTE_FILE,
+            },
+        }
+        return json.dumps(cmd_msg).encode()
+
+    def submit(self, command: str, exec_type: Optional[str] = None) -> _AsyncPendingCommand:
+        """
+        Queue a Python command without waiting for its result.
+
+        Commands are written to the connection in submission order, up to
+        max_in_flight at a time; await collect() for each result.
+
+        Args:
+            command: Python code or file path
+            exec_type: ExecTypes.EXECUTE_FILE, EXECUTE_STATEMENT, or EVALUATE_STATEMENT
+
+        Returns:
+            Pending command to pass to collect()
+        """
+        if self._writer is None:
+            raise ConnectionError("Command connection is not open")
+        if self._connection_error is not None:
+            raise ConnectionResetError(str(self._connection_error))
+
+        pending = _AsyncPendingCommand(
+            self._next_request_id,
+            self._command_payload(command, exec_type),
+            asyncio.get_running_loop().create_future(),
+        )
+        self._next_request_id += 1
+        self._queued.append(pending)
+        self._send_queued()
+        return pending
+
+    async def collect(self, pending: _AsyncPendingCommand, timeout: float = 30.0) -> dict[str, Any]:
+        """
+        Wait for the result of a submitted command.
+
+        Args:
+            pending: Value returned by submit()
+            timeout: Maximum time to wait for this command's response
+
+        Returns:
+            Dictionary with execution result, same format as execute()
+
+        Raises:
+            ConnectionError: If the connection was lost before the response arrived
+        """
+        try:
+            result_data = await asyncio.wait_for(asyncio.shield(pending.future), timeout)
+        except asyncio.TimeoutError:
+            # The late response (if any) must not be taken as the next command's result
+            pending.abandoned = True
+            return {"success": False, "error": "No response from UE5", "output": []}
+
+        data = result_data.get("data", {})
+        success = data.get("success", False)
+        logger.info(f"Command executed: {'Success' if success else 'Failed'}")
+        return {
+            "success": success,
+            "result": data.get("result", ""),
+            "output": data.get("output", []),
+        }
+
+    def send_nowait(self, command: str, exec_type: Optional[str] = None) -> bool:
+        """
+        Write a command whose response is never read, e.g. quitting the editor.
+
+        Plain function usable from sync code, including at exit after the event
+        loop stopped. Close the connection afterwards: the response is not
+        matched to any command.
+
+        Args:
+            command: Python code or file path
+            exec_type: ExecTypes.EXECUTE_FILE, EXECUTE_STATEMENT, or EVALUATE_STATEMENT
+
+        Returns:
+            True if the command was written
+        """
+        if not self.is_connected():
+            return False
+        try:
+            self._writer.write(self._command_payload(command, exec_type))
+            return True
+        except Exception as e:
+            logger.debug(f"Failed to send command: {e}")
+            return False
+
+    async def execute(
+        self,
+        command: str,
+        exec_type: Optional[str] = None,
+        timeout: float = 30.0,
+    ) -> dict[str, Any]:
+        """
+        Execute Python command in UE5.
+
+        Args:
+            command: Python code or file path
+            exec_type: ExecTypes.EXECUTE_FILE, EXECUTE_STATEMENT, or EVALUATE_STATEMENT
+            timeout: Timeout for command execution
+
+        Returns:
+            Dictionary with execution result
+        """
+        return (await self.execute_many([command], exec_type=exec_type, timeout=timeout))[0]
+
+    async def execute_many(
+        self,
+        commands: list[str],
+        exec_type: Optional[str] = None,
+        timeout: float = 30.0,
+    ) -> list[dict[str, Any]]:
+        """
+        Execute several Python commands in UE5, pipelined on the command connection.
+
+        Args:
+            commands: Python code strings or file paths, executed in order
+            exec_type: ExecTypes.EXECUTE_FILE, EXECUTE_STATEMENT, or EVALUATE_STATEMENT
+            timeout: Timeout for each command's execution
+
+        Returns:
+            One result dictionary per command, in the same order
+        """
+        results: list[dict[str, Any]] = []
+        try:
+            pending = [self.submit(command, exec_type) for command in commands]
+            for command in pending:
+                results.append(await self.collect(command, timeout=timeout))
+            return results
+
+        except (ConnectionResetError, BrokenPipeError, ConnectionAbortedError) as e:
+            logger.error(f"Connection lost during command execution: {e}")
+            error = {"success": False, "error": str(e), "crashed": True, "output": []}
+        except OSError as e:
+            crashed = "connection" in str(e).lower() or "broken pipe" in str(e).lower()
+            logger.error(f"Command execution failed: {e}")
+            error = {"success": False, "error": str(e), "crashed": crashed, "output": []}
+        except Exception as e:
+            logger.error(f"Command execution failed: {e}")
+            error = {"success": False, "error": str(e), "crashed": False, "output": []}
+
+        return results + [dict(error) for _ in range(len(commands) - len(results))]
+
+    # =========================================================================
+    # Connection state
+    # =========================================================================
+
+    def _close_command_channel(self) -> None:
+        """Close the command connection and fail anything still waiting on it."""
+        if self._reader_task is not None:
+            self._reader_task.cancel()
+            self._reader_task = None
+        if self._writer is not None:
+            try:
+                self._writer.close()
+            except Exception:
+                pass
+        self._reader = None
+        self._writer = None
+        self._fail_pending(ConnectionAbortedError("Command connection closed"))
+        self._decoder.reset()
+
+    def _cleanup_sockets(self) -> None:
+        """Close all sockets without sending close message."""
+        self._close_command_channel()
+        if self._mcast_transport is not None:
+            self._mcast_transport.close()
+            self._mcast_transport = None
+
+    def close_connection(self) -> None:
+        """Close connection to UE5 (does not wait; safe to call from sync code)."""
+        try:
+            if self.unreal_node_id and self._mcast_transport is not None:
+                self._send_message(
+                    {
+                        "type": "close_connection",
+                        "version": self.PROTOCOL_VERSION,
+                        "magic": self.MAGIC,
+                        "source": "ue_mcp",
+                        "dest": self.unreal_node_id,
+                    }
+                )
+            self._cleanup_sockets()
+            self.unreal_node_id = None
+            logger.info("Connection closed")
+        except Exception as e:
+            logger.error(f"Error closing connection: {e}")
+
+    def is_connected(self) -> bool:
+        """Check if client is connected to UE5."""
+        return (
+            self._writer is not None
+            and self._connection_error is None
+            and self.unreal_node_id is not None
+        )
+
+    def get_node_id(self) -> Optional[str]:
+        """Get the connected node ID."""
+        return self.unreal_node_id
+
+    async def verify_pid(self, expected_pid: int) -> bool:
+        """
+        Verify that the connected editor has the expected process ID.
+
+        Args:
+            expected_pid: Expected process ID
+
+        Returns:
+            True if PID matches, False otherwise
+        """
+        if not self.is_connected():
+            return False
+
+        result = await self.execute(
+            "import os; print(os.getpid())",
+            exec_type=self.ExecTypes.EXECUTE_STATEMENT,
+            timeout=5.0,
+        )
+        if not result.get("success"):
+            logger.warning("Failed to verify PID: execution failed")
+            return False
+
+        for line in result.get("output", []):
+            output_str = (line.get("output", "") if isinstance(line, dict) else str(line)).strip()
+            if output_str.isdigit():
+                actual_pid = int(output_str)
+                if actual_pid == expected_pid:
+                    logger.info(f"PID verification successful: {actual_pid}")
+                    return True
+                logger.warning(f"PID mismatch: expected {expected_pid}, got {actual_pid}")
+                return False
+
+        logger.warning("Failed to verify PID: could not parse output")
+        return False
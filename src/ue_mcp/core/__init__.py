@@ -8,6 +8,7 @@ and shared constants.
 from .constants import (
     ENV_VAR_CALL,
     ENV_VAR_MODE,
+    ENV_VAR_RESULT,
     INJECT_TIME_MAX_AGE,
     MARKER_ACTOR_SNAPSHOT_RESULT,
     MARKER_CURRENT_LEVEL_PATH,
@@ -48,6 +49,7 @@ __all__ = [
     # Constants
     "ENV_VAR_MODE",
     "ENV_VAR_CALL",
+    "ENV_VAR_RESULT",
     "INJECT_TIME_MAX_AGE",
     "MARKER_SNAPSHOT_RESULT",
     "MARKER_ACTOR_SNAPSHOT_RESULT",
@@ -0,0 +1,293 @@
+"""Persistent index of the unreal Python API for python_api_search.
+
+The index is built editor-side by extra/scripts/api_search.py (mode "build_index")
+once per API surface: the cache key fingerprints the engine version, the index
+format and every reflected class, so enabling a plugin or changing reflected
+project code produces a new index. Index files live in
+<project>/Saved/UEMCP/ApiIndex/<key>.json and are answered from memory here,
+without an editor round trip.
+
+Index layout (JSON):
+    {"version": API_INDEX_VERSION, "key", "engine_build", "created",
+     "classes":   [[name, docstring, mro_names], ...],
+     "functions": [[name, signature, docstring], ...],
+     "members":   [[class_name, name, kind, signature, docstring, property_type, access], ...]}
+
+Members are stored on the class that defines them; inherited members are resolved
+through the MRO.
+"""
+
+import fnmatch
+import json
+import logging
+import time
+from pathlib import Path
+from typing import Any, Optional
+
+from .api_search_engine import ApiSearchEngine
+
+logger = logging.getLogger(__name__)
+
+# Must match API_INDEX_VERSION in extra/scripts/api_search.py
+API_INDEX_VERSION = 1
+
+# Modes answered from the index (member_info needs full docstrings and stays in the editor)
+INDEX_MODES = frozenset({"list_classes", "list_functions", "class_info", "search"})
+
+
+class ApiIndexError(Exception):
+    """Raised when an index file is missing, unreadable or has another version."""
+
+
+def api_index_dir(project_root: Path) -> Path:
+    """Directory holding the project's API index files."""
+    return Path(project_root) / "Saved" / "UEMCP" / "ApiIndex"
+
+
+def _is_private(name: str) -> bool:
+    return name.startswith("_")
+
+
+class ApiIndex:
+    """In-memory view of an API index file."""
+
+    def __init__(self, data: dict[str, Any], path: Optional[Path] = None):
+        if data.get("version") != API_INDEX_VERSION:
+            raise ApiIndexError(
+                f"Unsupported API index version {data.get('version')} "
+                f"(expected {API_INDEX_VERSION})"
+            )
+        self.path = path
+        self.key: str = data.get("key", "")
+        self.engine_build: str = data.get("engine_build", "")
+
+        # {class_name: (docstring, mro_names)}
+        self.classes: dict[str, tuple[str, list[str]]] = {
+            name: (doc, mro) for name, doc, mro in data["classes"]
+        }
+        # {function_name: (signature, docstring)}
+        self.functions: dict[str, tuple[str, str]] = {
+            name: (sig, doc) for name, sig, doc in data["functions"]
+        }
+        # {class_name: {member_name: (kind, signature, docstring, property_type, access)}}
+        self.members: dict[str, dict[str, tuple]] = {}
+        for class_name, name, *rest in data["members"]:
+            self.members.setdefault(class_name, {})[name] = tuple(rest)
+
+        # Built on the first search
+        self._search_engine: Optional[ApiSearchEngine] = None
+
+    @classmethod
+    def load(cls, path: str | Path) -> "ApiIndex":
+        """Load an index file."""
+        path = Path(path)
+        try:
+            data = json.loads(path.read_bytes())
+        except FileNotFoundError as e:
+            raise ApiIndexError(f"API index not found: {path}") from e
+        except (OSError, json.JSONDecodeError, UnicodeDecodeError) as e:
+            raise ApiIndexError(f"Failed to read API index {path}: {e}") from e
+        try:
+            return cls(data, path)
+        except (KeyError, TypeError, ValueError) as e:
+            raise ApiIndexError(f"Malformed API index {path}: {e}") from e
+
+    def __len__(self) -> int:
+        return (
+            len(self.classes)
+            + len(self.functions)
+            + sum(len(members) for members in self.members.values())
+        )
+
+    # -------------------------------------------------------------------------
+    # Member resolution
+    # -------------------------------------------------------------------------
+
+    def resolve_members(self, class_name: str) -> dict[str, tuple[str, tuple]]:
+        """
+        All members of a class including inherited ones.
+
+        Returns:
+            {member_name: (defining_class, member_row)} where the most derived
+            definition wins, like attribute lookup
+        """
+        _doc, mro = self.classes[class_name]
+        resolved: dict[str, tuple[str, tuple]] = {}
+        for owner in [class_name, *mro]:
+            for name, row in self.members.get(owner, {}).items():
+                if name not in resolved:
+                    resolved[name] = (owner, row)
+        return resolved
+
+    # -------------------------------------------------------------------------
+    # Queries (same result shapes as extra/scripts/api_search.py)
+    # -------------------------------------------------------------------------
+
+    def query(
+        self,
+        mode: str,
+        query: Optional[str] = None,
+        include_inherited: bool = True,
+        include_private: bool = False,
+        limit: int = 100,
+    ) -> dict[str, Any]:
+        """Answer a python_api_search query in one of INDEX_MODES."""
+        if mode == "list_classes":
+            result = self.list_classes(query, include_private, limit)
+        elif mode == "list_functions":
+            result = self.list_functions(query, include_private, limit)
+        elif mode == "class_info":
+            result = self.class_info(query or "", include_inherited, include_private, limit)
+        elif mode == "search":
+            result = self.search(query or "", include_private, limit)
+        else:
+            return {"success": False, "error": f"Mode '{mode}' is not answered from the index"}
+        result["index_key"] = self.key
+        return result
+
+    def list_classes(
+        self, pattern: Optional[str], include_private: bool, limit: int
+    ) -> dict[str, Any]:
+        results = [
+            {"name": name, "type": "class", "docstring": doc.split("\n")[0][:200]}
+            for name, (doc, _mro) in sorted(self.classes.items())
+            if (include_private or not _is_private(name))
+            and (not pattern or fnmatch.fnmatch(name, pattern))
+        ]
+        return {
+            "success": True,
+            "results": results[:limit],
+            "count": len(results),
+            "truncated": len(results) > limit,
+            "pattern": pattern,
+        }
+
+    def list_functions(
+        self, query: Optional[str], include_private: bool, limit: int
+    ) -> dict[str, Any]:
+        if query is None or "." not in query:
+            # Module-level functions
+            results = [
+                {"name": name, "type": "function", "signature": sig, "docstring": doc}
+                for name, (sig, doc) in sorted(self.functions.items())
+                if (include_private or not _is_private(name))
+                and (not query or fnmatch.fnmatch(name, query))
+            ]
+            return {
+                "success": True,
+                "results": results[:limit],
+                "count": len(results),
+                "truncated": len(results) > limit,
+                "pattern": query,
+                "scope": "module",
+            }
+
+        class_pattern, method_pattern = query.split(".", 1)
+        method_pattern = method_pattern or "*"
+        if "*" in class_pattern or "?" in class_pattern:
+            # Several classes: only members each class defines itself, so a method
+            # is listed once instead of once per subclass
+            sources = [
+                (cls_name, {n: (cls_name, row) for n, row in self.members.get(cls_name, {}).items()})
+                for cls_name in sorted(self.classes)
+                if fnmatch.fnmatch(cls_name, class_pattern)
+                and (include_private or not _is_private(cls_name))
+            ]
+        elif class_pattern in self.classes:
+            sources = [(class_pattern, self.resolve_members(class_pattern))]
+        else:
+            return {"success": False, "error": f"Class '{class_pattern}' not found"}
+
+        results = []
+        for cls_name, members in sources:
+            for name in sorted(members):
+                _owner, (kind, sig, doc, _prop_type, _access) = members[name]
+                if kind != "method" or (_is_private(name) and not include_private):
+                    continue
+                if not fnmatch.fnmatch(name, method_pattern):
+                    continue
+                results.append(
+                    {
+                        "name": f"{cls_name}.{name}",
+                        "type": "method",
+                        "signature": sig,
+                        "docstring": doc,
+                        "class": cls_name,
+                    }
+                )
+        results.sort(key=lambda r: r["name"])
+        return {
+            "success": True,
+            "results": results[:limit],
+            "count": len(results),
+            "truncated": len(results) > limit,
+            "class_pattern": class_pattern,
+            "method_pattern": method_pattern,
+            "scope": "class",
+        }
+
+    def class_info(
+        self, class_name: str, include_inherited: bool, include_private: bool, limit: int
+    ) -> dict[str, Any]:
+        if class_name not in self.classes:
+            return {"success": False, "error": f"Class '{class_name}' not found in unreal module"}
+
+        doc, mro = self.classes[class_name]
+        properties = []
+        methods = []
+        inherited_from = {}
+        members = self.resolve_members(class_name)
+        for name in sorted(members):
+            if _is_private(name) and not include_private:
+                continue
+            owner, (kind, sig, member_doc, prop_type, access) = members[name]
+            if kind == "property":
+                properties.append(
+                    {"name": name, "type": prop_type, "access": access, "docstring": member_doc}
+                )
+            elif kind == "method":
+                methods.append({"name": name, "signature": sig, "docstring": member_doc})
+            else:
+                continue
+            if owner != class_name:
+                inherited_from[name] = owner
+
+        result = {
+            "success": True,
+            "class_name": class_name,
+            "base_classes": mro[:4],
+            "docstring": doc,
+            "properties": properties[:limit],
+            "methods": methods[:limit],
+            "property_count": len(properties),
+            "method_count": len(methods),
+        }
+        if include_inherited:
+            result["inherited_from"] = inherited_from
+        return result
+
+    def search(self, query: str, include_private: bool, limit: int) -> dict[str, Any]:
+        """Ranked fuzzy search over names, signatures and docstrings (see api_search_engine)."""
+        if self._search_engine is None:
+            start = time.perf_counter()
+            self._search_engine = ApiSearchEngine.from_index(self)
+            logger.info(
+                f"Built API search engine over {len(self._search_engine)} entries "
+                f"in {time.perf_counter() - start:.2f}s"
+            )
+        return self._search_engine.search(query, include_private=include_private, limit=limit)
+
+
+# Loaded indexes by path, so repeated queries never re-read the file
+_loaded: dict[Path, ApiIndex] = {}
+
+
+def load_api_index(path: str | Path) -> ApiIndex:
+    """Load an index file, reusing the in-memory copy if it was loaded before."""
+    path = Path(path)
+    index = _loaded.get(path)
+    if index is None:
+        index = ApiIndex.load(path)
+        _loaded[path] = index
+        logger.info(f"Loaded API index {index.key} ({len(index)} entries) from {path}")
+    return index
@@ -0,0 +1,439 @@
+"""Ranked fuzzy search over an API index (python_api_search mode "search").
+
+Every class, module function, method and property of an ApiIndex is a document
+with a name, a signature and a first-line docstring. Names are split into words
+(camelCase, PascalCase and snake_case alike), so "spawn actor", "spawnActor" and
+"spawn_act" all find spawn_actor_from_class. A query matches:
+
+- the whole name: exact, prefix, substring (case and underscores ignored)
+- camelCase humps / snake_case initials ("sma" -> StaticMeshActor,
+  "gal" -> get_actor_location)
+- name words: exact, word prefix, or a typo of a word; typos are found through
+  a trigram index over the word vocabulary and confirmed by edit distance
+  ("spwan_actr" -> spawn_actor)
+- signature and docstring words, ranked with BM25
+
+Candidates are gathered from inverted indexes (doc ids are ordered by name
+length, so shorter, more specific names win ties) and only the best few hundred
+are fully scored, which keeps queries in the low milliseconds on the full
+editor API.
+"""
+
+import bisect
+import heapq
+import math
+import re
+from collections.abc import Iterator
+from itertools import chain, islice
+from typing import TYPE_CHECKING, Any
+
+if TYPE_CHECKING:
+    from .api_index import ApiIndex
+
+# camelCase / PascalCase / snake_case words; acronyms stay together (UMGSequence -> umg, sequence)
+_WORD = re.compile(r"[A-Z]+(?=[A-Z][a-z])|[A-Z]?[a-z]+|[A-Z]+|\d+")
+_TEXT_WORD = re.compile(r"[A-Za-z][A-Za-z0-9]+")
+
+# Candidates fully scored per query
+MAX_SCORED = 400
+# Vocabulary words a query word may expand to by prefix or typo
+MAX_EXPANSIONS = 64
+
+# Per-word match strengths
+_WORD_EXACT = 15.0
+_WORD_PREFIX = 10.0
+_WORD_TYPO = 7.0
+
+# BM25 parameters
+_BM25_K1 = 1.2
+_BM25_B = 0.75
+
+_KIND_BONUS = {"class": 4.0, "function": 2.0, "method": 0.0, "property": 0.0}
+
+
+def split_words(name: str) -> list[str]:
+    """Lower-case words of a camelCase, PascalCase or snake_case name."""
+    return [w.lower() for w in _WORD.findall(name)]
+
+
+def trigrams(word: str) -> set[str]:
+    """Trigrams of a word padded with start/end markers."""
+    padded = f"^{word}$"
+    return {padded[i : i + 3] for i in range(len(padded) - 2)}
+
+
+def edit_distance(a: str, b: str, limit: int) -> int:
+    """Optimal string alignment distance (adjacent transpositions count 1), capped at limit + 1."""
+    if abs(len(a) - len(b)) > limit:
+        return limit + 1
+    previous2: list[int] = []
+    previous = list(range(len(b) + 1))
+    for i, ca in enumerate(a, 1):
+        current = [i] + [0] * len(b)
+        for j, cb in enumerate(b, 1):
+            cost = 0 if ca == cb else 1
+            current[j] = min(previous[j] + 1, current[j - 1] + 1, previous[j - 1] + cost)
+            if i > 1 and j > 1 and ca == b[j - 2] and a[i - 2] == cb:
+                current[j] = min(current[j], previous2[j - 2] + 1)
+        if min(current) > limit:
+            return limit + 1
+        previous2, previous = previous, current
+    return previous[-1]
+
+
+def _typo_limit(word: str) -> int:
+    return 0 if len(word) < 4 else 1 if len(word) < 8 else 2
+
+
+def _first_docs(postings: list[list[int]], limit: int, hidden: list[bool] | None) -> list[int]:
+    """The limit smallest doc ids over several sorted postings lists, skipping hidden ones."""
+    docs: list[int] = []
+    for doc_id in heapq.merge(*postings):
+        if len(docs) >= limit:
+            break
+        if (docs and docs[-1] == doc_id) or (hidden is not None and hidden[doc_id]):
+            continue
+        docs.append(doc_id)
+    return docs
+
+
+def _compact(text: str) -> str:
+    return "".join(ch for ch in text.lower() if ch.isalnum())
+
+
+class ApiSearchEngine:
+    """Inverted indexes over the documents of an ApiIndex."""
+
+    def __init__(self, documents: list[tuple[str, str, str | None, str, str]]):
+        """
+        Args:
+            documents: (name, kind, parent_class, signature, docstring) per entry
+        """
+        documents = sorted(documents, key=lambda d: (len(d[0]), d[0], d[2] or ""))
+        self.names = [d[0] for d in documents]
+        self.kinds = [d[1] for d in documents]
+        self.parents = [d[2] for d in documents]
+        self.signatures = [d[3] for d in documents]
+        self.docstrings = [d[4] for d in documents]
+        # Private (_underscore) names and members of private classes
+        self.private = [
+            d[0].startswith("_") or bool(d[2] and d[2].startswith("_")) for d in documents
+        ]
+
+        self.compact: list[str] = []
+        self.words: list[tuple[str, ...]] = []
+        self.humps: list[str] = []
+        self.text_words: list[tuple[str, ...]] = []
+
+        compact_postings: dict[str, list[int]] = {}
+        word_postings: dict[str, list[int]] = {}
+        hump_postings: dict[str, list[int]] = {}
+        text_postings: dict[str, list[int]] = {}
+        text_length_total = 0
+
+        for doc_id, (name, _kind, _parent, signature, docstring) in enumerate(documents):
+            compact = _compact(name)
+            words = tuple(split_words(name))
+            hump = "".join(w[0] for w in words)
+            text = tuple(w.lower() for w in _TEXT_WORD.findall(f"{signature} {docstring}"))
+
+            self.compact.append(compact)
+            self.words.append(words)
+            self.humps.append(hump)
+            self.text_words.append(text)
+            text_length_total += len(text)
+
+            compact_postings.setdefault(compact, []).append(doc_id)
+            for word in set(words):
+                word_postings.setdefault(word, []).append(doc_id)
+            if len(words) > 1:
+                hump_postings.setdefault(hump, []).append(doc_id)
+            for word in set(text):
+                text_postings.setdefault(word, []).append(doc_id)
+
+        self.compact_postings = compact_postings
+        self.word_postings = word_postings
+        self.hump_postings = hump_postings
+        self.text_postings = text_postings
+        self.sorted_compact = sorted(compact_postings)
+        self.sorted_words = sorted(word_postings)
+        self.sorted_humps = sorted(hump_postings)
+        self.avg_text_length = text_length_total / len(documents) if documents else 0.0
+
+        # Trigram index over the name vocabulary, for typo matching
+        self.vocab_trigrams: dict[str, list[str]] = {}
+        for word in self.sorted_words:
+            for gram in trigrams(word):
+                self.vocab_trigrams.setdefault(gram, []).append(word)
+
+    @classmethod
+    def from_index(cls, index: "ApiIndex") -> "ApiSearchEngine":
+        """Build the search engine for every class, function and member of an index."""
+        documents: list[tuple[str, str, str | None, str, str]] = []
+        for name, (doc, _mro) in index.classes.items():
+            documents.append((name, "class", None, "", doc.split("\n")[0][:200]))
+        for name, (sig, doc) in index.functions.items():
+            documents.append((name, "function", None, sig, doc))
+        for class_name, members in index.members.items():
+            for name, (kind, sig, doc, _prop_type, _access) in members.items():
+                if kind in ("method", "property"):
+                    documents.append((name, kind, class_name, sig or "", doc or ""))
+        return cls(documents)
+
+    def __len__(self) -> int:
+        return len(self.names)
+
+    # -------------------------------------------------------------------------
+    # Query expansion
+    # -------------------------------------------------------------------------
+
+    @staticmethod
+    def _iter_prefixed(sorted_keys: list[str], prefix: str) -> Iterator[str]:
+        """Keys starting with prefix, in order."""
+        i = bisect.bisect_left(sorted_keys, prefix)
+        while i < len(sorted_keys) and sorted_keys[i].startswith(prefix):
+            yield sorted_keys[i]
+            i += 1
+
+    @classmethod
+    def _prefixed(cls, sorted_keys: list[str], prefix: str, limit: int) -> list[str]:
+        """Up to limit keys starting with prefix."""
+        return list(islice(cls._iter_prefixed(sorted_keys, prefix), limit))
+
+    def _typos(self, word: str) -> list[str]:
+        """Vocabulary words within the typo limit of word."""
+        limit = _typo_limit(word)
+        if not limit:
+            return []
+        grams = trigrams(word)
+        shared: dict[str, int] = {}
+        for gram in grams:
+            for candidate in self.vocab_trigrams.get(gram, ()):
+                shared[candidate] = shared.get(candidate, 0) + 1
+        # Each edit (or adjacent transposition) destroys at most four trigrams
+        needed = max(1, len(grams) - 4 * limit)
+        return [
+            candidate
+            for candidate, count in shared.items()
+            if count >= needed and edit_distance(word, candidate, limit) <= limit
+        ][:MAX_EXPANSIONS]
+
+    def _expand(self, q_word: str) -> dict[str, float]:
+        """Vocabulary words a query word matches, with match strength."""
+        expansion: dict[str, float] = {}
+        for word in self._prefixed(self.sorted_words, q_word, MAX_EXPANSIONS):
+            expansion[word] = _WORD_EXACT if word == q_word else _WORD_PREFIX
+        if q_word not in self.word_postings:
+            for word in self._typos(q_word):
+                expansion.setdefault(word, _WORD_TYPO)
+        return expansion
+
+    # -------------------------------------------------------------------------
+    # Candidate generation
+    # -------------------------------------------------------------------------
+
+    def _candidates(
+        self,
+        q_compact: str,
+        q_words: list[str],
+        expansions: list[dict[str, float]],
+        include_private: bool,
+    ) -> tuple[list[int], bool]:
+        """
+        Doc ids worth scoring, most promising first.
+
+        Private documents are skipped here, before any bound applies, so they
+        never crowd public matches out of the candidate set.
+
+        Returns:
+            (doc ids, complete); complete is False when a bound (MAX_SCORED,
+            MAX_EXPANSIONS or a per-word share) cut candidates off.
+        """
+        hidden = None if include_private else self.private
+        ordered: dict[int, None] = {}
+        complete = True
+
+        def take(doc_ids) -> int:
+            nonlocal complete
+            added = 0
+            for doc_id in doc_ids:
+                if hidden is not None and hidden[doc_id]:
+                    continue
+                if doc_id in ordered:
+                    continue
+                if len(ordered) >= MAX_SCORED:
+                    complete = False
+                    break
+                ordered[doc_id] = None
+                added += 1
+            return added
+
+        def bounded(items: list, limit: int) -> list:
+            nonlocal complete
+            if len(items) >= limit:
+                complete = False
+            return items
+
+        # Whole-name exact and prefix matches; keys are walked lazily so names
+        # that only private documents carry do not use up the bound
+        take(self.compact_postings.get(q_compact, ()))
+        for compact in self._iter_prefixed(self.sorted_compact, q_compact):
+            if len(ordered) >= MAX_SCORED:
+                complete = False
+                break
+            take(self.compact_postings[compact])
+
+        # Hump prefixes ("sma" -> StaticMeshActor)
+        if len(q_words) == 1 and 2 <= len(q_compact) <= 8:
+            humps = 0
+            for hump in self._iter_prefixed(self.sorted_humps, q_compact):
+                if humps >= MAX_EXPANSIONS or len(ordered) >= MAX_SCORED:
+                    complete = False
+                    break
+                if take(self.hump_postings[hump]):
+                    humps += 1
+
+        # Documents whose name words match every query word
+        expansions_by_size = sorted(
+            (e for e in expansions if e),
+            key=lambda e: sum(len(self.word_postings[w]) for w in e),
+        )
+        if len(expansions_by_size) > 1:
+            rarest, others = expansions_by_size[0], expansions_by_size[1:]
+            full = set(chain.from_iterable(self.word_postings[w] for w in rarest))
+            for expansion in others:
+                full = full.intersection(
+                    chain.from_iterable(self.word_postings[w] for w in expansion)
+                )
+            if hidden is not None:
+                full = {doc_id for doc_id in full if not hidden[doc_id]}
+            take(bounded(heapq.nsmallest(MAX_SCORED, full), MAX_SCORED))
+
+        # Then the shortest names matching each query word, and each docstring word
+        share = max(1, MAX_SCORED // (len(expansions_by_size) + len(q_words)))
+        for expansion in expansions_by_size:
+            postings = [self.word_postings[w] for w in expansion]
+            take(bounded(_first_docs(postings, share, hidden), share))
+        postings = [self.text_postings[w] for w in q_words if w in self.text_postings]
+        take(bounded(_first_docs(postings, share, hidden), share))
+
+        return list(ordered), complete
+
+    # -------------------------------------------------------------------------
+    # Scoring
+    # -------------------------------------------------------------------------
+
+    def _bm25(self, doc_id: int, q_words: list[str]) -> float:
+        text = self.text_words[doc_id]
+        if not text:
+            return 0.0
+        n_docs = len(self.names)
+        norm = _BM25_K1 * (1 - _BM25_B + _BM25_B * len(text) / (self.avg_text_length or 1))
+        score = 0.0
+        for word in q_words:
+            tf = text.count(word)
+            if tf:
+                df = len(self.text_postings[word])
+                idf = math.log(1 + (n_docs - df + 0.5) / (df + 0.5))
+                score += idf * tf * (_BM25_K1 + 1) / (tf + norm)
+        return score
+
+    def _score(
+        self,
+        doc_id: int,
+        q_compact: str,
+        q_words: list[str],
+        expansions: list[dict[str, float]],
+    ) -> float:
+        """Relevance of a document; 0 if it does not match."""
+        compact = self.compact[doc_id]
+        words = self.words[doc_id]
+        score = 0.0
+        matched = False
+
+        if compact == q_compact:
+            score += 100.0
+            matched = True
+        elif compact.startswith(q_compact):
+            score += 60.0 + 20.0 * len(q_compact) / len(compact)
+            matched = True
+        elif len(q_compact) >= 3 and q_compact in compact:
+            score += 35.0
+            matched = True
+
+        if len(q_words) == 1 and len(q_compact) >= 2 and len(words) > 1:
+            hump = self.humps[doc_id]
+            if hump == q_compact:
+                score += 50.0
+                matched = True
+            elif hump.startswith(q_compact):
+                score += 30.0
+                matched = True
+
+        word_hits = 0
+        for expansion in expansions:
+            best = max((expansion.get(w, 0.0) for w in words), default=0.0)
+            if best:
+                score += best
+                word_hits += 1
+        if word_hits:
+            matched = True
+            if word_hits == len(expansions) and len(expansions) > 1:
+                score += 10.0 * word_hits
+
+        text_score = self._bm25(doc_id, q_words)
+        if text_score:
+            score += 4.0 * text_score
+            matched = True
+
+        if not matched:
+            return 0.0
+        return score + _KIND_BONUS[self.kinds[doc_id]] - 0.05 * len(self.names[doc_id])
+
+    def search(self, query: str, include_private: bool = False, limit: int = 100) -> dict[str, Any]:
+        """
+        Ranked search.
+
+        Returns:
+            {"success", "results", "returned", "truncated"}; results carry name,
+            type, score and, where known, parent_class, signature and docstring.
+            returned is len(results). No exact total is computed: truncated is
+            True when more matches than limit were scored or candidate
+            generation was cut off, i.e. whenever more matches may exist.
+        """
+        q_compact = _compact(query)
+        q_words = split_words(query)
+        if not q_compact:
+            return {"success": True, "results": [], "returned": 0, "truncated": False}
+        expansions = [self._expand(w) for w in q_words]
+
+        candidates, complete = self._candidates(q_compact, q_words, expansions, include_private)
+        scored = []
+        for doc_id in candidates:
+            score = self._score(doc_id, q_compact, q_words, expansions)
+            if score > 0:
+                scored.append((-score, doc_id))
+        scored.sort()
+
+        results = []
+        for neg_score, doc_id in scored[:limit]:
+            parent = self.parents[doc_id]
+            entry: dict[str, Any] = {
+                "name": f"{parent}.{self.names[doc_id]}" if parent else self.names[doc_id],
+                "type": self.kinds[doc_id],
+                "score": round(-neg_score, 2),
+            }
+            if parent:
+                entry["parent_class"] = parent
+            if self.signatures[doc_id]:
+                entry["signature"] = self.signatures[doc_id]
+            if self.docstrings[doc_id]:
+                entry["docstring"] = self.docstrings[doc_id]
+            results.append(entry)
+
+        return {
+            "success": True,
+            "results": results,
+            "returned": len(results),
+            "truncated": len(scored) > limit or not complete,
+        }
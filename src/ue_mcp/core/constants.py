@@ -13,6 +13,7 @@ a separate Python environment (UE5's embedded Python).
 # Used by _helpers.py (MCP server side) and utils.py (UE5 script side)
 ENV_VAR_MODE = "UE_MCP_MODE"  # "1" when running via MCP (vs CLI)
 ENV_VAR_CALL = "UE_MCP_CALL"  # "<checksum>:<timestamp>:<json_params>" script call info
+ENV_VAR_RESULT = "UE_MCP_RESULT"  # Result file path (see core/result_file.py)
 
 # Maximum allowed age for injected parameters (in seconds)
 # Increased to 5s to account for UE5's Python execution lag between
@@ -25,3 +26,4 @@ INJECT_TIME_MAX_AGE = 5.0
 MARKER_SNAPSHOT_RESULT = "SNAPSHOT_RESULT:"
 MARKER_ACTOR_SNAPSHOT_RESULT = "ACTOR_SNAPSHOT_RESULT:"
 MARKER_CURRENT_LEVEL_PATH = "CURRENT_LEVEL_PATH:"
+MARKER_API_VALIDATION_RESULT = "API_VALIDATION_RESULT:"
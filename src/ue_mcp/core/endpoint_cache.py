@@ -0,0 +1,104 @@
+"""
+Last known remote execution endpoint of each editor process, by PID.
+
+Reconnecting through discovery means a multicast ping and a listening window of
+seconds. Once an editor has been connected, its node ID and multicast group are
+recorded here, so a dropped connection can be reopened directly: open_connection
+is sent straight to the known node and the PID is verified over the new
+connection, without discovery (see AsyncRemoteExecutionClient.reconnect).
+
+UE's protocol has the editor connect back to a port the client listens on, so the
+editor has no command port of its own to remember; the endpoint is the node plus
+the multicast group that reaches it.
+
+Entries are kept in a small JSON file in the temp directory, shared by server
+processes, and only ever used after PID verification, so a stale or reused PID
+costs one failed direct attempt.
+"""
+
+import json
+import logging
+import os
+import tempfile
+import time
+from dataclasses import asdict, dataclass
+from pathlib import Path
+from typing import Dict, Optional
+
+logger = logging.getLogger(__name__)
+
+DEFAULT_CACHE_FILE = Path(tempfile.gettempdir()) / "ue_mcp_editor_endpoints.json"
+MAX_ENTRIES = 32
+
+
+@dataclass
+class EditorEndpoint:
+    """Where a connected editor process answered."""
+
+    pid: int
+    node_id: str
+    multicast_group: tuple[str, int]
+    project_name: str = ""
+    updated_at: float = 0.0
+
+
+class EndpointCache:
+    """Editor endpoints by PID, persisted to a JSON file (None = memory only)."""
+
+    def __init__(self, path: Optional[Path] = DEFAULT_CACHE_FILE) -> None:
+        self._path = path
+        self._entries: Dict[int, EditorEndpoint] = {}
+        self._load()
+
+    def get(self, pid: int) -> Optional[EditorEndpoint]:
+        """Last known endpoint of an editor process, if any."""
+        self._load()
+        return self._entries.get(pid)
+
+    def put(self, endpoint: EditorEndpoint) -> None:
+        """Record the endpoint of a freshly connected editor process."""
+        self._load()
+        endpoint.updated_at = endpoint.updated_at or time.time()
+        self._entries[endpoint.pid] = endpoint
+        if len(self._entries) > MAX_ENTRIES:
+            newest = sorted(self._entries.values(), key=lambda e: e.updated_at)[-MAX_ENTRIES:]
+            self._entries = {e.pid: e for e in newest}
+        self._save()
+
+    def forget(self, pid: int) -> None:
+        """Drop the endpoint of an editor process that exited."""
+        self._load()
+        if self._entries.pop(pid, None) is not None:
+            self._save()
+
+    def __len__(self) -> int:
+        return len(self._entries)
+
+    def _load(self) -> None:
+        if self._path is None or not self._path.exists():
+            return
+        try:
+            data = json.loads(self._path.read_text(encoding="utf-8"))
+            self._entries = {
+                int(pid): EditorEndpoint(
+                    pid=int(pid),
+                    node_id=entry["node_id"],
+                    multicast_group=(entry["multicast_group"][0], int(entry["multicast_group"][1])),
+                    project_name=entry.get("project_name", ""),
+                    updated_at=float(entry.get("updated_at", 0.0)),
+                )
+                for pid, entry in data.items()
+            }
+        except (OSError, ValueError, KeyError, TypeError, IndexError) as e:
+            logger.debug(f"Ignoring unreadable endpoint cache {self._path}: {e}")
+
+    def _save(self) -> None:
+        if self._path is None:
+            return
+        data = {str(pid): asdict(entry) for pid, entry in self._entries.items()}
+        temp_path = self._path.with_name(f"{self._path.name}.{os.getpid()}.tmp")
+        try:
+            temp_path.write_text(json.dumps(data), encoding="utf-8")
+            os.replace(temp_path, self._path)
+        except OSError as e:
+            logger.debug(f"Failed to write endpoint cache {self._path}: {e}")
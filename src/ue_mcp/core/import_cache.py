@@ -0,0 +1,82 @@
+"""
+Per-editor-session cache of import statements known to succeed in the editor.
+
+Checked executions probe the code's import statements in the editor before running
+it, so missing packages can be installed first. Statements that imported
+successfully are remembered here and skipped by later probes. Entries are keyed by
+top-level module so they can be dropped when that module may have changed:
+pip installs clear everything, bundled-module unloads drop the unloaded modules.
+"""
+
+import ast
+from typing import Dict, Iterable, List, Optional, Set
+
+
+def top_level_modules(statement: str) -> Set[str]:
+    """
+    Top-level modules an import statement loads.
+
+    Args:
+        statement: Source of one import statement
+
+    Returns:
+        Module names (empty for relative imports or unparseable statements)
+    """
+    try:
+        tree = ast.parse(statement.strip())
+    except SyntaxError:
+        return set()
+
+    modules: Set[str] = set()
+    for node in ast.walk(tree):
+        if isinstance(node, ast.Import):
+            modules.update(alias.name.split(".")[0] for alias in node.names)
+        elif isinstance(node, ast.ImportFrom) and node.level == 0 and node.module:
+            modules.add(node.module.split(".")[0])
+    return modules
+
+
+class ImportCache:
+    """Import statements known to succeed, indexed by top-level module."""
+
+    def __init__(self) -> None:
+        self._statements: Dict[str, Set[str]] = {}
+
+    def unknown(self, statements: Iterable[str]) -> List[str]:
+        """
+        Return the statements that still need probing, in input order.
+
+        Args:
+            statements: Import statements extracted from the code
+
+        Returns:
+            Statements not known to import successfully
+        """
+        return [
+            s
+            for s in statements
+            if not (modules := top_level_modules(s))
+            or not all(s in self._statements.get(m, ()) for m in modules)
+        ]
+
+    def add_good(self, statements: Iterable[str]) -> None:
+        """Remember statements that imported successfully."""
+        for statement in statements:
+            for module in top_level_modules(statement):
+                self._statements.setdefault(module, set()).add(statement)
+
+    def invalidate(self, modules: Optional[Iterable[str]] = None) -> None:
+        """
+        Forget statements that import any of the given top-level modules.
+
+        Args:
+            modules: Top-level module names (None = forget everything)
+        """
+        if modules is None:
+            self._statements.clear()
+            return
+        for module in modules:
+            self._statements.pop(module.split(".")[0], None)
+
+    def __len__(self) -> int:
+        return len(set().union(*self._statements.values())) if self._statements else 0
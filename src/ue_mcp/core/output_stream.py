@@ -0,0 +1,174 @@
+"""
+Stream a script's captured output to the client while it runs.
+
+Scripts executed with output capture write stdout/stderr to a temp file through
+the TeeWriter installed by build_output_capture_code (flushed on every write).
+OutputStreamer tails that file and forwards new lines through a NotifyCallback,
+so multi-minute jobs give feedback before the EXECUTE_FILE command returns.
+
+The reader and the sender are decoupled by a bounded queue. When the client is
+slower than the script, the queue fills, the reader stops reading, and the
+backlog stays in the file on disk rather than in memory; lines are sent in
+batches of up to max_batch_lines per notification.
+"""
+
+import asyncio
+import codecs
+import logging
+from pathlib import Path
+from typing import TYPE_CHECKING, Optional
+
+if TYPE_CHECKING:
+    from ..editor.types import NotifyCallback
+
+logger = logging.getLogger(__name__)
+
+READ_CHUNK_BYTES = 64 * 1024
+
+
+class OutputStreamer:
+    """Tails an output capture file and sends new lines as notifications."""
+
+    def __init__(
+        self,
+        path: Path,
+        notify: "NotifyCallback",
+        poll_interval: float = 0.25,
+        max_buffered_lines: int = 256,
+        max_batch_lines: int = 50,
+        max_line_chars: int = 2000,
+        drain_timeout: float = 5.0,
+    ):
+        """
+        Initialize the streamer.
+
+        Args:
+            path: Output capture file written by the editor
+            notify: Receives ("info", text) with one or more lines per call
+            poll_interval: Seconds between checks for new output
+            max_buffered_lines: Lines read but not yet sent before reading pauses
+            max_batch_lines: Maximum lines per notification
+            max_line_chars: Longer lines are cut to this length
+            drain_timeout: Seconds stop() waits for the remaining lines to be sent
+        """
+        self.path = path
+        self.notify = notify
+        self.poll_interval = poll_interval
+        self.max_batch_lines = max_batch_lines
+        self.max_line_chars = max_line_chars
+        self.drain_timeout = drain_timeout
+
+        self.lines_sent = 0
+        self.bytes_read = 0
+
+        self._queue: asyncio.Queue[Optional[str]] = asyncio.Queue(maxsize=max_buffered_lines)
+        self._decoder = codecs.getincrementaldecoder("utf-8")(errors="replace")
+        self._partial = ""
+        self._skipping = False
+        self._file = None
+        self._stopping = asyncio.Event()
+        self._reader: Optional[asyncio.Task] = None
+        self._sender: Optional[asyncio.Task] = None
+
+    def start(self) -> None:
+        """Start tailing the file from its current beginning."""
+        self._reader = asyncio.create_task(self._read_loop())
+        self._sender = asyncio.create_task(self._send_loop())
+
+    async def stop(self) -> None:
+        """Read the output still in the file, send it, and stop."""
+        if self._reader is None:
+            return
+        self._stopping.set()
+        try:
+            await asyncio.wait_for(
+                asyncio.gather(self._reader, self._sender), timeout=self.drain_timeout
+            )
+        except asyncio.TimeoutError:
+            logger.debug(f"Output stream of {self.path} not drained in {self.drain_timeout}s")
+            self._reader.cancel()
+            self._sender.cancel()
+            await asyncio.gather(self._reader, self._sender, return_exceptions=True)
+        finally:
+            self._reader = None
+            self._close()
+
+    async def _read_loop(self) -> None:
+        while True:
+            # Evaluated before reading so the last read after stop() reaches EOF
+            stopping = self._stopping.is_set()
+            while await self._read_available():
+                pass
+            if stopping:
+                break
+            try:
+                await asyncio.wait_for(self._stopping.wait(), timeout=self.poll_interval)
+            except asyncio.TimeoutError:
+                pass
+        tail = self._partial + self._decoder.decode(b"", final=True)
+        if tail:
+            await self._put(tail)
+        await self._queue.put(None)
+
+    async def _read_available(self) -> bool:
+        """Queue the complete lines of one chunk; False once at end of file."""
+        if self._file is None:
+            try:
+                self._file = open(self.path, "rb")
+            except OSError:
+                return False
+        try:
+            chunk = self._file.read(READ_CHUNK_BYTES)
+        except OSError as e:
+            logger.debug(f"Failed to read output file {self.path}: {e}")
+            return False
+        if not chunk:
+            return False
+
+        self.bytes_read += len(chunk)
+        text = self._partial + self._decoder.decode(chunk)
+        *lines, self._partial = text.split("\n")
+        if self._skipping:
+            # Rest of a line already sent cut at max_line_chars
+            if not lines:
+                self._partial = ""
+                return True
+            lines.pop(0)
+            self._skipping = False
+        for line in lines:
+            # Blocks while the queue is full, which stops reading (backpressure)
+            await self._put(line.rstrip("\r"))
+        if len(self._partial) > self.max_line_chars:
+            await self._put(self._partial)
+            self._partial = ""
+            self._skipping = True
+        return True
+
+    async def _put(self, line: str) -> None:
+        if len(line) > self.max_line_chars:
+            line = line[: self.max_line_chars] + " [...]"
+        await self._queue.put(line)
+
+    async def _send_loop(self) -> None:
+        done = False
+        while not done:
+            line = await self._queue.get()
+            if line is None:
+                return
+            batch = [line]
+            while len(batch) < self.max_batch_lines and not self._queue.empty():
+                line = self._queue.get_nowait()
+                if line is None:
+                    done = True
+                    break
+                batch.append(line)
+            try:
+                await self.notify("info", "\n".join(batch))
+            except Exception as e:
+                logger.debug(f"Failed to send script output: {e}")
+            self.lines_sent += len(batch)
+
+    def _close(self) -> None:
+        if self._file is not None:
+            self._file.close()
+            self._file = None
@@ -0,0 +1,94 @@
+"""Reader for out-of-band script result files.
+
+Result files are written editor-side by ``editor_capture.result_file.write_result_file``
+(see that module for the byte layout). The server picks the path, passes it to the
+script, and reads the result back here instead of scanning the script output.
+"""
+
+import json
+import logging
+import struct
+import tempfile
+import uuid
+from pathlib import Path
+from typing import Any, Optional
+
+logger = logging.getLogger(__name__)
+
+RESULT_FILE_MAGIC = b"UEMCPRES"
+RESULT_FILE_VERSION = 1
+RESULT_FILE_HEADER = struct.Struct("<8sIIQ")
+RESULT_ENCODING_JSON = 1
+
+
+class ResultFileError(Exception):
+    """Raised when a result file is truncated or has an unknown format."""
+
+
+def new_result_file_path(prefix: str = "ue_mcp_result") -> str:
+    """Return a unique result file path in the temp directory (the file is not created)."""
+    return str(Path(tempfile.gettempdir()) / f"{prefix}_{uuid.uuid4().hex[:8]}.bin")
+
+
+def read_result_file(path: str | Path) -> Any:
+    """Read and decode a result file.
+
+    Args:
+        path: Result file path
+
+    Returns:
+        The decoded result
+
+    Raises:
+        FileNotFoundError: If the script did not write a result
+        ResultFileError: If the file is truncated or has an unknown format
+    """
+    with open(path, "rb") as f:
+        header = f.read(RESULT_FILE_HEADER.size)
+        if len(header) < RESULT_FILE_HEADER.size:
+            raise ResultFileError(f"Result file is truncated: {path}")
+
+        magic, version, encoding, length = RESULT_FILE_HEADER.unpack(header)
+        if magic != RESULT_FILE_MAGIC:
+            raise ResultFileError(f"Not a result file (bad magic): {path}")
+        if version != RESULT_FILE_VERSION:
+            raise ResultFileError(
+                f"Unsupported result file version {version} (expected {RESULT_FILE_VERSION})"
+            )
+        if encoding != RESULT_ENCODING_JSON:
+            raise ResultFileError(f"Unsupported result encoding {encoding}: {path}")
+
+        payload = f.read(length)
+        if len(payload) != length:
+            raise ResultFileError(f"Result file payload is truncated: {path}")
+
+    try:
+        return json.loads(payload)
+    except (json.JSONDecodeError, UnicodeDecodeError) as e:
+        raise ResultFileError(f"Result file payload is not valid JSON: {e}") from e
+
+
+def take_result_file(path: Optional[str | Path]) -> Optional[Any]:
+    """Read a result file if the script wrote one, then delete it.
+
+    Args:
+        path: Result file path (None is accepted and returns None)
+
+    Returns:
+        The decoded result, or None if no (valid) result file was written
+    """
+    if not path:
+        return None
+    try:
+        return read_result_file(path)
+    except FileNotFoundError:
+        return None
+    except (OSError, ResultFileError) as e:
+        logger.warning(f"Failed to read result file: {e}")
+        return None
+    finally:
+        for leftover in (Path(path), Path(f"{path}.tmp")):
+            try:
+                leftover.unlink(missing_ok=True)
+            except OSError as e:
+                logger.debug(f"Failed to clean up result file {leftover}: {e}")
@@ -0,0 +1,144 @@
+"""
+Per-phase latency measurement for checked executions.
+
+A checked execute_code / execute_script call goes through several phases (syntax
+check, inspection, editor-side API check, import probe, tracking captures,
+execution, change diff). PhaseTimer measures one call with a monotonic clock;
+LatencyStats keeps a rolling window of the recent calls per operation so tail
+latency per phase can be queried without a profiler.
+
+All durations are reported in milliseconds.
+"""
+
+import math
+import threading
+import time
+from collections import deque
+from contextlib import contextmanager
+from typing import Any, Deque, Dict, Iterator, Optional
+
+# Calls kept per operation for the rolling percentiles
+DEFAULT_WINDOW = 256
+
+# Percentiles reported by LatencyStats.summary()
+PERCENTILES = (50, 90, 99)
+
+
+class PhaseTimer:
+    """Durations of the phases of one call."""
+
+    def __init__(self) -> None:
+        self._start = time.perf_counter()
+        self._total: Optional[float] = None
+        self.phases: Dict[str, float] = {}
+
+    @contextmanager
+    def phase(self, name: str) -> Iterator[None]:
+        """Time the enclosed block as phase name (repeated phases add up)."""
+        start = time.perf_counter()
+        try:
+            yield
+        finally:
+            self.add(name, time.perf_counter() - start)
+
+    def add(self, name: str, seconds: float) -> None:
+        """Add seconds to phase name."""
+        self.phases[name] = self.phases.get(name, 0.0) + max(seconds, 0.0)
+
+    def split(self, name: str, parts: Dict[str, float]) -> None:
+        """
+        Move time measured inside phase name into sub-phases.
+
+        Used when the editor reports how long parts of one request took.
+
+        Args:
+            name: Phase that contained the parts
+            parts: Sub-phase durations in seconds
+        """
+        moved = 0.0
+        for part, seconds in parts.items():
+            if isinstance(seconds, (int, float)) and seconds > 0:
+                self.add(part, seconds)
+                moved += seconds
+        if name in self.phases:
+            self.phases[name] = max(self.phases[name] - moved, 0.0)
+
+    def stop(self) -> float:
+        """Stop the total clock; returns the total in seconds."""
+        if self._total is None:
+            self._total = time.perf_counter() - self._start
+        return self._total
+
+    def as_dict(self) -> Dict[str, Any]:
+        """
+        Timings block for a result.
+
+        Returns:
+            {"total_ms": float, "phases_ms": {phase: float}} in phase order
+        """
+        return {
+            "total_ms": round(self.stop() * 1000.0, 3),
+            "phases_ms": {name: round(s * 1000.0, 3) for name, s in self.phases.items()},
+        }
+
+
+def percentile(sorted_values: list, pct: float) -> float:
+    """Nearest-rank percentile of an ascending list (which must not be empty)."""
+    rank = max(1, math.ceil(pct / 100.0 * len(sorted_values)))
+    return sorted_values[rank - 1]
+
+
+class LatencyStats:
+    """Rolling per-phase latency samples, per operation."""
+
+    def __init__(self, window: int = DEFAULT_WINDOW) -> None:
+        self._window = window
+        self._lock = threading.Lock()
+        self._counts: Dict[str, int] = {}
+        # operation -> phase -> recent durations (seconds)
+        self._samples: Dict[str, Dict[str, Deque[float]]] = {}
+
+    def record(self, operation: str, timer: PhaseTimer) -> None:
+        """Add one call's phases (and its total, as phase "total")."""
+        total = timer.stop()
+        with self._lock:
+            self._counts[operation] = self._counts.get(operation, 0) + 1
+            phases = self._samples.setdefault(operation, {})
+            for name, seconds in [*timer.phases.items(), ("total", total)]:
+                samples = phases.get(name)
+                if samples is None:
+                    samples = phases[name] = deque(maxlen=self._window)
+                samples.append(seconds)
+
+    def summary(self) -> Dict[str, Any]:
+        """
+        Percentiles of the recent calls.
+
+        Returns:
+            {operation: {"calls": int, "window": int,
+                         "phases_ms": {phase: {"count", "p50", "p90", "p99", "max"}}}}
+            Each phase keeps its own window; "count" is its number of samples.
+        """
+        with self._lock:
+            snapshot = {
+                op: (self._counts[op], {n: sorted(s) for n, s in phases.items()})
+                for op, phases in self._samples.items()
+            }
+
+        summary: Dict[str, Any] = {}
+        for op, (calls, phases) in snapshot.items():
+            phases_ms = {}
+            for name, values in phases.items():
+                stats: Dict[str, Any] = {"count": len(values)}
+                for pct in PERCENTILES:
+                    stats[f"p{pct}"] = round(percentile(values, pct) * 1000.0, 3)
+                stats["max"] = round(values[-1] * 1000.0, 3)
+                phases_ms[name] = stats
+            summary[op] = {"calls": calls, "window": self._window, "phases_ms": phases_ms}
+        return summary
+
+    def reset(self) -> None:
+        """Forget all samples."""
+        with self._lock:
+            self._counts.clear()
+            self._samples.clear()
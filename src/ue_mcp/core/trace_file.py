@@ -0,0 +1,280 @@
+"""Reader for columnar binary PIE trace files.
+
+Trace files are written editor-side by ``editor_capture.trace_file.TraceFileWriter``
+(see that module for the byte layout). The file is memory-mapped and only the
+requested actor/tick slice of each column is decoded, so large traces can be
+queried without loading them fully.
+"""
+
+import bisect
+import json
+import math
+import mmap
+import struct
+import sys
+from pathlib import Path
+from typing import Any, Optional
+
+TRACE_FILE_MAGIC = b"UEMCPTRC"
+TRACE_FILE_VERSION = 1
+TRACE_FILE_HEADER = struct.Struct("<8sIIQQ")
+TRACE_FILE_NAME = "trace.uetrace"
+
+_TYPE_SIZES = {"i": 4, "d": 8, "f": 4}
+_ACTOR_KEYS = ("name", "count", "tick_min", "tick_max", "offsets")
+
+# What decoding a damaged index or column raises; surfaced as TraceFileError
+_CORRUPT_ERRORS = (ValueError, KeyError, TypeError, IndexError, struct.error)
+
+
+class TraceFileError(Exception):
+    """Raised when a trace file is missing, truncated, corrupt or has an unknown format."""
+
+
+class TraceFile:
+    """Memory-mapped view of a columnar trace file.
+
+    Usage:
+        with TraceFile(path) as trace:
+            trace.actor_names
+            trace.read("BP_Player", tick_start=60, tick_end=120)
+
+    Actors are keyed by object path ("name" in the index); their editor label is
+    kept for display and accepted by read() when it names a single actor.
+    """
+
+    def __init__(self, path: str | Path):
+        self.path = Path(path)
+        if not self.path.is_file():
+            raise TraceFileError(f"Trace file not found: {self.path}")
+
+        self._file = open(self.path, "rb")
+        try:
+            self._mm = mmap.mmap(self._file.fileno(), 0, access=mmap.ACCESS_READ)
+        except ValueError as e:
+            self._file.close()
+            raise TraceFileError(f"Trace file is empty: {self.path}") from e
+
+        try:
+            self._index = self._read_index()
+            self.columns: list[str] = [c["name"] for c in self._index["columns"]]
+            self._column_types: dict[str, str] = {
+                c["name"]: c["type"] for c in self._index["columns"]
+            }
+            self._actors: dict[str, dict[str, Any]] = {
+                a["name"]: a for a in self._index["actors"]
+            }
+            self._check_index()
+        except TraceFileError:
+            self.close()
+            raise
+        except _CORRUPT_ERRORS as e:
+            self.close()
+            raise TraceFileError(f"Trace file index is corrupt: {self.path} ({e!r})") from e
+        except Exception:
+            self.close()
+            raise
+
+    def _read_index(self) -> dict[str, Any]:
+        if len(self._mm) < TRACE_FILE_HEADER.size:
+            raise TraceFileError(f"Trace file is truncated: {self.path}")
+
+        magic, version, _actor_count, index_offset, index_length = (
+            TRACE_FILE_HEADER.unpack_from(self._mm, 0)
+        )
+        if magic != TRACE_FILE_MAGIC:
+            raise TraceFileError(f"Not a trace file (bad magic): {self.path}")
+        if version != TRACE_FILE_VERSION:
+            raise TraceFileError(
+                f"Unsupported trace file version {version} (expected {TRACE_FILE_VERSION})"
+            )
+        if index_offset + index_length > len(self._mm):
+            raise TraceFileError(f"Trace file index is truncated: {self.path}")
+
+        return json.loads(self._mm[index_offset : index_offset + index_length])
+
+    def _check_index(self) -> None:
+        """Check that every actor entry has its fields and a column inside the file."""
+        unknown = [t for t in self._column_types.values() if t not in _TYPE_SIZES]
+        if unknown or "tick" not in self._column_types:
+            raise TraceFileError(f"Trace file has invalid columns: {self.path}")
+        for actor in self._actors.values():
+            missing = [k for k in _ACTOR_KEYS if k not in actor]
+            if missing:
+                raise TraceFileError(f"Trace file actor entry lacks {missing}: {self.path}")
+            for name, typecode in self._column_types.items():
+                end = actor["offsets"][name] + actor["count"] * _TYPE_SIZES[typecode]
+                if actor["offsets"][name] < 0 or end > len(self._mm):
+                    raise TraceFileError(
+                        f"Column {name} of {actor['name']} is truncated: {self.path}"
+                    )
+
+    @property
+    def metadata(self) -> dict[str, Any]:
+        """Metadata dict stored by the writer."""
+        return self._index.get("metadata", {})
+
+    @property
+    def actor_names(self) -> list[str]:
+        """Actor keys (object paths) in file order."""
+        return [a["name"] for a in self._index["actors"]]
+
+    def summary(self) -> list[dict[str, Any]]:
+        """Per-actor label, sample count and tick range."""
+        return [
+            {
+                "name": a["name"],
+                "label": a.get("label", a["name"]),
+                "count": a["count"],
+                "tick_min": a["tick_min"],
+                "tick_max": a["tick_max"],
+            }
+            for a in self._index["actors"]
+        ]
+
+    def resolve(self, actor_name: str) -> str:
+        """Resolve an actor key, or a label shared by no other actor, to its key."""
+        if actor_name in self._actors:
+            return actor_name
+        matches = [a["name"] for a in self._index["actors"] if a.get("label") == actor_name]
+        if len(matches) == 1:
+            return matches[0]
+        if matches:
+            raise TraceFileError(f"Label {actor_name} matches several actors: {matches}")
+        raise TraceFileError(f"Actor not in trace: {actor_name}")
+
+    def _column_slice(self, actor: dict[str, Any], name: str, lo: int, hi: int) -> list[Any]:
+        """Decode rows [lo, hi) of one column of one actor."""
+        typecode = self._column_types[name]
+        item_size = _TYPE_SIZES[typecode]
+        offset = actor["offsets"][name] + lo * item_size
+        count = hi - lo
+        if sys.byteorder == "little":
+            with memoryview(self._mm) as view:
+                with view[offset : offset + count * item_size].cast(typecode) as column:
+                    return column.tolist()
+        return list(struct.unpack_from(f"<{count}{typecode}", self._mm, offset))
+
+    def _tick_bounds(
+        self, actor: dict[str, Any], tick_start: Optional[int], tick_end: Optional[int]
+    ) -> tuple[int, int]:
+        """Binary-search the sorted tick column for the [tick_start, tick_end] row range."""
+        count = actor["count"]
+        offset = actor["offsets"]["tick"]
+
+        def tick_at(row: int) -> int:
+            return struct.unpack_from("<i", self._mm, offset + row * 4)[0]
+
+        rows = range(count)
+        lo = 0 if tick_start is None else bisect.bisect_left(rows, tick_start, key=tick_at)
+        hi = count if tick_end is None else bisect.bisect_right(rows, tick_end, key=tick_at)
+        return lo, max(lo, hi)
+
+    def read(
+        self,
+        actor_name: str,
+        tick_start: Optional[int] = None,
+        tick_end: Optional[int] = None,
+        columns: Optional[list[str]] = None,
+        max_samples: Optional[int] = None,
+    ) -> dict[str, Any]:
+        """Read a slice of one actor's columns.
+
+        Args:
+            actor_name: Actor key as stored in the index, or a unique label
+            tick_start: First tick to include (inclusive), None = from the beginning
+            tick_end: Last tick to include (inclusive), None = to the end
+            columns: Column names to return (default: all). "tick" is always included.
+            max_samples: Cap on the number of returned samples (first N in range)
+
+        Returns:
+            Dict with "count", "truncated" and one list per requested column.
+            NaN values (e.g. missing velocity) are returned as None.
+        """
+        if max_samples is not None and max_samples < 0:
+            raise TraceFileError(f"max_samples must be >= 0, got {max_samples}")
+        actor = self._actors[self.resolve(actor_name)]
+
+        wanted = list(columns) if columns else list(self.columns)
+        unknown = [c for c in wanted if c not in self._column_types]
+        if unknown:
+            raise TraceFileError(f"Unknown columns: {unknown}. Available: {self.columns}")
+        if "tick" not in wanted:
+            wanted.insert(0, "tick")
+
+        try:
+            lo, hi = self._tick_bounds(actor, tick_start, tick_end)
+
+            truncated = False
+            if max_samples is not None and hi - lo > max_samples:
+                hi = lo + max_samples
+                truncated = True
+
+            result: dict[str, Any] = {"count": hi - lo, "truncated": truncated}
+            for name in wanted:
+                values = self._column_slice(actor, name, lo, hi)
+                if self._column_types[name] == "i":
+                    result[name] = values
+                else:
+                    result[name] = [None if math.isnan(v) else v for v in values]
+        except _CORRUPT_ERRORS as e:
+            raise TraceFileError(
+                f"Trace file data for {actor_name} is corrupt: {self.path} ({e!r})"
+            ) from e
+        return result
+
+    def close(self) -> None:
+        """Release the memory map and file handle."""
+        mm = getattr(self, "_mm", None)
+        if mm is not None:
+            mm.close()
+            self._mm = None
+        if not self._file.closed:
+            self._file.close()
+
+    def __enter__(self) -> "TraceFile":
+        return self
+
+    def __exit__(self, *exc: Any) -> None:
+        self.close()
+
+
+def read_trace(
+    path: str | Path,
+    actor_names: Optional[list[str]] = None,
+    tick_start: Optional[int] = None,
+    tick_end: Optional[int] = None,
+    columns: Optional[list[str]] = None,
+    max_samples: Optional[int] = None,
+) -> dict[str, Any]:
+    """Read a slice of a trace file.
+
+    Args:
+        path: Trace file path, or a trace output directory containing trace.uetrace
+        actor_names: Actor keys or unique labels to return (default: all)
+        tick_start: First tick to include (inclusive)
+        tick_end: Last tick to include (inclusive)
+        columns: Columns to return (default: all)
+        max_samples: Per-actor cap on returned samples
+
+    Returns:
+        Dict with trace_file, metadata, actors (summary), columns and samples
+        ({actor key: column slice})
+    """
+    path = Path(path)
+    if path.is_dir():
+        path = path / TRACE_FILE_NAME
+
+    with TraceFile(path) as trace:
+        names = [trace.resolve(n) for n in actor_names] if actor_names else trace.actor_names
+        samples = {
+            name: trace.read(name, tick_start, tick_end, columns, max_samples)
+            for name in names
+        }
+        return {
+            "trace_file": str(path),
+            "metadata": trace.metadata,
+            "actors": trace.summary(),
+            "columns": trace.columns,
+            "samples": samples,
+        }
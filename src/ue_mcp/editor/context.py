@@ -15,6 +15,7 @@ from dataclasses import dataclass, field
 from pathlib import Path
 from typing import TYPE_CHECKING, Any, Optional
 
+from ..core.endpoint_cache import EditorEndpoint, EndpointCache
 from .types import EditorInstance, NotifyCallback
 
 if TYPE_CHECKING:
@@ -50,6 +51,9 @@ class EditorContext:
     # Background task tracking
     _background_tasks: set[asyncio.Task] = field(default_factory=set, repr=False)
 
+    # Last known remote execution endpoint per editor PID (direct reconnects)
+    endpoint_cache: EndpointCache = field(default_factory=EndpointCache, repr=False)
+
     @property
     def editor(self) -> Optional[EditorInstance]:
         """Get the current editor instance."""
@@ -83,6 +87,20 @@ class EditorContext:
                 logger.debug(f"Cancelled background task: {task.get_name()}")
         self._background_tasks.clear()
 
+    def remember_endpoint(self) -> None:
+        """Record the connected editor's node and multicast group for direct reconnects."""
+        editor = self._editor
+        if editor is None or editor.remote_client is None or not editor.node_id:
+            return
+        self.endpoint_cache.put(
+            EditorEndpoint(
+                pid=editor.process.pid,
+                node_id=editor.node_id,
+                multicast_group=tuple(editor.remote_client.multicast_group),
+                project_name=self.project_name,
+            )
+        )
+
     def reset_monitor_state(self) -> None:
         """Reset health monitor state for fresh launches."""
         self._intentional_stop = False
@@ -115,6 +133,7 @@ class EditorContext:
             "project_path": str(self.project_path),
             "pid": self._editor.process.pid,
             "started_at": self._editor.started_at.isoformat(),
+            "headless": self._editor.headless,
             "connected": (
                 self._editor.remote_client.is_connected()
                 if self._editor.remote_client
@@ -227,9 +246,9 @@ class EditorContext:
         if self._editor.remote_client and self._editor.remote_client.is_connected():
             try:
                 logger.info("Attempting graceful shutdown...")
-                self._editor.remote_client.execute(
-                    "import unreal; unreal.SystemLibrary.quit_editor()",
-                    timeout=5.0,
+                # Fire-and-forget: stop() is also called at exit, outside the event loop
+                self._editor.remote_client.send_nowait(
+                    "import unreal; unreal.SystemLibrary.quit_editor()"
                 )
             except Exception as e:
                 logger.warning(f"Graceful shutdown command failed: {e}")
@@ -249,6 +268,7 @@ class EditorContext:
                 logger.error("Termination timed out, killing process...")
                 self._editor.process.kill()
 
+        self.endpoint_cache.forget(self._editor.process.pid)
         self._editor.status = "stopped"
         self._editor = None
 
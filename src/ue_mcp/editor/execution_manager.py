@@ -7,12 +7,16 @@ This subsystem manages:
 - Managing Python environment
 """
 
+import asyncio
+import json
 import logging
 import tempfile
 import uuid
 from pathlib import Path
 from typing import TYPE_CHECKING, Any, Optional
 
+from ..core.constants import MARKER_API_VALIDATION_RESULT
+from ..core.output_stream import OutputStreamer
 from ..core.pip_install import (
     extract_bundled_module_imports,
     extract_import_statements,
@@ -22,21 +26,25 @@ from ..core.pip_install import (
     module_to_package,
     pip_install,
 )
-from ..remote_client import RemoteExecutionClient
-from ..tracking.actor_snapshot import (
-    compare_level_actor_snapshots,
-    create_level_actor_snapshot,
+from ..core.result_file import new_result_file_path, take_result_file
+from ..core.timings import LatencyStats, PhaseTimer
+from ..async_remote_client import AsyncRemoteExecutionClient
+from ..tracking.asset_tracker import extract_game_paths, get_dirty_asset_paths
+from ..tracking.execution_tracking import (
+    TrackedExecution,
+    build_tracked_code,
+    capture_post_execution,
+    capture_pre_execution,
+    compute_changes,
 )
-from ..tracking.asset_tracker import (
-    compare_snapshots,
-    create_snapshot,
-    extract_game_paths,
-    extract_level_paths,
-    get_current_level_path,
-    get_dirty_asset_paths,
+from ..tools._helpers import build_env_injection_code, build_output_capture_code
+from ..validation.api_path_cache import ApiPathCache
+from ..validation.code_inspector import (
+    InspectionResult,
+    UnrealAPIChecker,
+    collect_unreal_api_references,
+    inspect_code,
 )
-from ..tools._helpers import build_env_injection_code
-from ..validation.code_inspector import inspect_code
 from .crash_detector import CrashDetector
 from .health_monitor import HealthMonitor
 
@@ -47,6 +55,9 @@ if TYPE_CHECKING:
 
 logger = logging.getLogger(__name__)
 
+# Captured output beyond this is left out of the result (the head was streamed)
+MAX_CAPTURED_OUTPUT_BYTES = 256 * 1024
+
 
 def _build_crash_response(ctx: "EditorContext", details: dict[str, Any]) -> dict[str, Any]:
     """
@@ -110,6 +121,13 @@ class ExecutionManager:
         """
         self._ctx = context
         self._launch_manager: "LaunchManager | None" = None
+        self._api_path_cache = ApiPathCache()
+        self._latency_stats = LatencyStats()
+        # Serializes each inject -> execute -> cleanup sequence (including the
+        # tracking snapshots): the injected os.environ parameters, builtins output
+        # capture and tracking state are editor-global, so overlapping calls
+        # would read each other's parameters and changes.
+        self._execution_lock = asyncio.Lock()
 
     def set_launch_manager(self, launch_manager: "LaunchManager") -> None:
         """Set the LaunchManager reference for auto-launch capability.
@@ -122,6 +140,11 @@ class ExecutionManager:
         """
         self._launch_manager = launch_manager
 
+    @property
+    def latency_stats(self) -> LatencyStats:
+        """Rolling per-phase latency of execute_code / execute_script calls."""
+        return self._latency_stats
+
     # =========================================================================
     # PUBLIC API (3 async methods) - Always auto-launch if editor not running
     # =========================================================================
@@ -132,6 +155,7 @@ class ExecutionManager:
         timeout: float = 30.0,
         checks: bool = True,
         notify: "NotifyCallback | None" = None,
+        timings: bool = False,
     ) -> dict[str, Any]:
         """
         Execute Python code in the editor.
@@ -144,6 +168,7 @@ class ExecutionManager:
             timeout: Execution timeout in seconds
             checks: Enable validation and tracking (default: True)
             notify: Optional callback for launch progress notifications
+            timings: Include the per-phase "timings" block in the result
 
         Returns:
             Execution result dictionary
@@ -152,10 +177,14 @@ class ExecutionManager:
         if ensure_result is not None:
             return ensure_result
 
-        if checks:
-            return self._execute_with_checks_impl(code, timeout=timeout)
-        else:
-            return self._execute_code_impl(code, timeout=timeout)
+        timer = PhaseTimer()
+        async with self._execution_lock:
+            if checks:
+                result = await self._execute_with_checks_impl(code, timeout=timeout, timer=timer)
+            else:
+                with timer.phase("execution"):
+                    result = await self._execute_code_impl(code, timeout=timeout)
+        return self._record_timings("execute_code", result, timer, timings)
 
     async def execute_script(
         self,
@@ -166,6 +195,7 @@ class ExecutionManager:
         wait_for_latent: bool = True,
         latent_timeout: float = 60.0,
         notify: "NotifyCallback | None" = None,
+        timings: bool = False,
     ) -> dict[str, Any]:
         """
         Execute a Python script file in the editor.
@@ -180,7 +210,9 @@ class ExecutionManager:
             checks: Enable validation and tracking (default: True)
             wait_for_latent: Whether to wait for latent commands to complete
             latent_timeout: Max time to wait for latent commands
-            notify: Optional callback for launch progress notifications
+            notify: Optional callback for launch progress notifications; when set,
+                the script's output is also streamed through it while it runs
+            timings: Include the per-phase "timings" block in the result
 
         Returns:
             Execution result dictionary
@@ -189,31 +221,40 @@ class ExecutionManager:
         if ensure_result is not None:
             return ensure_result
 
+        timer = PhaseTimer()
         # If params provided, use parameter injection flow
         if params is not None:
-            return self._execute_script_with_params(
-                script_path,
-                params,
-                timeout=timeout,
-                wait_for_latent=wait_for_latent,
-                latent_timeout=latent_timeout,
-            )
-
+            with timer.phase("execution"):
+                result = await self._execute_script_with_params(
+                    script_path,
+                    params,
+                    timeout=timeout,
+                    wait_for_latent=wait_for_latent,
+                    latent_timeout=latent_timeout,
+                    notify=notify,
+                )
         # No params, use appropriate execution method
-        if checks:
-            return self._execute_script_with_checks_impl(
-                script_path,
-                timeout=timeout,
-                wait_for_latent=wait_for_latent,
-                latent_timeout=latent_timeout,
-            )
+        elif checks:
+            async with self._execution_lock:
+                result = await self._execute_script_with_checks_impl(
+                    script_path,
+                    timeout=timeout,
+                    wait_for_latent=wait_for_latent,
+                    latent_timeout=latent_timeout,
+                    timer=timer,
+                    notify=notify,
+                )
         else:
-            return self._execute_script_impl(
-                script_path,
-                timeout=timeout,
-                wait_for_latent=wait_for_latent,
-                latent_timeout=latent_timeout,
-            )
+            async with self._execution_lock:
+                with timer.phase("execution"):
+                    result = await self._execute_script_impl(
+                        script_path,
+                        timeout=timeout,
+                        wait_for_latent=wait_for_latent,
+                        latent_timeout=latent_timeout,
+                        notify=notify,
+                    )
+        return self._record_timings("execute_script", result, timer, timings)
 
     async def pip_install(
         self,
@@ -237,15 +278,16 @@ class ExecutionManager:
         ensure_result = await self._ensure_editor_ready(notify)
         if ensure_result is not None:
             return ensure_result
-        return self._pip_install_impl(packages, upgrade=upgrade)
+        return await self._pip_install_impl(packages, upgrade=upgrade)
 
     # =========================================================================
     # PRIVATE IMPLEMENTATION METHODS
-    # These are sync methods used internally and by tracking modules.
+    # These are coroutines on the asyncio remote client, used internally and
+    # by tracking modules.
     # External callers should use the public async methods above.
     # =========================================================================
 
-    def _execute_code_impl(self, code: str, timeout: float = 30.0) -> dict[str, Any]:
+    async def _execute_code_impl(self, code: str, timeout: float = 30.0) -> dict[str, Any]:
         """
         Execute Python code in the managed editor (internal use only).
 
@@ -274,46 +316,25 @@ class ExecutionManager:
         if (
             self._ctx.editor.remote_client is None
             or not self._ctx.editor.remote_client.is_connected()
-        ):
-            # Try to reconnect using stored node_id and PID
-            logger.info("Remote client disconnected, attempting to reconnect...")
-
-            # Clean up old remote_client if it exists
-            if self._ctx.editor.remote_client is not None:
-                self._ctx.editor.remote_client._cleanup_sockets()
-                self._ctx.editor.remote_client = None
-
-            remote_client = RemoteExecutionClient(
-                project_name=self._ctx.project_name,
-                expected_node_id=self._ctx.editor.node_id,  # Prefer known node
-                expected_pid=self._ctx.editor.process.pid,  # Verify PID
-                multicast_group=("239.0.0.1", self._ctx.editor.multicast_port),
-            )
-
-            # Use find_and_verify_instance for reconnection
-            if remote_client.find_and_verify_instance(timeout=5.0):
-                self._ctx.editor.remote_client = remote_client
-                logger.info("Reconnected successfully")
-            else:
-                remote_client._cleanup_sockets()
-                return {
-                    "success": False,
-                    "error": "Failed to reconnect to editor. Editor may have crashed.",
-                }
+        ) and not await self._reconnect():
+            return {
+                "success": False,
+                "error": "Failed to reconnect to editor. Editor may have crashed.",
+            }
 
         # Execute code using EXECUTE_STATEMENT
         # Multi-line code must be wrapped in exec() as EXECUTE_STATEMENT only supports single statements
         if "\n" in code:
             # Wrap multi-line code in exec()
             wrapped_code = f"exec({repr(code)})"
-            result = self._ctx.editor.remote_client.execute(
+            result = await self._ctx.editor.remote_client.execute(
                 wrapped_code,
                 exec_type=self._ctx.editor.remote_client.ExecTypes.EXECUTE_STATEMENT,
                 timeout=timeout,
             )
         else:
             # Single line, execute directly
-            result = self._ctx.editor.remote_client.execute(
+            result = await self._ctx.editor.remote_client.execute(
                 code,
                 exec_type=self._ctx.editor.remote_client.ExecTypes.EXECUTE_STATEMENT,
                 timeout=timeout,
@@ -325,13 +346,56 @@ class ExecutionManager:
 
         return result
 
-    def _execute_script_impl(
+    async def _reconnect(self) -> bool:
+        """
+        Replace a disconnected remote client, verifying the editor's PID.
+
+        Tries the editor's last known endpoint directly first (milliseconds), then
+        discovery of the known node, which returns as soon as that node answers.
+
+        Returns:
+            True if the editor's remote_client is connected again
+        """
+        editor = self._ctx.editor
+        logger.info("Remote client disconnected, attempting to reconnect...")
+
+        # Clean up old remote_client if it exists
+        if editor.remote_client is not None:
+            editor.remote_client._cleanup_sockets()
+            editor.remote_client = None
+
+        pid = editor.process.pid
+        endpoint = self._ctx.endpoint_cache.get(pid)
+        node_id = endpoint.node_id if endpoint else editor.node_id
+        multicast_group = ("239.0.0.1", editor.multicast_port)
+        remote_client = AsyncRemoteExecutionClient(
+            project_name=self._ctx.project_name,
+            expected_node_id=node_id,  # Prefer known node
+            expected_pid=pid,  # Verify PID
+            multicast_group=endpoint.multicast_group if endpoint else multicast_group,
+        )
+
+        connected = bool(node_id) and await remote_client.reconnect(node_id)
+        if not connected:
+            connected = await remote_client.find_and_verify_instance(timeout=5.0)
+        if not connected:
+            remote_client._cleanup_sockets()
+            return False
+
+        editor.remote_client = remote_client
+        editor.node_id = remote_client.get_node_id()
+        self._ctx.remember_endpoint()
+        logger.info("Reconnected successfully")
+        return True
+
+    async def _execute_script_impl(
         self,
         script_path: str,
         timeout: float = 120.0,
         output_file: str | None = None,
         wait_for_latent: bool = True,
         latent_timeout: float = 60.0,
+        notify: "NotifyCallback | None" = None,
     ) -> dict[str, Any]:
         """
         Execute a Python script file using EXECUTE_FILE mode (internal use only).
@@ -339,12 +403,17 @@ class ExecutionManager:
         This enables true hot-reload as the file is executed directly from disk.
         Parameters should be injected before calling this method.
 
+        With notify, the captured output is streamed through it while the script
+        and its latent commands run; output capture is set up here if the caller
+        did not.
+
         Args:
             script_path: Absolute path to the Python script file
             timeout: Execution timeout in seconds
             output_file: Optional path to temp file containing captured stdout/stderr
             wait_for_latent: Whether to wait for latent commands to complete (default: True)
             latent_timeout: Max time to wait for latent commands in seconds (default: 60)
+            notify: Optional callback receiving the script's output lines as they appear
 
         Returns:
             Execution result dictionary with captured output
@@ -369,9 +438,17 @@ class ExecutionManager:
             if not has_latent_commands:
                 logger.debug(f"No latent commands detected in {script_path}, skipping wait")
 
+        if notify is not None and output_file is None:
+            output_file = await self._start_output_capture()
+
+        streamer = None
+        if notify is not None and output_file:
+            streamer = OutputStreamer(Path(output_file), notify)
+            streamer.start()
+
         try:
             # Execute file directly (no string reading, no concatenation)
-            result = self._ctx.editor.remote_client.execute(
+            result = await self._ctx.editor.remote_client.execute(
                 script_path,
                 exec_type=self._ctx.editor.remote_client.ExecTypes.EXECUTE_FILE,
                 timeout=timeout,
@@ -384,7 +461,7 @@ class ExecutionManager:
             # Wait for latent commands to complete if script contains them
             # This handles async scripts using @unreal.AutomationScheduler.add_latent_command
             if has_latent_commands and result.get("success", False):
-                latent_result = self._wait_for_latent_commands(latent_timeout)
+                latent_result = await self._wait_for_latent_commands(latent_timeout)
                 if latent_result.get("timed_out"):
                     result["latent_warning"] = (
                         f"Latent commands did not complete within {latent_timeout}s. "
@@ -402,7 +479,10 @@ class ExecutionManager:
                     "if hasattr(builtins, '__ue_mcp_output_file__'):\n"
                     "    builtins.__ue_mcp_output_file__.close()"
                 )
-                self._execute_code_impl(cleanup_code, timeout=5.0)
+                await self._execute_code_impl(cleanup_code, timeout=5.0)
+
+            if streamer is not None:
+                await streamer.stop()
 
             # Read captured stdout/stderr from temp file if provided
             if output_file:
@@ -413,6 +493,8 @@ class ExecutionManager:
 
             return result
         finally:
+            if streamer is not None:
+                await streamer.stop()
             # Always clean up temp file
             if output_file:
                 try:
@@ -420,23 +502,24 @@ class ExecutionManager:
                 except Exception as e:
                     logger.debug(f"Failed to clean up temp output file: {e}")
 
-    def _execute_script_with_params(
+    async def _execute_script_with_params(
         self,
         script_path: str,
         params: dict[str, Any],
         timeout: float = 120.0,
         wait_for_latent: bool = True,
         latent_timeout: float = 60.0,
+        notify: "NotifyCallback | None" = None,
     ) -> dict[str, Any]:
         """
         Execute a script with parameter injection via environment variables.
 
         This is the internal implementation for scripts that need parameters.
         It handles:
-        1. Creating a temporary file for output capture
+        1. Creating temporary files for output capture and the script result
         2. Injecting parameters via environment variables (EXECUTE_STATEMENT)
         3. Executing the script file (EXECUTE_FILE)
-        4. Reading captured output and cleaning up
+        4. Reading captured output and the result file, and cleaning up
 
         Args:
             script_path: Absolute path to the Python script file
@@ -444,9 +527,12 @@ class ExecutionManager:
             timeout: Execution timeout in seconds
             wait_for_latent: Whether to wait for latent commands to complete
             latent_timeout: Max time to wait for latent commands
+            notify: Optional callback receiving the script's output lines as they appear
 
         Returns:
-            Execution result dictionary
+            Execution result dictionary. If the script wrote its result through
+            output_result(), the decoded result is stored under "script_result"
+            ("result" is the editor's own value of the exec call).
 
         Raises:
             FileNotFoundError: If the script does not exist
@@ -455,34 +541,216 @@ class ExecutionManager:
         if not path.exists():
             return {"success": False, "error": f"Script not found: {script_path}"}
 
-        # Step 1: Create temporary file for output capture
-        temp_dir = Path(tempfile.gettempdir())
-        output_file = str(temp_dir / f"ue_mcp_output_{uuid.uuid4().hex[:8]}.txt")
+        async with self._execution_lock:
+            # Step 1: Create temporary file for output capture
+            temp_dir = Path(tempfile.gettempdir())
+            output_file = str(temp_dir / f"ue_mcp_output_{uuid.uuid4().hex[:8]}.txt")
+            result_file = new_result_file_path()
 
-        # Step 2: Inject parameters via environment variables with output capture
-        injection_code = build_env_injection_code(str(script_path), params, output_file)
-        inject_result = self._execute_code_impl(injection_code, timeout=5.0)
+            try:
+                # Step 2: Inject parameters via environment variables with output capture
+                injection_code = build_env_injection_code(
+                    str(script_path), params, output_file, result_file
+                )
+                inject_result = await self._execute_code_impl(injection_code, timeout=5.0)
 
-        if not inject_result.get("success"):
-            return {
-                "success": False,
-                "error": f"Failed to inject parameters: {inject_result.get('error')}",
-            }
+                if not inject_result.get("success"):
+                    return {
+                        "success": False,
+                        "error": f"Failed to inject parameters: {inject_result.get('error')}",
+                    }
+
+                # Step 3: Execute script file directly (true hot-reload)
+                result = await self._execute_script_impl(
+                    script_path,
+                    timeout=timeout,
+                    output_file=output_file,
+                    wait_for_latent=wait_for_latent,
+                    latent_timeout=latent_timeout,
+                    notify=notify,
+                )
+            finally:
+                # Step 4: Pick up the out-of-band result (always removes the file)
+                script_result = take_result_file(result_file)
+
+            if script_result is not None:
+                result["script_result"] = script_result
+            return result
+
+    async def _check_unreal_api(self, code: str) -> Optional[dict[str, Any]]:
+        """
+        Validate the code's unreal API references against the editor (UnrealAPIChecker).
+
+        References are extracted server-side, and only paths not yet confirmed for
+        the editor's engine build are sent to the code inspector resident in the
+        editor (preloaded by editor_init.py). Confirmed paths are cached per build.
+
+        Args:
+            code: Python code to check
+
+        Returns:
+            Error result if the code references APIs that do not exist, else None.
+            Validation failures are logged and never block execution.
+        """
+        checker = UnrealAPIChecker()
+        references = collect_unreal_api_references(code)
+        if not references:
+            return None
+
+        editor = self._ctx.editor
+        paths = self._api_path_cache.unknown(editor.engine_build, (r.dotted for r in references))
+        if not paths:
+            logger.debug(f"Unreal API check: all {len(references)} references cached")
+            return None
+
+        # Calculate src path relative to this file (__file__ is not available in editor)
+        src_path = str(Path(__file__).parent.parent.parent)
+        request_code = f"""import json
+import sys
+
+src_path = {src_path!r}
+if src_path not in sys.path:
+    sys.path.insert(0, src_path)
+
+from ue_mcp.validation.code_inspector import validate_unreal_api_paths
 
-        # Step 3: Execute script file directly (true hot-reload)
-        return self._execute_script_impl(
-            script_path,
-            timeout=timeout,
-            output_file=output_file,
-            wait_for_latent=wait_for_latent,
-            latent_timeout=latent_timeout,
+print({MARKER_API_VALIDATION_RESULT!r} + json.dumps(validate_unreal_api_paths({paths!r})))
+"""
+        result = await self._execute_code_impl(request_code, timeout=10.0)
+        output_str = "".join(
+            str(line.get("output", "")) if isinstance(line, dict) else str(line)
+            for line in result.get("output", [])
         )
+        if not result.get("success") or MARKER_API_VALIDATION_RESULT not in output_str:
+            # Better to allow code execution than block it due to inspector issues
+            logger.warning(f"Editor-side API validation failed: {result.get('error')}")
+            return None
+        try:
+            data, _ = json.JSONDecoder().raw_decode(
+                output_str.split(MARKER_API_VALIDATION_RESULT, 1)[1].strip()
+            )
+            engine_build = data["engine_build"]
+            invalid = data["invalid"]
+        except (json.JSONDecodeError, KeyError, TypeError) as e:
+            logger.warning(f"Failed to parse API validation result: {e}")
+            return None
+
+        editor.engine_build = engine_build
+        self._api_path_cache.add_valid(engine_build, (p for p in paths if p not in invalid))
+
+        issues = checker.build_issues(references, invalid)
+        if not issues:
+            return None
+        inspection = InspectionResult(allowed=False, issues=issues)
+        logger.info(f"Code inspection failed in editor: {len(issues)} invalid API reference(s)")
+        return {
+            "success": False,
+            "error": inspection.format_error(),
+            "inspection_issues": [i.to_dict() for i in issues],
+        }
+
+    async def _probe_imports(
+        self, import_statements: list[str], max_install_attempts: int
+    ) -> list[str]:
+        """
+        Run import statements in UE, auto-installing missing modules and retrying.
+
+        Statements already known to import in this editor session are skipped, so
+        code whose imports were all verified earlier needs no probe round trip.
+
+        Args:
+            import_statements: Import statements extracted from the code
+            max_install_attempts: Maximum number of packages to auto-install
+
+        Returns:
+            Packages that were installed
+        """
+        installed_packages: list[str] = []
+        editor = self._ctx.editor
+        if editor:
+            import_statements = editor.import_cache.unknown(import_statements)
+        if not import_statements:
+            return installed_packages
+
+        # Combine all import statements into one code block
+        import_code = "\n".join(import_statements)
+
+        attempts = 0
+        while attempts <= max_install_attempts:
+            result = await self._execute_code_impl(import_code, timeout=10.0)
+
+            if result.get("success"):
+                # All imports succeeded
+                if editor:
+                    editor.import_cache.add_good(import_statements)
+                break
+
+            # Check if it's an ImportError
+            if not is_import_error(result):
+                # Not an import error, skip pre-installation
+                break
+
+            # Extract missing module name
+            missing_module = get_missing_module_from_result(result)
+            if not missing_module:
+                logger.warning("Import error detected but could not extract module name")
+                break
+
+            # Convert to package name
+            package_name = module_to_package(missing_module)
+
+            # Prevent duplicate installation
+            if package_name in installed_packages:
+                logger.warning(f"Already attempted to install {package_name}, giving up")
+                break
+
+            # Get Python path from running editor
+            python_path = await self._get_python_path()
+
+            # Install the missing package
+            logger.info(f"Pre-installing missing package: {package_name}")
+            install_result = await asyncio.to_thread(
+                pip_install, [package_name], python_path=python_path
+            )
+
+            if not install_result.get("success", False):
+                logger.warning(f"Failed to install {package_name}: {install_result.get('error')}")
+                break
 
-    def _execute_with_checks_impl(
+            installed_packages.append(package_name)
+            self._invalidate_imports()
+            logger.info(f"Successfully pre-installed {package_name}, retrying imports...")
+            attempts += 1
+
+        return installed_packages
+
+    def _invalidate_imports(self, modules: Optional[set[str]] = None) -> None:
+        """Forget known-good imports of modules (None = all) for the current editor session."""
+        if self._ctx.editor:
+            self._ctx.editor.import_cache.invalidate(modules)
+
+    def _forget_failed_import(self, result: dict[str, Any]) -> None:
+        """Drop a module from the import cache when the code itself failed to import it."""
+        if not result.get("success") and is_import_error(result):
+            missing_module = get_missing_module_from_result(result)
+            if missing_module:
+                self._invalidate_imports({missing_module})
+
+    def _record_timings(
+        self, operation: str, result: dict[str, Any], timer: PhaseTimer, include: bool
+    ) -> dict[str, Any]:
+        """Add a call's phase timings to the rolling stats, and to the result if requested."""
+        self._latency_stats.record(operation, timer)
+        if include:
+            result["timings"] = timer.as_dict()
+        return result
+
+    async def _execute_with_checks_impl(
         self,
         code: str,
         timeout: float = 30.0,
         max_install_attempts: int = 3,
+        timer: PhaseTimer | None = None,
     ) -> dict[str, Any]:
         """
         Execute Python code with automatic missing module installation
@@ -500,14 +768,16 @@ class ExecutionManager:
             code: Python code to execute
             timeout: Execution timeout in seconds
             max_install_attempts: Maximum number of packages to auto-install
+            timer: Records the duration of each phase (see core/timings.py)
 
         Returns:
             Execution result dictionary
         """
-        installed_packages: list[str] = []
+        timer = timer or PhaseTimer()
 
         # Step 1: Extract import statements (also validates syntax)
-        import_statements, syntax_error = extract_import_statements(code)
+        with timer.phase("syntax"):
+            import_statements, syntax_error = extract_import_statements(code)
 
         # Step 2: If syntax error, return immediately
         if syntax_error:
@@ -522,7 +792,8 @@ class ExecutionManager:
         # 2. Editor-side inspection (for UnrealAPIChecker that needs unreal module)
 
         # Server-side inspection
-        inspection = inspect_code(code)
+        with timer.phase("inspection"):
+            inspection = inspect_code(code)
         if not inspection.allowed:
             return {
                 "success": False,
@@ -532,73 +803,10 @@ class ExecutionManager:
 
         # Editor-side inspection (only if editor is ready)
         if self._ctx.editor and self._ctx.editor.status == "ready":
-            logger.debug("Running editor-side code inspection for UnrealAPIChecker")
-            # Prepare code inspector execution in editor
-            # Calculate src path relative to this file
-            src_path = Path(__file__).parent.parent.parent
-
-            inspector_code = f'''
-import sys
-
-# Add src to path (absolute path, since __file__ is not available in editor)
-src_path = r"{str(src_path)}"
-if src_path not in sys.path:
-    sys.path.insert(0, src_path)
-
-from ue_mcp.validation.code_inspector import inspect_code
-
-# Inspect the user's code
-code_to_inspect = r"""
-{code.replace(chr(92), chr(92) * 2).replace('"""', chr(92) + '"""')}
-"""
-
-result = inspect_code(code_to_inspect)
-
-if not result.allowed:
-    # Return error information
-    print("CODE_INSPECTION_FAILED")
-    print(result.format_error())
-else:
-    print("CODE_INSPECTION_PASSED")
-'''
-
-            logger.debug("Inspector code prepared, executing in editor...")
-            # Execute inspector in editor
-            inspector_result = self._execute_code_impl(inspector_code, timeout=10.0)
-
-            logger.debug(f"Inspector execution result: success={inspector_result.get('success')}")
-
-            # Check inspection result
-            if inspector_result.get("success"):
-                output = inspector_result.get("output", [])
-                output_str = ""
-                if isinstance(output, list):
-                    for line in output:
-                        if isinstance(line, dict):
-                            output_str += str(line.get("output", ""))
-                        else:
-                            output_str += str(line)
-                else:
-                    output_str = str(output)
-
-                logger.debug(f"Inspector output: {output_str[:200]}")
-
-                if "CODE_INSPECTION_FAILED" in output_str:
-                    # Extract error message
-                    error_msg = output_str.split("CODE_INSPECTION_FAILED", 1)[1].strip()
-                    logger.info(f"Code inspection failed in editor: {error_msg[:200]}")
-                    return {
-                        "success": False,
-                        "error": error_msg,
-                    }
-                elif "CODE_INSPECTION_PASSED" in output_str:
-                    logger.debug("Code inspection passed in editor")
-            # If inspection execution failed or output unclear, log but continue
-            # (better to allow code execution than block it due to inspector issues)
-            elif not inspector_result.get("success"):
-                logger.warning(
-                    f"Editor-side code inspection failed to execute: {inspector_result.get('error')}"
-                )
+            with timer.phase("api_check"):
+                api_error = await self._check_unreal_api(code)
+            if api_error:
+                return api_error
         else:
             logger.debug(
                 f"Skipping editor-side inspection: editor_status="
@@ -607,195 +815,60 @@ else:
 
         # Step 3: Detect and prepare bundled module reload
         # This ensures bundled modules are reloaded to pick up latest code changes
+        unload_code = ""
         bundled_imports = extract_bundled_module_imports(code)
         if bundled_imports:
             unload_code = generate_module_unload_code(bundled_imports)
-            code = unload_code + code
+            self._invalidate_imports(bundled_imports)
             logger.debug(f"Injected unload code for bundled modules: {bundled_imports}")
 
-        # Step 3.5: Asset change tracking - Pre-execution snapshot
-        # Extract /Game/xxx/ paths from code and take a snapshot before execution
-        # Also auto-track the current level even if not explicitly referenced in code
-        pre_snapshot = None
-        pre_actor_snapshot = None
-        game_paths = extract_game_paths(code)
-        level_paths = extract_level_paths(code)
-
-        # Auto-add current level path to tracking list
-        # This ensures changes to the current level are tracked even when the code
-        # doesn't explicitly contain /Game/ path strings
-        if self._ctx.editor and self._ctx.editor.status == "ready":
-            current_level_dir = get_current_level_path(self)
-            if current_level_dir and current_level_dir not in game_paths:
-                game_paths.append(current_level_dir)
-                logger.debug(f"Asset tracking: auto-added current level {current_level_dir}")
-
-        if game_paths and self._ctx.editor and self._ctx.editor.status == "ready":
-            logger.debug(f"Asset tracking: creating pre-snapshot for paths {game_paths}")
-            pre_snapshot = create_snapshot(self, game_paths, str(self._ctx.project_root))
-            if pre_snapshot:
-                logger.debug(
-                    f"Asset tracking: pre-snapshot captured "
-                    f"{len(pre_snapshot.get('assets', {}))} assets"
-                )
+        # Step 3.5: Probe imports in UE, installing missing modules
+        with timer.phase("import_probe"):
+            installed_packages = await self._probe_imports(import_statements, max_install_attempts)
 
-        # Also create actor snapshot for OFPA mode support
-        # Pass level_paths to track actors in referenced levels too
+        # Step 4: Execute the code. With a ready editor it is wrapped between the
+        # pre- and post-execution tracking captures, all in one request
+        tracked = None
         if self._ctx.editor and self._ctx.editor.status == "ready":
-            pre_actor_snapshot = create_level_actor_snapshot(self, level_paths)
-            if pre_actor_snapshot:
-                levels_count = len(pre_actor_snapshot.get("levels", {}))
-                total_actors = sum(
-                    level.get("actor_count", 0)
-                    for level in pre_actor_snapshot.get("levels", {}).values()
-                )
-                logger.debug(
-                    f"Actor tracking: pre-snapshot captured {total_actors} actors "
-                    f"across {levels_count} level(s)"
-                )
-
-        if import_statements:
-            # Combine all import statements into one code block
-            import_code = "\n".join(import_statements)
-
-            # Step 3: Try executing imports, install missing modules and retry
-            attempts = 0
-            while attempts <= max_install_attempts:
-                result = self._execute_code_impl(import_code, timeout=10.0)
-
-                if result.get("success"):
-                    # All imports succeeded
-                    break
-
-                # Check if it's an ImportError
-                if not is_import_error(result):
-                    # Not an import error, skip pre-installation
-                    break
-
-                # Extract missing module name
-                missing_module = get_missing_module_from_result(result)
-                if not missing_module:
-                    logger.warning("Import error detected but could not extract module name")
-                    break
-
-                # Convert to package name
-                package_name = module_to_package(missing_module)
-
-                # Prevent duplicate installation
-                if package_name in installed_packages:
-                    logger.warning(f"Already attempted to install {package_name}, giving up")
-                    break
-
-                # Get Python path from running editor
-                python_path = self._get_python_path()
-
-                # Install the missing package
-                logger.info(f"Pre-installing missing package: {package_name}")
-                install_result = pip_install([package_name], python_path=python_path)
-
-                if not install_result.get("success", False):
-                    logger.warning(
-                        f"Failed to install {package_name}: {install_result.get('error')}"
-                    )
-                    break
-
-                installed_packages.append(package_name)
-                logger.info(f"Successfully pre-installed {package_name}, retrying imports...")
-                attempts += 1
-
-        # Step 4: Execute the full code
-        result = self._execute_code_impl(code, timeout=timeout)
-
-        # Add installation info
-        if installed_packages:
-            result["auto_installed"] = installed_packages
-
-        # Step 5: Asset change tracking - Post-execution snapshot and comparison
-        # asset_changes is a simple list of paths of changed assets
-        changed_paths: set[str] = set()
-        temp_level_warning: str | None = None
-
-        if pre_snapshot is not None and result.get("success"):
-            try:
-                post_snapshot = create_snapshot(self, game_paths, str(self._ctx.project_root))
-                if post_snapshot:
-                    snapshot_changes = compare_snapshots(pre_snapshot, post_snapshot)
-                    if snapshot_changes:
-                        changed_paths.update(snapshot_changes)
-                        logger.debug(f"Asset tracking: detected {len(snapshot_changes)} changed assets")
-                    else:
-                        logger.debug("Asset tracking: no changes detected")
-            except Exception as e:
-                logger.warning(f"Asset tracking failed: {e}")
-
-        # Actor-based change tracking for OFPA mode
-        # When actors change, add the level to asset_changes
-        if pre_actor_snapshot is not None and result.get("success"):
-            try:
-                post_actor_snapshot = create_level_actor_snapshot(self, level_paths)
-                if post_actor_snapshot:
-                    # compare_level_actor_snapshots now returns {level_path: [changed_actors]}
-                    actor_changes = compare_level_actor_snapshots(
-                        pre_actor_snapshot, post_actor_snapshot
-                    )
-
-                    if actor_changes:
-                        for level_path, changed_actors in actor_changes.items():
-                            logger.info(
-                                f"Actor tracking: detected {len(changed_actors)} changes in {level_path}"
-                            )
-
-                            # Add temp level warning if applicable
-                            if level_path.startswith("/Temp/"):
-                                temp_level_warning = (
-                                    f"Changes detected in temporary level '{level_path}'. "
-                                    "This level is not saved. If you intended to modify a "
-                                    "persistent level, please load it first using editor_load_level."
-                                )
-                                logger.warning(f"Actor changes in temporary level: {level_path}")
-
-                            # level_path is already in asset path format from compare function
-                            changed_paths.add(level_path)
-                            logger.debug(
-                                f"Added level {level_path} to changed paths via actor tracking"
-                            )
-                    else:
-                        logger.debug("Actor tracking: no changes detected")
-            except Exception as e:
-                logger.warning(f"Actor tracking failed: {e}")
-
-        # Include asset_changes if there are any changed paths
-        if changed_paths:
-            result["asset_changes"] = sorted(changed_paths)
-        if temp_level_warning:
-            result["temp_level_warning"] = temp_level_warning
-
-        # Step 6: Get dirty asset paths
-        dirty_paths: list[str] = []
-        if result.get("success"):
-            try:
-                dirty_paths = get_dirty_asset_paths(self)
-                if dirty_paths:
-                    result["dirty_assets"] = dirty_paths
-                    logger.debug(f"Dirty assets: {dirty_paths}")
-            except Exception as e:
-                logger.warning(f"Failed to get dirty asset paths: {e}")
+            tracked = TrackedExecution()
+            request_code = build_tracked_code(
+                code,
+                extract_game_paths(code),
+                str(self._ctx.project_root),
+                tracked,
+                prelude=unload_code,
+            )
+        else:
+            request_code = unload_code + code
 
-        # Step 7: Refresh Slate UI if changes were detected
-        if result.get("success") and (changed_paths or dirty_paths):
-            try:
-                refresh_result = self._execute_code_impl(
-                    "import unreal; unreal.ExSlateTabLibrary.refresh_slate_view()",
-                    timeout=5.0,
-                )
-                if refresh_result.get("success"):
-                    logger.debug("Refreshed Slate UI after detected changes")
-            except Exception as e:
-                logger.debug(f"RefreshSlateView failed (non-critical): {e}")
+        try:
+            with timer.phase("execution"):
+                result = await self._execute_code_impl(request_code, timeout=timeout)
+            self._forget_failed_import(result)
+
+            # Add installation info
+            if installed_packages:
+                result["auto_installed"] = installed_packages
+
+            # Step 5: Report asset/actor changes, dirty assets, refresh Slate UI
+            if tracked is not None and result.get("success"):
+                states = tracked.take()
+                if states:
+                    # The captures ran inside the execution request
+                    timer.split("execution", states.get("timings") or {})
+                    # A single expression's value (the repr the statement path returns)
+                    if "value" in states:
+                        result["result"] = states["value"]
+                    await self._apply_tracking_changes(result, states["pre"], states["post"], timer)
+                else:
+                    logger.debug("Execution tracking: no tracking result written")
+        finally:
+            if tracked is not None:
+                tracked.cleanup()
 
         return result
 
-    def _execute_script_with_checks_impl(
+    async def _execute_script_with_checks_impl(
         self,
         script_path: str,
         timeout: float = 120.0,
@@ -803,6 +876,8 @@ else:
         wait_for_latent: bool = True,
         latent_timeout: float = 60.0,
         max_install_attempts: int = 3,
+        timer: PhaseTimer | None = None,
+        notify: "NotifyCallback | None" = None,
     ) -> dict[str, Any]:
         """
         Execute a Python script file with validation and tracking (internal implementation).
@@ -822,10 +897,13 @@ else:
             wait_for_latent: Whether to wait for latent commands to complete
             latent_timeout: Max time to wait for latent commands
             max_install_attempts: Maximum number of packages to auto-install
+            timer: Records the duration of each phase (see core/timings.py)
+            notify: Optional callback receiving the script's output lines as they appear
 
         Returns:
             Execution result with asset_changes, dirty_assets, etc.
         """
+        timer = timer or PhaseTimer()
         path = Path(script_path)
         if not path.exists():
             return {"success": False, "error": f"Script not found: {script_path}"}
@@ -837,14 +915,14 @@ else:
             return {"success": False, "error": f"Failed to read script: {e}"}
 
         # Step 2: Syntax validation via import extraction
-        import_statements, syntax_error = extract_import_statements(code)
+        with timer.phase("syntax"):
+            import_statements, syntax_error = extract_import_statements(code)
         if syntax_error:
             return {"success": False, "error": syntax_error}
 
-        installed_packages: list[str] = []
-
         # Step 3a: Server-side code inspection (runs locally, no editor required)
-        inspection = inspect_code(code)
+        with timer.phase("inspection"):
+            inspection = inspect_code(code)
         if not inspection.allowed:
             return {
                 "success": False,
@@ -854,214 +932,126 @@ else:
 
         # Step 3b: Editor-side code inspection (runs in UE, requires editor)
         if self._ctx.editor and self._ctx.editor.status == "ready":
-            # Pre-escape the code to avoid backslash in f-string expression
-            escaped_code = code.replace('"', '\\"')
-            inspector_code = f'''
-import sys
-if "unreal_api_checker" in sys.modules:
-    del sys.modules["unreal_api_checker"]
-try:
-    import unreal_api_checker
-    result = unreal_api_checker.check_code("""{escaped_code}""")
-    if not result["valid"]:
-        print("CODE_INSPECTION_FAILED " + "; ".join(result.get("errors", [])))
-    else:
-        print("CODE_INSPECTION_PASSED")
-except ImportError:
-    print("CODE_INSPECTION_PASSED")
-except Exception as e:
-    print(f"CODE_INSPECTION_ERROR {{e}}")
-'''
-            inspector_result = self._execute_code_impl(inspector_code, timeout=10.0)
-
-            if inspector_result.get("success"):
-                output_lines = inspector_result.get("output", [])
-                output_str = " ".join(
-                    str(line.get("output", "")) if isinstance(line, dict) else str(line)
-                    for line in output_lines
-                )
-
-                if "CODE_INSPECTION_FAILED" in output_str:
-                    error_msg = output_str.split("CODE_INSPECTION_FAILED", 1)[1].strip()
-                    return {
-                        "success": False,
-                        "error": error_msg,
-                    }
+            with timer.phase("api_check"):
+                api_error = await self._check_unreal_api(code)
+            if api_error:
+                return api_error
 
         # Step 4: Bundled module reload (execute separately since we can't modify script)
         bundled_imports = extract_bundled_module_imports(code)
         if bundled_imports:
             unload_code = generate_module_unload_code(bundled_imports)
-            self._execute_code_impl(unload_code, timeout=5.0)
+            with timer.phase("module_unload"):
+                await self._execute_code_impl(unload_code, timeout=5.0)
+            self._invalidate_imports(bundled_imports)
             logger.debug(f"Executed unload code for bundled modules: {bundled_imports}")
 
-        # Step 5: Pre-execution tracking snapshots
-        pre_snapshot = None
-        pre_actor_snapshot = None
-        game_paths = extract_game_paths(code)
-        level_paths = extract_level_paths(code)
-
-        # Auto-add current level path to tracking list
+        # Step 5: Pre-execution tracking capture (one request)
+        tracked = None
+        pre_state = None
         if self._ctx.editor and self._ctx.editor.status == "ready":
-            current_level_dir = get_current_level_path(self)
-            if current_level_dir and current_level_dir not in game_paths:
-                game_paths.append(current_level_dir)
-                logger.debug(f"Asset tracking: auto-added current level {current_level_dir}")
-
-        if game_paths and self._ctx.editor and self._ctx.editor.status == "ready":
-            logger.debug(f"Asset tracking: creating pre-snapshot for paths {game_paths}")
-            pre_snapshot = create_snapshot(self, game_paths, str(self._ctx.project_root))
-            if pre_snapshot:
-                logger.debug(
-                    f"Asset tracking: pre-snapshot captured "
-                    f"{len(pre_snapshot.get('assets', {}))} assets"
+            tracked = TrackedExecution()
+            with timer.phase("pre_capture"):
+                pre_state = await capture_pre_execution(
+                    self, extract_game_paths(code), str(self._ctx.project_root), tracked
                 )
 
-        # Actor snapshot for OFPA mode support
-        if self._ctx.editor and self._ctx.editor.status == "ready":
-            pre_actor_snapshot = create_level_actor_snapshot(self, level_paths)
-            if pre_actor_snapshot:
-                levels_count = len(pre_actor_snapshot.get("levels", {}))
-                total_actors = sum(
-                    level.get("actor_count", 0)
-                    for level in pre_actor_snapshot.get("levels", {}).values()
-                )
-                logger.debug(
-                    f"Actor tracking: pre-snapshot captured {total_actors} actors "
-                    f"across {levels_count} level(s)"
+        try:
+            # Step 6: Import handling with auto-install
+            with timer.phase("import_probe"):
+                installed_packages = await self._probe_imports(
+                    import_statements, max_install_attempts
                 )
 
-        # Step 6: Import handling with auto-install
-        if import_statements:
-            import_code = "\n".join(import_statements)
-            attempts = 0
-            while attempts <= max_install_attempts:
-                result = self._execute_code_impl(import_code, timeout=10.0)
-
-                if result.get("success"):
-                    break
-
-                if not is_import_error(result):
-                    break
-
-                missing_module = get_missing_module_from_result(result)
-                if not missing_module:
-                    logger.warning("Import error detected but could not extract module name")
-                    break
-
-                package_name = module_to_package(missing_module)
-                if package_name in installed_packages:
-                    logger.warning(f"Already attempted to install {package_name}, giving up")
-                    break
+            # Step 7: Execute the script file
+            with timer.phase("execution"):
+                result = await self._execute_script_impl(
+                    script_path,
+                    timeout=timeout,
+                    output_file=output_file,
+                    wait_for_latent=wait_for_latent,
+                    latent_timeout=latent_timeout,
+                    notify=notify,
+                )
+            self._forget_failed_import(result)
 
-                python_path = self._get_python_path()
-                logger.info(f"Pre-installing missing package: {package_name}")
-                install_result = pip_install([package_name], python_path=python_path)
+            # Add installation info
+            if installed_packages:
+                result["auto_installed"] = installed_packages
 
-                if not install_result.get("success", False):
-                    logger.warning(
-                        f"Failed to install {package_name}: {install_result.get('error')}"
+            # Step 8: Post-execution tracking capture (one request) and change report
+            if pre_state is not None and result.get("success"):
+                with timer.phase("post_capture"):
+                    post_state = await capture_post_execution(
+                        self, pre_state, str(self._ctx.project_root), tracked
                     )
-                    break
-
-                installed_packages.append(package_name)
-                logger.info(f"Successfully pre-installed {package_name}, retrying imports...")
-                attempts += 1
-
-        # Step 7: Execute the script file
-        result = self._execute_script_impl(
-            script_path,
-            timeout=timeout,
-            output_file=output_file,
-            wait_for_latent=wait_for_latent,
-            latent_timeout=latent_timeout,
-        )
-
-        # Add installation info
-        if installed_packages:
-            result["auto_installed"] = installed_packages
+                if post_state is not None:
+                    await self._apply_tracking_changes(result, pre_state, post_state, timer)
+        finally:
+            if tracked is not None:
+                tracked.cleanup()
 
-        # Step 8: Post-execution tracking
-        changed_paths: set[str] = set()
-        temp_level_warning: str | None = None
+        return result
 
-        if pre_snapshot is not None and result.get("success"):
-            try:
-                post_snapshot = create_snapshot(self, game_paths, str(self._ctx.project_root))
-                if post_snapshot:
-                    snapshot_changes = compare_snapshots(pre_snapshot, post_snapshot)
-                    if snapshot_changes:
-                        changed_paths.update(snapshot_changes)
-                        logger.debug(f"Asset tracking: detected {len(snapshot_changes)} changed assets")
-                    else:
-                        logger.debug("Asset tracking: no changes detected")
-            except Exception as e:
-                logger.warning(f"Asset tracking failed: {e}")
+    async def _apply_tracking_changes(
+        self,
+        result: dict[str, Any],
+        pre: dict[str, Any],
+        post: dict[str, Any],
+        timer: PhaseTimer,
+    ) -> None:
+        """
+        Add asset_changes, temp_level_warning and dirty_assets from a tracking
+        state pair to an execution result, and refresh the Slate UI if the editor
+        did not already.
+        """
+        try:
+            with timer.phase("diff"):
+                changes = compute_changes(pre, post)
+        except Exception as e:
+            logger.warning(f"Execution tracking failed: {e}")
+            return
 
-        # Actor-based change tracking for OFPA mode
-        if pre_actor_snapshot is not None and result.get("success"):
-            try:
-                post_actor_snapshot = create_level_actor_snapshot(self, level_paths)
-                if post_actor_snapshot:
-                    actor_changes = compare_level_actor_snapshots(
-                        pre_actor_snapshot, post_actor_snapshot
-                    )
+        # asset_changes is a simple list of paths of changed assets
+        changed_paths: set[str] = set(changes.asset_changes)
+        if changes.asset_changes:
+            logger.debug(f"Asset tracking: detected {len(changes.asset_changes)} changed assets")
 
-                    if actor_changes:
-                        for level_path, changed_actors in actor_changes.items():
-                            logger.info(
-                                f"Actor tracking: detected {len(changed_actors)} changes in {level_path}"
-                            )
-
-                            if level_path.startswith("/Temp/"):
-                                temp_level_warning = (
-                                    f"Changes detected in temporary level '{level_path}'. "
-                                    "This level is not saved. If you intended to modify a "
-                                    "persistent level, please load it first using editor_load_level."
-                                )
-                                logger.warning(f"Actor changes in temporary level: {level_path}")
-
-                            changed_paths.add(level_path)
-                            logger.debug(
-                                f"Added level {level_path} to changed paths via actor tracking"
-                            )
-                    else:
-                        logger.debug("Actor tracking: no changes detected")
-            except Exception as e:
-                logger.warning(f"Actor tracking failed: {e}")
+        # Actor-based change tracking for OFPA mode: when actors change, add the level
+        temp_level_warning: str | None = None
+        for level_path, changed_actors in changes.actor_changes.items():
+            logger.info(f"Actor tracking: detected {len(changed_actors)} changes in {level_path}")
+            if level_path.startswith("/Temp/"):
+                temp_level_warning = (
+                    f"Changes detected in temporary level '{level_path}'. "
+                    "This level is not saved. If you intended to modify a "
+                    "persistent level, please load it first using editor_load_level."
+                )
+                logger.warning(f"Actor changes in temporary level: {level_path}")
+            changed_paths.add(level_path)
 
-        # Include asset_changes if there are any changed paths
         if changed_paths:
             result["asset_changes"] = sorted(changed_paths)
         if temp_level_warning:
             result["temp_level_warning"] = temp_level_warning
+        if changes.dirty_assets:
+            result["dirty_assets"] = changes.dirty_assets
+            logger.debug(f"Dirty assets: {changes.dirty_assets}")
 
-        # Get dirty asset paths
-        dirty_paths: list[str] = []
-        if result.get("success"):
-            try:
-                dirty_paths = get_dirty_asset_paths(self)
-                if dirty_paths:
-                    result["dirty_assets"] = dirty_paths
-                    logger.debug(f"Dirty assets: {dirty_paths}")
-            except Exception as e:
-                logger.warning(f"Failed to get dirty asset paths: {e}")
-
-        # Refresh Slate UI if changes were detected
-        if result.get("success") and (changed_paths or dirty_paths):
+        # Refresh Slate UI if changes were detected and the editor did not already
+        if (changed_paths or changes.dirty_assets) and not changes.refreshed:
             try:
-                refresh_result = self._execute_code_impl(
-                    "import unreal; unreal.ExSlateTabLibrary.refresh_slate_view()",
-                    timeout=5.0,
-                )
+                with timer.phase("refresh"):
+                    refresh_result = await self._execute_code_impl(
+                        "import unreal; unreal.ExSlateTabLibrary.refresh_slate_view()",
+                        timeout=5.0,
+                    )
                 if refresh_result.get("success"):
                     logger.debug("Refreshed Slate UI after detected changes")
             except Exception as e:
                 logger.debug(f"RefreshSlateView failed (non-critical): {e}")
 
-        return result
-
-    def _pip_install_impl(
+    async def _pip_install_impl(
         self,
         packages: list[str],
         upgrade: bool = False,
@@ -1076,33 +1066,95 @@ except Exception as e:
         Returns:
             Installation result dictionary
         """
-        python_path = self._get_python_path()
-        return pip_install(packages, python_path=python_path, upgrade=upgrade)
+        python_path = await self._get_python_path()
+        result = await asyncio.to_thread(
+            pip_install, packages, python_path=python_path, upgrade=upgrade
+        )
+        if result.get("success"):
+            self._invalidate_imports()
+        return result
 
     # =========================================================================
     # PRIVATE HELPER METHODS
     # =========================================================================
 
     async def _ensure_editor_ready(
-        self, notify: "NotifyCallback | None" = None
+        self,
+        notify: "NotifyCallback | None" = None,
+        needs_rendering: bool | None = None,
     ) -> dict[str, Any] | None:
         """
         Ensure editor is running and ready, auto-launching if needed.
 
         This method checks if the editor is running and ready. If not, it
-        automatically launches the editor using the configured LaunchManager.
+        automatically launches the editor using the configured LaunchManager,
+        which picks the launch profile from needs_rendering: tasks that render
+        nothing get a headless (-nullrhi) editor.
 
         Args:
             notify: Optional callback for launch progress notifications
+            needs_rendering: Whether the task needs rendered pixels (True), only
+                transforms and script output (False), or does not say (None).
+                A headless editor the server auto-launched is relaunched for tasks
+                that need rendering, unless it has unsaved packages.
 
         Returns:
             None if editor is ready (caller should proceed with execution).
             Error dict if auto-launch failed or LaunchManager not configured.
         """
+
+        async def default_notify(level: str, message: str) -> None:
+            logger.info(f"[AUTO-LAUNCH] {level}: {message}")
+
+        actual_notify = notify or default_notify
+
         # Check if editor is already ready
         if self._ctx.editor is not None and self._ctx.editor.status == "ready":
-            return None  # Editor ready, proceed
-        
+            if not (needs_rendering and self._ctx.editor.headless):
+                return None  # Editor ready, proceed
+            # Only an editor the server auto-launched is relaunched behind the user's back
+            if self._launch_manager is None or not self._ctx.editor.auto_launched:
+                return {
+                    "success": False,
+                    "error": "Editor is running headless (-nullrhi) and cannot render. "
+                    "Relaunch it with editor_launch(headless=False).",
+                }
+
+            # -unattended suppresses the save prompt on quit: never drop unsaved edits
+            dirty = await get_dirty_asset_paths(self)
+            if dirty is None:
+                return {
+                    "success": False,
+                    "error": "Editor is running headless (-nullrhi) and cannot render, and its "
+                    "unsaved packages could not be checked, so it was not relaunched. "
+                    "Save your work and relaunch it with editor_launch(headless=False).",
+                }
+            if dirty:
+                shown = ", ".join(dirty[:10]) + (", ..." if len(dirty) > 10 else "")
+                return {
+                    "success": False,
+                    "error": "Editor is running headless (-nullrhi) and cannot render. It was "
+                    f"not relaunched because {len(dirty)} package(s) have unsaved changes: "
+                    f"{shown}. Save them (e.g. unreal.EditorLoadingAndSavingUtils."
+                    "save_dirty_packages(True, True)) and retry.",
+                    "dirty_packages": dirty,
+                }
+
+            logger.info("Headless editor running, relaunching with rendering...")
+            await actual_notify(
+                "info", "Editor is running headless; relaunching it with rendering enabled..."
+            )
+            launch_result = await self._launch_manager.relaunch(
+                notify=actual_notify, headless=False, wait_timeout=120.0
+            )
+            if not launch_result.get("success"):
+                return {
+                    "success": False,
+                    "error": f"Relaunch with rendering failed: {launch_result.get('error', 'Unknown error')}",
+                    "launch_result": launch_result,
+                }
+            return None
+
         # Check if editor stopped due to crash
         if self._ctx.editor is not None and self._ctx.editor.status == "stopped":
             if self._ctx.editor.log_file_path:
@@ -1121,17 +1173,19 @@ except Exception as e:
             }
 
         # Auto-launch the editor
-        logger.info("Editor not running, auto-launching...")
-
-        async def default_notify(level: str, message: str) -> None:
-            logger.info(f"[AUTO-LAUNCH] {level}: {message}")
-
-        actual_notify = notify or default_notify
-        await actual_notify("info", "Auto-launching Unreal Editor...")
+        headless = self._launch_manager.choose_headless(needs_rendering)
+        logger.info(f"Editor not running, auto-launching{' headless' if headless else ''}...")
+        await actual_notify(
+            "info",
+            "Auto-launching Unreal Editor (headless, rendering disabled)..."
+            if headless
+            else "Auto-launching Unreal Editor...",
+        )
 
         launch_result = await self._launch_manager.launch(
             notify=actual_notify,
             wait_timeout=120.0,
+            headless=headless,
         )
 
         if not launch_result.get("success"):
@@ -1153,10 +1207,12 @@ except Exception as e:
                 "launch_result": launch_result,
             }
 
+        if self._ctx.editor is not None:
+            self._ctx.editor.auto_launched = True
         await actual_notify("info", "Editor auto-launched successfully")
         return None  # Editor now ready
 
-    def _wait_for_latent_commands(
+    async def _wait_for_latent_commands(
         self, timeout: float = 60.0, poll_interval: float = 5.0
     ) -> dict[str, Any]:
         """Wait for latent commands to complete.
@@ -1187,7 +1243,7 @@ except Exception as e:
                 return {"completed": False, "timed_out": True, "elapsed": elapsed}
 
             # Check if latent commands are still running
-            check_result = self._execute_code_impl(check_code, timeout=5.0)
+            check_result = await self._execute_code_impl(check_code, timeout=5.0)
 
             if not check_result.get("success"):
                 # If check fails, assume no latent commands (or API not available)
@@ -1209,7 +1265,7 @@ except Exception as e:
                 return {"completed": True, "timed_out": False, "elapsed": elapsed}
 
             # Still running, wait and check again
-            time.sleep(poll_interval)
+            await asyncio.sleep(poll_interval)
 
     def _script_has_latent_commands(self, script_path: str) -> bool:
         """Check if a script file contains latent command definitions.
@@ -1253,11 +1309,31 @@ except Exception as e:
             # If we can't read the file, assume it might have latent commands
             return True
 
-    def _read_captured_output_file(self, output_file: str) -> str | None:
+    async def _start_output_capture(self) -> str | None:
+        """Tee the editor's stdout/stderr into a new temp file.
+
+        Returns:
+            Path of the capture file, or None if capture could not be set up
+        """
+        output_file = str(Path(tempfile.gettempdir()) / f"ue_mcp_output_{uuid.uuid4().hex[:8]}.txt")
+        result = await self._execute_code_impl(build_output_capture_code(output_file), timeout=5.0)
+        if not result.get("success"):
+            logger.debug(f"Output capture not set up: {result.get('error')}")
+            Path(output_file).unlink(missing_ok=True)
+            return None
+        return output_file
+
+    def _read_captured_output_file(
+        self, output_file: str, max_bytes: int = MAX_CAPTURED_OUTPUT_BYTES
+    ) -> str | None:
         """Read captured output from temp file.
 
+        Only the last max_bytes are read; the omitted head is replaced by a note
+        (it was streamed to the client if the execution had a notify callback).
+
         Args:
             output_file: Path to the temp file containing captured output
+            max_bytes: Maximum number of bytes of output to return
 
         Returns:
             File contents as string, or None if file doesn't exist or is empty
@@ -1265,7 +1341,19 @@ except Exception as e:
         try:
             path = Path(output_file)
             if path.exists():
-                content = path.read_text(encoding="utf-8")
+                size = path.stat().st_size
+                with open(path, "rb") as f:
+                    if size > max_bytes:
+                        f.seek(size - max_bytes)
+                    data = f.read(max_bytes)
+                omitted = 0
+                if size > max_bytes:
+                    # Drop the line cut by the seek
+                    data = data.partition(b"\n")[2]
+                    omitted = size - len(data)
+                content = data.decode("utf-8", errors="replace")
+                if omitted:
+                    content = f"[INFO] ... {omitted} bytes of earlier output omitted ...\n{content}"
                 if content.strip():
                     return content
         except Exception as e:
@@ -1307,7 +1395,7 @@ except Exception as e:
 
         return "\n".join(formatted_lines)
 
-    def _get_python_path(self) -> Optional[Path]:
+    async def _get_python_path(self) -> Optional[Path]:
         """
         Get Python interpreter path from the running editor.
 
@@ -1315,7 +1403,7 @@ except Exception as e:
             Path to Python interpreter, or None if failed
         """
         try:
-            result = self._execute_code_impl(
+            result = await self._execute_code_impl(
                 "import unreal; print(unreal.get_interpreter_executable_path())", timeout=5.0
             )
             if result.get("success") and result.get("output"):
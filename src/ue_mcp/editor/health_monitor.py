@@ -156,9 +156,11 @@ class HealthMonitor:
                         except Exception as e:
                             logger.error(f"Failed to send exit notification: {e}")
 
-                    # Clean up remote client connection
-                    if self._ctx.editor and self._ctx.editor.remote_client:
-                        self._ctx.editor.remote_client._cleanup_sockets()
+                    # Clean up remote client connection and the dead process's endpoint
+                    if self._ctx.editor:
+                        if self._ctx.editor.remote_client:
+                            self._ctx.editor.remote_client._cleanup_sockets()
+                        self._ctx.endpoint_cache.forget(self._ctx.editor.process.pid)
 
                     # Exit monitor loop - no auto-restart
                     break
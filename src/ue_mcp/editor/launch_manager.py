@@ -15,8 +15,8 @@ from datetime import datetime
 from pathlib import Path
 from typing import TYPE_CHECKING, Any, Optional
 
+from ..async_remote_client import AsyncRemoteExecutionClient
 from ..autoconfig import run_config_check
-from ..remote_client import RemoteExecutionClient
 from ..core.utils import find_ue5_editor_for_project
 from .types import EditorInstance, NotifyCallback
 
@@ -28,6 +28,10 @@ if TYPE_CHECKING:
 
 logger = logging.getLogger(__name__)
 
+# Extra editor arguments of the headless launch profile: rendering disabled (no GPU
+# needed), no crash report UI, splash screen or audio device
+HEADLESS_LAUNCH_ARGS = ["-nullrhi", "-unattended", "-nosplash", "-nosound"]
+
 
 class LaunchManager:
     """
@@ -58,7 +62,68 @@ class LaunchManager:
         self._health_monitor = health_monitor
         self._build_manager = build_manager
 
-    def _try_connect(self) -> bool:
+    @staticmethod
+    def choose_headless(needs_rendering: Optional[bool]) -> bool:
+        """
+        Pick the launch profile for an editor auto-launched on behalf of a task.
+
+        Tasks that only need transforms and script output (needs_rendering=False)
+        get the headless profile; visual tasks and tasks that did not say (None)
+        get a rendering editor.
+
+        Args:
+            needs_rendering: Whether the task needs rendered pixels, or None if unknown
+
+        Returns:
+            True to launch headless
+        """
+        return needs_rendering is False
+
+    @staticmethod
+    def build_command_line(
+        editor_path: Path,
+        project_path: Path,
+        log_file_path: Path,
+        multicast_port: int,
+        unattended: bool = False,
+        headless: bool = False,
+    ) -> list[str]:
+        """
+        Build the editor command line.
+
+        Args:
+            editor_path: Editor executable
+            project_path: .uproject file
+            log_file_path: Engine log file (-ABSLOG)
+            multicast_port: Remote execution multicast port for this instance
+            unattended: Whether to pass -unattended
+            headless: Whether to add HEADLESS_LAUNCH_ARGS (implies unattended)
+
+        Returns:
+            Command line arguments
+        """
+        # Build command line override for multicast port
+        # FIPv4Endpoint expects "IP:Port" string format
+        ini_override = (
+            f"-ini:Engine:[/Script/PythonScriptPlugin.PythonScriptPluginSettings]:"
+            f"RemoteExecutionMulticastGroupEndpoint=239.0.0.1:{multicast_port}"
+        )
+
+        cmd_args = [
+            str(editor_path),
+            str(project_path),
+            f"-ABSLOG={log_file_path}",
+            ini_override,
+            "-AutoDeclinePackageRecovery",  # Skip package recovery dialogs on startup
+            "-NoLiveCoding",  # Disable Live Coding to allow builds while editor is running
+        ]
+        if headless:
+            cmd_args.extend(HEADLESS_LAUNCH_ARGS)
+        elif unattended:
+            cmd_args.append("-unattended")  # Skip crash report UI
+        return cmd_args
+
+    async def _try_connect(self) -> bool:
         """
         Try to connect to the editor's remote execution.
 
@@ -68,17 +133,18 @@ class LaunchManager:
         if self._ctx.editor is None:
             return False
 
-        remote_client = RemoteExecutionClient(
+        remote_client = AsyncRemoteExecutionClient(
             project_name=self._ctx.project_name,
             expected_pid=self._ctx.editor.process.pid,  # Pass PID for verification
             multicast_group=("239.0.0.1", self._ctx.editor.multicast_port),
         )
 
         # Use find_and_verify_instance which handles multiple instances
-        if remote_client.find_and_verify_instance(timeout=2.0):
+        if await remote_client.find_and_verify_instance(timeout=2.0):
             self._ctx.editor.node_id = remote_client.get_node_id()
             self._ctx.editor.remote_client = remote_client
             self._ctx.editor.status = "ready"
+            self._ctx.remember_endpoint()
             logger.info(f"Connected to editor (node_id: {self._ctx.editor.node_id})")
             return True
 
@@ -90,6 +156,7 @@ class LaunchManager:
         additional_paths: Optional[list[str]] = None,
         wait_timeout: float = 120.0,
         unattended: bool = False,
+        headless: bool = False,
     ) -> Any:
         """
         Shared preparation logic for launching the editor.
@@ -168,7 +235,7 @@ class LaunchManager:
         allocated_port = find_available_port()
         logger.info(f"Allocated multicast port: {allocated_port}")
 
-        logger.info(f"Launching editor: {editor_path}")
+        logger.info(f"Launching editor{' (headless)' if headless else ''}: {editor_path}")
         logger.info(f"Project: {self._ctx.project_path}")
 
         # Generate log file path for engine logs (includes project name and timestamp)
@@ -186,24 +253,15 @@ class LaunchManager:
             if sys.platform == "win32":
                 creationflags = subprocess.DETACHED_PROCESS | subprocess.CREATE_NEW_PROCESS_GROUP
 
-            # Build command line override for multicast port
-            # FIPv4Endpoint expects "IP:Port" string format
-            ini_override = (
-                f"-ini:Engine:[/Script/PythonScriptPlugin.PythonScriptPluginSettings]:"
-                f"RemoteExecutionMulticastGroupEndpoint=239.0.0.1:{allocated_port}"
+            cmd_args = self.build_command_line(
+                editor_path,
+                self._ctx.project_path,
+                log_file_path,
+                allocated_port,
+                unattended=unattended,
+                headless=headless,
             )
 
-            cmd_args = [
-                str(editor_path),
-                str(self._ctx.project_path),
-                f"-ABSLOG={log_file_path}",
-                ini_override,
-                "-AutoDeclinePackageRecovery",  # Skip package recovery dialogs on startup
-                "-NoLiveCoding",  # Disable Live Coding to allow builds while editor is running
-            ]
-            if unattended:
-                cmd_args.append("-unattended")  # Skip crash report UI
-
             process = subprocess.Popen(
                 cmd_args,
                 stdout=subprocess.DEVNULL,
@@ -227,6 +285,7 @@ class LaunchManager:
             wait_timeout=wait_timeout,
             multicast_port=allocated_port,
             unattended=unattended,
+            headless=headless,
         )
         logger.info(f"Editor process started (PID: {process.pid})")
         return process, config_result
@@ -237,6 +296,7 @@ class LaunchManager:
         additional_paths: Optional[list[str]] = None,
         wait_timeout: float = 120.0,
         unattended: bool = False,
+        headless: bool = False,
     ) -> dict[str, Any]:
         """
         Internal launch implementation shared by launch() and launch_async().
@@ -246,6 +306,7 @@ class LaunchManager:
             additional_paths: Optional list of additional Python paths
             wait_timeout: Maximum time to wait for editor connection
             unattended: Whether to pass -unattended flag to editor
+            headless: Whether to launch with rendering disabled (-nullrhi)
 
         Returns:
             Launch result dictionary
@@ -259,7 +320,9 @@ class LaunchManager:
 
         actual_notify = notify or null_notify
 
-        prep_result = await self._prepare_launch(actual_notify, additional_paths, wait_timeout, unattended)
+        prep_result = await self._prepare_launch(
+            actual_notify, additional_paths, wait_timeout, unattended, headless
+        )
         if isinstance(prep_result, dict):
             return prep_result
 
@@ -283,6 +346,7 @@ class LaunchManager:
         additional_paths: Optional[list[str]] = None,
         wait_timeout: float = 120.0,
         unattended: bool = False,
+        headless: bool = False,
     ) -> dict[str, Any]:
         """
         Launch Unreal Editor and wait for connection (synchronous startup).
@@ -292,6 +356,7 @@ class LaunchManager:
             additional_paths: Optional list of additional Python paths
             wait_timeout: Maximum time to wait for editor connection
             unattended: Whether to pass -unattended flag to editor
+            headless: Whether to launch with rendering disabled (-nullrhi)
 
         Returns:
             Launch result dictionary
@@ -301,14 +366,67 @@ class LaunchManager:
             additional_paths=additional_paths,
             wait_timeout=wait_timeout,
             unattended=unattended,
+            headless=headless,
         )
 
+    async def relaunch(
+        self,
+        notify: NotifyCallback,
+        headless: bool,
+        wait_timeout: float = 120.0,
+    ) -> dict[str, Any]:
+        """
+        Stop the managed editor and launch it again with another launch profile.
+
+        Used when a visual task arrives while a headless editor is running. Only an
+        editor the server auto-launched headless is relaunched; one started with
+        editor_launch is left to the user. The previous launch's additional paths
+        and unattended flag are kept. The editor quits without a save prompt, so
+        the caller must make sure it has no unsaved packages.
+
+        Args:
+            notify: Async callback to send notifications
+            headless: Whether the new editor runs with rendering disabled
+            wait_timeout: Maximum time to wait for editor connection
+
+        Returns:
+            Launch result dictionary
+        """
+        previous = self._ctx.editor
+        if previous is None or not (previous.headless and previous.auto_launched):
+            return {
+                "success": False,
+                "error": "Only an editor auto-launched headless is relaunched. "
+                "Relaunch the editor with editor_launch.",
+            }
+
+        # The monitor task and the remote client belong to the event loop: stop and
+        # close them here, then wait for the editor process to exit off the loop
+        self._health_monitor.stop()
+        client = previous.remote_client
+        if client is not None and client.is_connected():
+            client.send_nowait("import unreal; unreal.SystemLibrary.quit_editor()")
+            client.close_connection()
+        await asyncio.to_thread(self._ctx.stop)
+
+        launch_result = await self.launch(
+            notify=notify,
+            additional_paths=previous.additional_paths,
+            wait_timeout=wait_timeout,
+            unattended=previous.unattended,
+            headless=headless,
+        )
+        if launch_result.get("success") and self._ctx.editor is not None:
+            self._ctx.editor.auto_launched = True
+        return launch_result
+
     async def launch_async(
         self,
         notify: NotifyCallback,
         additional_paths: Optional[list[str]] = None,
         wait_timeout: float = 120.0,
         unattended: bool = False,
+        headless: bool = False,
     ) -> dict[str, Any]:
         """
         Launch Unreal Editor asynchronously (returns immediately).
@@ -318,6 +436,7 @@ class LaunchManager:
             additional_paths: Optional list of additional Python paths
             wait_timeout: Maximum time to wait for editor connection
             unattended: Whether to pass -unattended flag to editor
+            headless: Whether to launch with rendering disabled (-nullrhi)
 
         Returns:
             Initial launch result (editor starting in background)
@@ -325,7 +444,9 @@ class LaunchManager:
         # Reset monitor state on fresh launch
         self._ctx.reset_monitor_state()
 
-        prep_result = await self._prepare_launch(notify, additional_paths, wait_timeout, unattended)
+        prep_result = await self._prepare_launch(
+            notify, additional_paths, wait_timeout, unattended, headless
+        )
         if isinstance(prep_result, dict):
             return prep_result
 
@@ -366,7 +487,7 @@ class LaunchManager:
             retry_interval: Time between connection attempts in seconds
         """
         logger.info("Starting background connection loop...")
-        remote_client = RemoteExecutionClient(
+        remote_client = AsyncRemoteExecutionClient(
             project_name=self._ctx.project_name,
             expected_pid=process.pid,  # Pass PID for verification
             multicast_group=("239.0.0.1", self._ctx.editor.multicast_port),
@@ -387,12 +508,13 @@ class LaunchManager:
                     return
 
                 # Try to connect with PID verification
-                if remote_client.find_and_verify_instance(timeout=2.0):
+                if await remote_client.find_and_verify_instance(timeout=2.0):
                     # Success! Transfer ownership to _editor
                     if self._ctx.editor:
                         self._ctx.editor.node_id = remote_client.get_node_id()
                         self._ctx.editor.remote_client = remote_client
                         self._ctx.editor.status = "ready"
+                        self._ctx.remember_endpoint()
 
                     # Run editor initialization (monkey patches, etc.)
                     await self._run_editor_init()
@@ -433,7 +555,7 @@ class LaunchManager:
         """
         logger.info(f"Background: Waiting for editor connection (timeout: {wait_timeout}s)...")
 
-        remote_client = RemoteExecutionClient(
+        remote_client = AsyncRemoteExecutionClient(
             project_name=self._ctx.project_name,
             expected_pid=process.pid,  # Pass PID for verification
             multicast_group=("239.0.0.1", self._ctx.editor.multicast_port),
@@ -460,7 +582,7 @@ class LaunchManager:
                 }
 
             # Try to discover and connect with PID verification
-            if remote_client.find_and_verify_instance(timeout=1.0):
+            if await remote_client.find_and_verify_instance(timeout=1.0):
                 connected = True
                 break
 
@@ -502,6 +624,7 @@ class LaunchManager:
             self._ctx.editor.node_id = remote_client.get_node_id()
             self._ctx.editor.remote_client = remote_client
             self._ctx.editor.status = "ready"
+            self._ctx.remember_endpoint()
 
         # Run editor initialization (monkey patches, etc.)
         await self._run_editor_init()
@@ -550,7 +673,7 @@ class LaunchManager:
 
         try:
             logger.info("Running editor initialization script...")
-            result = self._ctx.editor.remote_client.execute(
+            result = await self._ctx.editor.remote_client.execute(
                 str(init_script),
                 exec_type=self._ctx.editor.remote_client.ExecTypes.EXECUTE_FILE,
                 timeout=10.0,
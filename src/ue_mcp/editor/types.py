@@ -10,7 +10,8 @@ from datetime import datetime
 from pathlib import Path
 from typing import Any, Callable, Coroutine, Optional
 
-from ..remote_client import RemoteExecutionClient
+from ..async_remote_client import AsyncRemoteExecutionClient
+from ..core.import_cache import ImportCache
 
 # Callback type definitions
 NotifyCallback = Callable[[str, str], Coroutine[Any, Any, None]]
@@ -24,7 +25,7 @@ class EditorInstance:
     process: subprocess.Popen
     started_at: datetime = field(default_factory=datetime.now)
     status: str = "starting"  # "starting" | "ready" | "stopped"
-    remote_client: Optional[RemoteExecutionClient] = None
+    remote_client: Optional[AsyncRemoteExecutionClient] = None
     node_id: Optional[str] = None  # UE5 remote execution node ID
     log_file_path: Optional[Path] = None  # Path to editor log file
     # Launch parameters for auto-restart
@@ -32,3 +33,9 @@ class EditorInstance:
     wait_timeout: float = 120.0
     multicast_port: int = 6766  # Allocated multicast port for this instance
     unattended: bool = False  # Whether editor was launched with -unattended flag
+    headless: bool = False  # Whether editor was launched with rendering disabled (-nullrhi)
+    auto_launched: bool = False  # Whether the server launched it for a task (not editor_launch)
+    engine_build: Optional[str] = None  # Engine version reported by the editor (API path cache key)
+    api_index_key: Optional[str] = None  # Python API fingerprint (API index file name)
+    # Import statements known to succeed in this editor session (skips the import probe)
+    import_cache: ImportCache = field(default_factory=ImportCache)
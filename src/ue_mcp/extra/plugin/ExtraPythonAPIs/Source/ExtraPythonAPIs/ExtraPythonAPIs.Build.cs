@@ -16,10 +16,14 @@ public class ExtraPythonAPIs : ModuleRules
 
 		PrivateDependencyModuleNames.AddRange(new string[] {
 			"SubobjectDataInterface",
+			"AssetRegistry",
 			"UnrealEd",
 			"Slate",
 			"SlateCore",
-			"Kismet"
+			"Kismet",
+			"ImageWrapper",
+			"RenderCore",
+			"RHI"
 		});
 	}
 }
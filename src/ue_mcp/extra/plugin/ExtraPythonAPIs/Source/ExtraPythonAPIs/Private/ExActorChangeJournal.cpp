@@ -0,0 +1,289 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ExActorChangeJournal.h"
+#include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogExActorChangeJournal, Log, All);
+
+void FExActorChangeJournal::Register()
+{
+	if (GEngine)
+	{
+		BindEngineDelegates();
+	}
+	else
+	{
+		PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FExActorChangeJournal::BindEngineDelegates);
+	}
+
+	PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FExActorChangeJournal::OnObjectPropertyChanged);
+	MapChangeHandle = FEditorDelegates::MapChange.AddRaw(this, &FExActorChangeJournal::OnMapChange);
+}
+
+void FExActorChangeJournal::BindEngineDelegates()
+{
+	if (!GEngine || ActorAddedHandle.IsValid())
+	{
+		return;
+	}
+
+	ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FExActorChangeJournal::OnLevelActorAdded);
+	ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FExActorChangeJournal::OnLevelActorDeleted);
+	ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FExActorChangeJournal::OnActorMoved);
+
+	UE_LOG(LogExActorChangeJournal, Log, TEXT("Actor change journal started (capacity %d)"), Capacity);
+}
+
+void FExActorChangeJournal::Unregister()
+{
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+	FEditorDelegates::MapChange.Remove(MapChangeHandle);
+
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnActorMoved().Remove(ActorMovedHandle);
+	}
+
+	PostEngineInitHandle.Reset();
+	PropertyChangedHandle.Reset();
+	MapChangeHandle.Reset();
+	ActorAddedHandle.Reset();
+	ActorDeletedHandle.Reset();
+	ActorMovedHandle.Reset();
+
+	UntrackAll();
+}
+
+int64 FExActorChangeJournal::GetCurrentSequence()
+{
+	EnsureWorldTracked();
+	FlushTransformUpdates();
+	return Entries.GetLastSequence();
+}
+
+bool FExActorChangeJournal::GetChangesSince(int64 Sequence, TArray<FExActorChange>& OutChanges, TArray<FString>& OutChangedLevels)
+{
+	EnsureWorldTracked();
+	FlushTransformUpdates();
+
+	for (const TPair<FString, int64>& Pair : LevelSequences)
+	{
+		if (Pair.Value > Sequence)
+		{
+			OutChangedLevels.Add(Pair.Key);
+		}
+	}
+	OutChangedLevels.Sort();
+
+	return Entries.CollectSince(Sequence, OutChanges);
+}
+
+void FExActorChangeJournal::OnLevelActorAdded(AActor* Actor)
+{
+	if (IsTrackedActor(Actor))
+	{
+		RecordActor(Actor, EExActorChangeType::Added);
+	}
+}
+
+void FExActorChangeJournal::OnLevelActorDeleted(AActor* Actor)
+{
+	if (!IsTrackedActor(Actor))
+	{
+		return;
+	}
+
+	Record(EExActorChangeType::Deleted, Actor->GetPathName(), GetLevelPath(Actor));
+	UntrackActor(FObjectKey(Actor));
+}
+
+void FExActorChangeJournal::OnActorMoved(AActor* Actor)
+{
+	if (IsTrackedActor(Actor))
+	{
+		RecordActor(Actor, EExActorChangeType::Moved);
+	}
+}
+
+void FExActorChangeJournal::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+	AActor* Actor = Cast<AActor>(Object);
+	if (!Actor)
+	{
+		if (const UActorComponent* Component = Cast<UActorComponent>(Object))
+		{
+			Actor = Component->GetOwner();
+		}
+	}
+
+	if (IsTrackedActor(Actor))
+	{
+		RecordActor(Actor, EExActorChangeType::PropertyChanged);
+	}
+}
+
+void FExActorChangeJournal::OnMapChange(uint32 MapChangeFlags)
+{
+	// Loading or creating a map is not an actor change; track the new world silently
+	UntrackAll();
+	bWorldTracked = false;
+}
+
+void FExActorChangeJournal::OnTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	// Only queued here: scripted moves fire this many times per actor, the comparison runs once per query
+	if (AActor* Actor = Component ? Component->GetOwner() : nullptr)
+	{
+		QueuedActors.Add(FObjectKey(Actor));
+	}
+}
+
+void FExActorChangeJournal::Record(EExActorChangeType ChangeType, const FString& ActorPath, const FString& LevelPath)
+{
+	const int64 Sequence = Entries.NextSequence();
+	LevelSequences.Add(LevelPath, Sequence);
+
+	// Coalesce bursts (e.g. interactive property edits) of the same change on the same actor.
+	// The newest entry keeps its position at the end, so sequences stay sorted.
+	FExActorChange* Newest = Entries.Newest();
+	if (Newest && Newest->ChangeType == ChangeType && Newest->ActorPath == ActorPath)
+	{
+		Newest->Sequence = Sequence;
+		return;
+	}
+
+	FExActorChange Change;
+	Change.ChangeType = ChangeType;
+	Change.ActorPath = ActorPath;
+	Change.LevelPath = LevelPath;
+	Entries.Append(MoveTemp(Change), Sequence);
+}
+
+void FExActorChangeJournal::RecordActor(AActor* Actor, EExActorChangeType ChangeType)
+{
+	FTrackedActor& Tracked = TrackActor(Actor);
+	Tracked.Transform = Actor->GetActorTransform();
+	Tracked.ActorPath = Actor->GetPathName();
+	Tracked.LevelPath = GetLevelPath(Actor);
+
+	Record(ChangeType, Tracked.ActorPath, Tracked.LevelPath);
+}
+
+FExActorChangeJournal::FTrackedActor& FExActorChangeJournal::TrackActor(AActor* Actor)
+{
+	FTrackedActor& Tracked = TrackedActors.FindOrAdd(FObjectKey(Actor));
+	USceneComponent* Root = Actor->GetRootComponent();
+	if (!Tracked.Actor.IsValid() || Tracked.Root.Get() != Root)
+	{
+		if (USceneComponent* OldRoot = Tracked.Root.Get())
+		{
+			OldRoot->TransformUpdated.Remove(Tracked.TransformUpdatedHandle);
+		}
+		Tracked.Actor = Actor;
+		Tracked.Root = Root;
+		Tracked.TransformUpdatedHandle = Root
+			? Root->TransformUpdated.AddRaw(this, &FExActorChangeJournal::OnTransformUpdated)
+			: FDelegateHandle();
+		Tracked.Transform = Actor->GetActorTransform();
+		Tracked.ActorPath = Actor->GetPathName();
+		Tracked.LevelPath = GetLevelPath(Actor);
+	}
+	return Tracked;
+}
+
+void FExActorChangeJournal::UntrackActor(const FObjectKey& Key)
+{
+	FTrackedActor Tracked;
+	if (TrackedActors.RemoveAndCopyValue(Key, Tracked))
+	{
+		if (USceneComponent* Root = Tracked.Root.Get())
+		{
+			Root->TransformUpdated.Remove(Tracked.TransformUpdatedHandle);
+		}
+	}
+	QueuedActors.Remove(Key);
+}
+
+void FExActorChangeJournal::UntrackAll()
+{
+	for (const TPair<FObjectKey, FTrackedActor>& Pair : TrackedActors)
+	{
+		if (USceneComponent* Root = Pair.Value.Root.Get())
+		{
+			Root->TransformUpdated.Remove(Pair.Value.TransformUpdatedHandle);
+		}
+	}
+	TrackedActors.Reset();
+	QueuedActors.Reset();
+}
+
+void FExActorChangeJournal::EnsureWorldTracked()
+{
+	if (bWorldTracked)
+	{
+		return;
+	}
+
+	UWorld* World = GetEditorWorld();
+	if (!World)
+	{
+		return;
+	}
+	bWorldTracked = true;
+
+	for (TActorIterator<AActor> It(World, AActor::StaticClass(), EActorIteratorFlags::SkipPendingKill); It; ++It)
+	{
+		if (IsTrackedActor(*It))
+		{
+			TrackActor(*It);
+		}
+	}
+	UE_LOG(LogExActorChangeJournal, Verbose, TEXT("Tracking %d editor world actors"), TrackedActors.Num());
+}
+
+void FExActorChangeJournal::FlushTransformUpdates()
+{
+	for (const FObjectKey& Key : QueuedActors)
+	{
+		FTrackedActor* Tracked = TrackedActors.Find(Key);
+		AActor* Actor = Tracked ? Tracked->Actor.Get() : nullptr;
+		if (IsTrackedActor(Actor) && !Tracked->Transform.Equals(Actor->GetActorTransform(), UE_KINDA_SMALL_NUMBER))
+		{
+			RecordActor(Actor, EExActorChangeType::Moved);
+		}
+	}
+	QueuedActors.Reset();
+}
+
+UWorld* FExActorChangeJournal::GetEditorWorld()
+{
+	return GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+}
+
+bool FExActorChangeJournal::IsTrackedActor(const AActor* Actor)
+{
+	// Same set of actors as EditorActorSubsystem::GetAllLevelActors, editor world only
+	return IsValid(Actor)
+		&& !Actor->IsTemplate()
+		&& !Actor->HasAnyFlags(RF_Transient)
+		&& Actor->GetWorld() != nullptr
+		&& Actor->GetWorld() == GetEditorWorld();
+}
+
+FString FExActorChangeJournal::GetLevelPath(const AActor* Actor)
+{
+	const ULevel* Level = Actor->GetLevel();
+	return Level ? Level->GetOutermost()->GetName() : FString();
+}
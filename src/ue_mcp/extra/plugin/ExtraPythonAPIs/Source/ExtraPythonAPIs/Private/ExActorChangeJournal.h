@@ -0,0 +1,103 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "UObject/ObjectKey.h"
+#include "ExActorChangeJournalLibrary.h"
+#include "ExChangeJournalRing.h"
+
+class AActor;
+class UObject;
+class USceneComponent;
+class UWorld;
+struct FPropertyChangedEvent;
+
+/**
+ * Incremental journal of editor world actor changes
+ *
+ * Fed by GEngine level actor added/deleted/moved and property-changed delegates.
+ * Entries live in a fixed-size ring buffer and are answered by binary search on
+ * their sequence number, so a query costs O(log N + changes).
+ *
+ * Script calls such as SetActorLocation do not broadcast editor move notifications,
+ * so the journal also listens to TransformUpdated on each actor's root component and
+ * queues the actors it reports; a query journals the queued actors whose transform
+ * differs from the last recorded one. Binding the root components walks the editor
+ * world once per map load, never per query.
+ */
+class FExActorChangeJournal
+{
+public:
+	/** Maximum number of entries kept; older entries are evicted */
+	static constexpr int32 Capacity = 16384;
+
+	void Register();
+	void Unregister();
+
+	/** Journal queued transform updates and return the latest sequence number */
+	int64 GetCurrentSequence();
+
+	/** Journal queued transform updates and collect entries after Sequence. Returns false if entries were evicted. */
+	bool GetChangesSince(int64 Sequence, TArray<FExActorChange>& OutChanges, TArray<FString>& OutChangedLevels);
+
+private:
+	struct FTrackedActor
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<USceneComponent> Root;
+		FDelegateHandle TransformUpdatedHandle;
+		FTransform Transform;
+		FString ActorPath;
+		FString LevelPath;
+	};
+
+	void BindEngineDelegates();
+
+	void OnLevelActorAdded(AActor* Actor);
+	void OnLevelActorDeleted(AActor* Actor);
+	void OnActorMoved(AActor* Actor);
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+	void OnMapChange(uint32 MapChangeFlags);
+	void OnTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/** Append an entry, coalescing with the previous entry if it is the same actor and change type */
+	void Record(EExActorChangeType ChangeType, const FString& ActorPath, const FString& LevelPath);
+
+	/** Record a change for a live actor and refresh its tracked transform */
+	void RecordActor(AActor* Actor, EExActorChangeType ChangeType);
+
+	/** Start listening to an actor's root component transform; returns its tracking entry */
+	FTrackedActor& TrackActor(AActor* Actor);
+	void UntrackActor(const FObjectKey& Key);
+	void UntrackAll();
+
+	/** Track every actor of the editor world after a map load (once per map, not per query) */
+	void EnsureWorldTracked();
+
+	/** Journal a move for each queued actor whose transform differs from the recorded one */
+	void FlushTransformUpdates();
+
+	static UWorld* GetEditorWorld();
+	static bool IsTrackedActor(const AActor* Actor);
+	static FString GetLevelPath(const AActor* Actor);
+
+	TExChangeJournalRing<FExActorChange> Entries{Capacity};
+
+	/** Latest change sequence per level; never evicted, so changed-level queries are always exact */
+	TMap<FString, int64> LevelSequences;
+
+	TMap<FObjectKey, FTrackedActor> TrackedActors;
+
+	/** Tracked actors whose root component reported a transform update since the last flush */
+	TSet<FObjectKey> QueuedActors;
+	bool bWorldTracked = false;
+
+	FDelegateHandle PostEngineInitHandle;
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle PropertyChangedHandle;
+	FDelegateHandle MapChangeHandle;
+};
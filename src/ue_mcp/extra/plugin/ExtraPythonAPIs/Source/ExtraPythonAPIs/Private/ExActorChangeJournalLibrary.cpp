@@ -0,0 +1,25 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ExActorChangeJournalLibrary.h"
+#include "ExActorChangeJournal.h"
+#include "ExtraPythonAPIsModule.h"
+
+int64 UExActorChangeJournalLibrary::GetCurrentSequence()
+{
+	FExActorChangeJournal* Journal = FExtraPythonAPIsModule::GetActorChangeJournal();
+	return Journal ? Journal->GetCurrentSequence() : -1;
+}
+
+bool UExActorChangeJournalLibrary::GetActorChangesSince(int64 Sequence, TArray<FExActorChange>& OutChanges, TArray<FString>& OutChangedLevels)
+{
+	OutChanges.Reset();
+	OutChangedLevels.Reset();
+
+	FExActorChangeJournal* Journal = FExtraPythonAPIsModule::GetActorChangeJournal();
+	return Journal && Journal->GetChangesSince(Sequence, OutChanges, OutChangedLevels);
+}
+
+bool UExActorChangeJournalLibrary::IsJournalActive()
+{
+	return FExtraPythonAPIsModule::GetActorChangeJournal() != nullptr;
+}
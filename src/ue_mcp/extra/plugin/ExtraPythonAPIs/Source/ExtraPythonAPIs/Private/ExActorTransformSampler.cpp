@@ -0,0 +1,199 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ExActorTransformSampler.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogExActorTransformSampler, Log, All);
+
+UExActorTransformSampler* UExActorTransformSampler::CreateSampler(UWorld* TargetWorld, int32 CapacityFrames)
+{
+	if (!TargetWorld)
+	{
+		UE_LOG(LogExActorTransformSampler, Warning, TEXT("CreateSampler: World is null"));
+		return nullptr;
+	}
+
+	UExActorTransformSampler* Sampler = NewObject<UExActorTransformSampler>(GetTransientPackage());
+	Sampler->World = TargetWorld;
+	Sampler->Capacity = FMath::Max(1, CapacityFrames);
+	return Sampler;
+}
+
+int32 UExActorTransformSampler::RegisterActors(const TArray<AActor*>& ActorsToSample)
+{
+	if (IsSampling())
+	{
+		UE_LOG(LogExActorTransformSampler, Warning, TEXT("RegisterActors: Cannot register actors while sampling"));
+		return Actors.Num();
+	}
+
+	for (AActor* Actor : ActorsToSample)
+	{
+		Actors.Add(Actor);
+	}
+	return Actors.Num();
+}
+
+bool UExActorTransformSampler::StartSampling(float IntervalSeconds)
+{
+	if (IsSampling())
+	{
+		UE_LOG(LogExActorTransformSampler, Warning, TEXT("StartSampling: Already sampling"));
+		return false;
+	}
+
+	if (!World.IsValid())
+	{
+		UE_LOG(LogExActorTransformSampler, Warning, TEXT("StartSampling: World is no longer valid"));
+		return false;
+	}
+
+	if (Actors.Num() == 0)
+	{
+		UE_LOG(LogExActorTransformSampler, Warning, TEXT("StartSampling: No actors registered"));
+		return false;
+	}
+
+	// Preallocate the whole ring buffer so the tick path never allocates
+	FrameTicks.SetNumZeroed(Capacity);
+	FrameTimes.SetNumZeroed(Capacity);
+	FrameValues.SetNumZeroed(Capacity * Actors.Num() * ValuesPerSample);
+	FrameValid.Init(false, Capacity * Actors.Num());
+
+	Head = 0;
+	NumBuffered = 0;
+	NumDropped = 0;
+	Interval = FMath::Max(0.0, static_cast<double>(IntervalSeconds));
+	StartTime = World->GetTimeSeconds();
+	NextSampleTime = Interval;
+	ElapsedTime = 0.0;
+	TickIndex = 0;
+
+	TickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UExActorTransformSampler::OnWorldPostActorTick);
+
+	UE_LOG(LogExActorTransformSampler, Log, TEXT("StartSampling: %d actors, interval %.3fs, capacity %d frames"),
+		Actors.Num(), Interval, Capacity);
+	return true;
+}
+
+void UExActorTransformSampler::StopSampling()
+{
+	if (TickHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldPostActorTick.Remove(TickHandle);
+		TickHandle.Reset();
+	}
+}
+
+int32 UExActorTransformSampler::DrainSamples(
+	int32 MaxFrames,
+	TArray<int32>& OutTicks,
+	TArray<double>& OutTimes,
+	TArray<double>& OutValues,
+	TArray<bool>& OutValid
+)
+{
+	const int32 Count = MaxFrames > 0 ? FMath::Min(MaxFrames, NumBuffered) : NumBuffered;
+	const int32 NumActors = Actors.Num();
+
+	OutTicks.Reset(Count);
+	OutTimes.Reset(Count);
+	OutValues.Reset(Count * NumActors * ValuesPerSample);
+	OutValid.Reset(Count * NumActors);
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const int32 Slot = (Head + Index) % Capacity;
+		OutTicks.Add(FrameTicks[Slot]);
+		OutTimes.Add(FrameTimes[Slot]);
+		OutValues.Append(&FrameValues[Slot * NumActors * ValuesPerSample], NumActors * ValuesPerSample);
+		OutValid.Append(&FrameValid[Slot * NumActors], NumActors);
+	}
+
+	Head = (Head + Count) % Capacity;
+	NumBuffered -= Count;
+	return Count;
+}
+
+void UExActorTransformSampler::BeginDestroy()
+{
+	StopSampling();
+	Super::BeginDestroy();
+}
+
+void UExActorTransformSampler::OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != World.Get())
+	{
+		return;
+	}
+
+	// Paused ticks still count, so TickIndex stays in step with per-frame counters
+	++TickIndex;
+	if (InWorld->IsPaused())
+	{
+		return;
+	}
+
+	// World time rather than summed (float) DeltaSeconds, so long traces do not drift
+	ElapsedTime = InWorld->GetTimeSeconds() - StartTime;
+
+	if (Interval > 0.0)
+	{
+		if (ElapsedTime < NextSampleTime)
+		{
+			return;
+		}
+		NextSampleTime += Interval;
+	}
+
+	RecordFrame();
+}
+
+void UExActorTransformSampler::RecordFrame()
+{
+	int32 Slot;
+	if (NumBuffered < Capacity)
+	{
+		Slot = (Head + NumBuffered) % Capacity;
+		++NumBuffered;
+	}
+	else
+	{
+		// Buffer full: overwrite the oldest frame
+		Slot = Head;
+		Head = (Head + 1) % Capacity;
+		++NumDropped;
+	}
+
+	const int32 NumActors = Actors.Num();
+	FrameTicks[Slot] = TickIndex;
+	FrameTimes[Slot] = ElapsedTime;
+
+	double* Values = &FrameValues[Slot * NumActors * ValuesPerSample];
+	for (int32 ActorIndex = 0; ActorIndex < NumActors; ++ActorIndex, Values += ValuesPerSample)
+	{
+		AActor* Actor = Actors[ActorIndex].Get();
+		const bool bValid = IsValid(Actor);
+		FrameValid[Slot * NumActors + ActorIndex] = bValid;
+		if (!bValid)
+		{
+			continue;
+		}
+
+		const FVector Location = Actor->GetActorLocation();
+		const FRotator Rotation = Actor->GetActorRotation();
+		const FVector Velocity = Actor->GetVelocity();
+
+		Values[0] = Location.X;
+		Values[1] = Location.Y;
+		Values[2] = Location.Z;
+		Values[3] = Rotation.Pitch;
+		Values[4] = Rotation.Yaw;
+		Values[5] = Rotation.Roll;
+		Values[6] = Velocity.X;
+		Values[7] = Velocity.Y;
+		Values[8] = Velocity.Z;
+	}
+}
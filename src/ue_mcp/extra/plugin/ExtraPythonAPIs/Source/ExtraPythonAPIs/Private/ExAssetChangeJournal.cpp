@@ -0,0 +1,225 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ExAssetChangeJournal.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/PackageName.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include "UObject/SoftObjectPath.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogExAssetChangeJournal, Log, All);
+
+namespace ExAssetChangeJournal
+{
+	static const FString ExternalActorsFolder = TEXT("/__ExternalActors__/");
+	static const FString ExternalObjectsFolder = TEXT("/__ExternalObjects__/");
+
+	static bool MatchesPrefixes(const FString& AssetPath, const TArray<FString>& PathPrefixes)
+	{
+		if (PathPrefixes.Num() == 0)
+		{
+			return true;
+		}
+		for (const FString& Prefix : PathPrefixes)
+		{
+			if (AssetPath.StartsWith(Prefix))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+void FExAssetChangeJournal::Register()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FExAssetChangeJournal::OnAssetAdded);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FExAssetChangeJournal::OnAssetRemoved);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FExAssetChangeJournal::OnAssetRenamed);
+
+	bInitialScanComplete = !AssetRegistry.IsLoadingAssets();
+	if (!bInitialScanComplete)
+	{
+		FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FExAssetChangeJournal::OnFilesLoaded);
+	}
+
+	PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FExAssetChangeJournal::OnPackageSaved);
+	PackageDirtyHandle = UPackage::PackageDirtyStateChangedEvent.AddRaw(this, &FExAssetChangeJournal::OnPackageDirtyStateChanged);
+
+	UE_LOG(LogExAssetChangeJournal, Log, TEXT("Asset change journal started (capacity %d)"), Capacity);
+}
+
+void FExAssetChangeJournal::Unregister()
+{
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+		AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+	}
+
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+	UPackage::PackageDirtyStateChangedEvent.Remove(PackageDirtyHandle);
+
+	AssetAddedHandle.Reset();
+	AssetRemovedHandle.Reset();
+	AssetRenamedHandle.Reset();
+	PackageSavedHandle.Reset();
+	PackageDirtyHandle.Reset();
+	FilesLoadedHandle.Reset();
+}
+
+bool FExAssetChangeJournal::GetChangesSince(
+	int64 Sequence,
+	const TArray<FString>& PathPrefixes,
+	bool bIncludeDirtied,
+	TArray<FExAssetChange>& OutChanges,
+	TArray<FString>& OutChangedAssets
+) const
+{
+	TSet<FString> ChangedAssets;
+	auto CollectChanged = [&](const TMap<FString, int64>& Sequences)
+	{
+		for (const TPair<FString, int64>& Pair : Sequences)
+		{
+			if (Pair.Value > Sequence && ExAssetChangeJournal::MatchesPrefixes(Pair.Key, PathPrefixes))
+			{
+				ChangedAssets.Add(Pair.Key);
+			}
+		}
+	};
+	CollectChanged(AssetSequences);
+	if (bIncludeDirtied)
+	{
+		CollectChanged(DirtySequences);
+	}
+	OutChangedAssets = ChangedAssets.Array();
+	OutChangedAssets.Sort();
+
+	TArray<FExAssetChange> Changes;
+	const bool bComplete = Entries.CollectSince(Sequence, Changes);
+	for (FExAssetChange& Change : Changes)
+	{
+		if (!bIncludeDirtied && Change.ChangeType == EExAssetChangeType::Dirtied)
+		{
+			continue;
+		}
+		if (ExAssetChangeJournal::MatchesPrefixes(Change.AssetPath, PathPrefixes)
+			|| (!Change.OldAssetPath.IsEmpty() && ExAssetChangeJournal::MatchesPrefixes(Change.OldAssetPath, PathPrefixes)))
+		{
+			OutChanges.Add(MoveTemp(Change));
+		}
+	}
+	return bComplete;
+}
+
+FString FExAssetChangeJournal::ToAssetPath(const FString& PackageName)
+{
+	// /Game/__ExternalActors__/Maps/MyLevel/A/BC/Hash -> /Game/Maps/MyLevel
+	FString LevelPackage;
+	for (const FString* Folder : { &ExAssetChangeJournal::ExternalActorsFolder, &ExAssetChangeJournal::ExternalObjectsFolder })
+	{
+		const int32 Index = PackageName.Find(*Folder, ESearchCase::IgnoreCase);
+		if (Index == INDEX_NONE)
+		{
+			continue;
+		}
+
+		TArray<FString> Parts;
+		PackageName.Mid(Index + Folder->Len()).ParseIntoArray(Parts, TEXT("/"));
+		// Two hash folders and the package file name follow the level path
+		if (Parts.Num() > 3)
+		{
+			Parts.SetNum(Parts.Num() - 3);
+			LevelPackage = PackageName.Left(Index) + TEXT("/") + FString::Join(Parts, TEXT("/"));
+		}
+		break;
+	}
+
+	const FString& AssetPackage = LevelPackage.IsEmpty() ? PackageName : LevelPackage;
+	return AssetPackage + TEXT(".") + FPackageName::GetShortName(AssetPackage);
+}
+
+void FExAssetChangeJournal::OnAssetAdded(const FAssetData& AssetData)
+{
+	// The startup registry scan reports every asset on disk as added
+	if (bInitialScanComplete)
+	{
+		Record(EExAssetChangeType::Added, ToAssetPath(AssetData.PackageName.ToString()));
+	}
+}
+
+void FExAssetChangeJournal::OnAssetRemoved(const FAssetData& AssetData)
+{
+	Record(EExAssetChangeType::Removed, ToAssetPath(AssetData.PackageName.ToString()));
+}
+
+void FExAssetChangeJournal::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	const FString OldPackageName = FSoftObjectPath(OldObjectPath).GetLongPackageName();
+	Record(EExAssetChangeType::Renamed, ToAssetPath(AssetData.PackageName.ToString()), ToAssetPath(OldPackageName));
+}
+
+void FExAssetChangeJournal::OnPackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+	// Cook and autosave writes do not change the project's content files
+	if (ObjectSaveContext.IsProceduralSave() || (ObjectSaveContext.GetSaveFlags() & SAVE_FromAutosave) != 0)
+	{
+		return;
+	}
+
+	if (IsTrackedPackage(Package))
+	{
+		Record(EExAssetChangeType::Saved, ToAssetPath(Package->GetName()));
+	}
+}
+
+void FExAssetChangeJournal::OnPackageDirtyStateChanged(UPackage* Package)
+{
+	if (IsTrackedPackage(Package) && Package->IsDirty())
+	{
+		Record(EExAssetChangeType::Dirtied, ToAssetPath(Package->GetName()));
+	}
+}
+
+void FExAssetChangeJournal::OnFilesLoaded()
+{
+	bInitialScanComplete = true;
+}
+
+void FExAssetChangeJournal::Record(EExAssetChangeType ChangeType, const FString& AssetPath, const FString& OldAssetPath)
+{
+	const int64 Sequence = Entries.NextSequence();
+	TMap<FString, int64>& Sequences = ChangeType == EExAssetChangeType::Dirtied ? DirtySequences : AssetSequences;
+	Sequences.Add(AssetPath, Sequence);
+	if (!OldAssetPath.IsEmpty())
+	{
+		Sequences.Add(OldAssetPath, Sequence);
+	}
+
+	// Coalesce repeated events for the same asset (e.g. one save per OFPA actor package of a level)
+	FExAssetChange* Newest = Entries.Newest();
+	if (Newest && Newest->ChangeType == ChangeType && Newest->AssetPath == AssetPath && Newest->OldAssetPath == OldAssetPath)
+	{
+		Newest->Sequence = Sequence;
+		return;
+	}
+
+	FExAssetChange Change;
+	Change.ChangeType = ChangeType;
+	Change.AssetPath = AssetPath;
+	Change.OldAssetPath = OldAssetPath;
+	Entries.Append(MoveTemp(Change), Sequence);
+}
+
+bool FExAssetChangeJournal::IsTrackedPackage(const UPackage* Package)
+{
+	return Package
+		&& Package != GetTransientPackage()
+		&& !Package->HasAnyFlags(RF_Transient)
+		&& !Package->HasAnyPackageFlags(PKG_CompiledIn);
+}
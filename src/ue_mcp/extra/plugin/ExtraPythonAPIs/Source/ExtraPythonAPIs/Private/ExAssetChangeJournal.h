@@ -0,0 +1,74 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExAssetChangeJournalLibrary.h"
+#include "ExChangeJournalRing.h"
+
+class UPackage;
+class FObjectPostSaveContext;
+struct FAssetData;
+
+/**
+ * Incremental journal of asset changes
+ *
+ * Fed by asset registry added/removed/renamed events and package saved/dirty-state
+ * notifications, so change queries cost O(changes) instead of listing and stat-ing
+ * every asset under the tracked paths. Saves of OFPA external actor/object packages
+ * (__ExternalActors__/__ExternalObjects__) are recorded against their level asset.
+ */
+class FExAssetChangeJournal
+{
+public:
+	/** Maximum number of entries kept; older entries are evicted */
+	static constexpr int32 Capacity = 16384;
+
+	void Register();
+	void Unregister();
+
+	int64 GetCurrentSequence() const { return Entries.GetLastSequence(); }
+
+	/** Collect entries after Sequence that match the filters. Returns false if entries were evicted. */
+	bool GetChangesSince(
+		int64 Sequence,
+		const TArray<FString>& PathPrefixes,
+		bool bIncludeDirtied,
+		TArray<FExAssetChange>& OutChanges,
+		TArray<FString>& OutChangedAssets
+	) const;
+
+	/** Convert a package name to the object path reported by the journal, mapping external packages to their level */
+	static FString ToAssetPath(const FString& PackageName);
+
+private:
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnPackageSaved(const FString& PackageFilename, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+	void OnPackageDirtyStateChanged(UPackage* Package);
+	void OnFilesLoaded();
+
+	/** Append an entry, coalescing with the previous entry if it is the same asset and change type */
+	void Record(EExAssetChangeType ChangeType, const FString& AssetPath, const FString& OldAssetPath = FString());
+
+	static bool IsTrackedPackage(const UPackage* Package);
+
+	TExChangeJournalRing<FExAssetChange> Entries{Capacity};
+
+	/** Latest created/removed/renamed/saved sequence per asset; never evicted, so changed-asset queries are exact */
+	TMap<FString, int64> AssetSequences;
+
+	/** Latest dirtied sequence per asset */
+	TMap<FString, int64> DirtySequences;
+
+	/** Set once the asset registry's startup scan has finished; later scans report real additions */
+	bool bInitialScanComplete = false;
+
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle PackageSavedHandle;
+	FDelegateHandle PackageDirtyHandle;
+	FDelegateHandle FilesLoadedHandle;
+};
@@ -0,0 +1,31 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ExAssetChangeJournalLibrary.h"
+#include "ExAssetChangeJournal.h"
+#include "ExtraPythonAPIsModule.h"
+
+int64 UExAssetChangeJournalLibrary::GetCurrentSequence()
+{
+	FExAssetChangeJournal* Journal = FExtraPythonAPIsModule::GetAssetChangeJournal();
+	return Journal ? Journal->GetCurrentSequence() : -1;
+}
+
+bool UExAssetChangeJournalLibrary::GetAssetChangesSince(
+	int64 Sequence,
+	const TArray<FString>& PathPrefixes,
+	bool bIncludeDirtied,
+	TArray<FExAssetChange>& OutChanges,
+	TArray<FString>& OutChangedAssets
+)
+{
+	OutChanges.Reset();
+	OutChangedAssets.Reset();
+
+	FExAssetChangeJournal* Journal = FExtraPythonAPIsModule::GetAssetChangeJournal();
+	return Journal && Journal->GetChangesSince(Sequence, PathPrefixes, bIncludeDirtied, OutChanges, OutChangedAssets);
+}
+
+bool UExAssetChangeJournalLibrary::IsJournalActive()
+{
+	return FExtraPythonAPIsModule::GetAssetChangeJournal() != nullptr;
+}
@@ -3,6 +3,10 @@
 #include "ExBlueprintComponentLibrary.h"
 #include "SubobjectData.h"
 #include "SubobjectDataSubsystem.h"
+#include "Engine/SCS_Node.h"
+#include "ScopedTransaction.h"
+
+#define LOCTEXT_NAMESPACE "ExBlueprintComponentLibrary"
 
 DEFINE_LOG_CATEGORY_STATIC(LogExtraPythonAPIs, Log, All);
 
@@ -69,3 +73,55 @@ bool UExBlueprintComponentLibrary::SetupComponentAttachment(
 	UE_LOG(LogExtraPythonAPIs, Log, TEXT("SetupComponentAttachment: Attached to socket '%s'"), *SocketName.ToString());
 	return true;
 }
+
+TArray<bool> UExBlueprintComponentLibrary::SetupComponentAttachmentsBatch(const TArray<FExComponentAttachmentRequest>& Requests)
+{
+	TArray<bool> Results;
+	Results.Init(false, Requests.Num());
+
+	if (Requests.Num() == 0)
+	{
+		return Results;
+	}
+
+	const FScopedTransaction Transaction(LOCTEXT("SetupComponentAttachmentsBatch", "Setup Component Attachments"));
+
+	int32 SucceededCount = 0;
+	for (int32 Index = 0; Index < Requests.Num(); ++Index)
+	{
+		const FExComponentAttachmentRequest& Request = Requests[Index];
+
+		FSubobjectData* ChildData = Request.ChildHandle.GetData();
+		if (!ChildData)
+		{
+			continue;
+		}
+
+		// Record the SCS node in the transaction so the whole batch undoes as one step
+		if (USCS_Node* SCSNode = ChildData->GetSCSNode())
+		{
+			SCSNode->Modify();
+		}
+
+		if (Request.ParentHandle.IsValid())
+		{
+			if (!Request.ParentHandle.GetData())
+			{
+				continue;
+			}
+
+			// Same ordering as SetupComponentAttachment: SetupAttachment resets the socket name
+			ChildData->SetupAttachment(NAME_None, Request.ParentHandle);
+		}
+
+		ChildData->SetSocketName(Request.SocketName);
+
+		Results[Index] = true;
+		++SucceededCount;
+	}
+
+	UE_LOG(LogExtraPythonAPIs, Log, TEXT("SetupComponentAttachmentsBatch: Applied %d/%d attachments"), SucceededCount, Requests.Num());
+	return Results;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Fixed-capacity ring buffer of change journal entries ordered by sequence number
+ *
+ * EntryType must have an int64 Sequence member. Sequences are assigned by the ring
+ * and strictly increase from oldest to newest entry, so queries binary-search them.
+ */
+template <typename EntryType>
+class TExChangeJournalRing
+{
+public:
+	explicit TExChangeJournalRing(int32 InCapacity)
+		: Capacity(FMath::Max(1, InCapacity))
+	{
+	}
+
+	int32 GetCapacity() const { return Capacity; }
+	int64 GetLastSequence() const { return LastSequence; }
+
+	/** Reserve the next sequence number without appending an entry */
+	int64 NextSequence() { return ++LastSequence; }
+
+	/** @return The newest entry, or nullptr if the ring is empty */
+	EntryType* Newest()
+	{
+		return Entries.Num() > 0 ? &Entries[(Head + Entries.Num() - 1) % Entries.Num()] : nullptr;
+	}
+
+	/** Append an entry with the given sequence (from NextSequence), evicting the oldest if full */
+	void Append(EntryType&& Entry, int64 Sequence)
+	{
+		Entry.Sequence = Sequence;
+		if (Entries.Num() < Capacity)
+		{
+			if (Entries.Num() == 0)
+			{
+				Entries.Reserve(Capacity);
+			}
+			Entries.Add(MoveTemp(Entry));
+		}
+		else
+		{
+			EvictedSequence = Entries[Head].Sequence;
+			Entries[Head] = MoveTemp(Entry);
+			Head = (Head + 1) % Capacity;
+		}
+	}
+
+	/**
+	 * Copy entries with a sequence greater than Sequence, oldest first
+	 *
+	 * @return False if an entry newer than Sequence was already evicted
+	 */
+	bool CollectSince(int64 Sequence, TArray<EntryType>& OutEntries) const
+	{
+		const int32 Num = Entries.Num();
+		auto EntryAt = [this, Num](int32 Index) -> const EntryType& { return Entries[(Head + Index) % Num]; };
+
+		// Lower bound: first entry with a sequence greater than the cursor
+		int32 Low = 0;
+		int32 High = Num;
+		while (Low < High)
+		{
+			const int32 Mid = Low + (High - Low) / 2;
+			if (EntryAt(Mid).Sequence <= Sequence)
+			{
+				Low = Mid + 1;
+			}
+			else
+			{
+				High = Mid;
+			}
+		}
+
+		OutEntries.Reserve(OutEntries.Num() + Num - Low);
+		for (int32 Index = Low; Index < Num; ++Index)
+		{
+			OutEntries.Add(EntryAt(Index));
+		}
+
+		return EvictedSequence <= Sequence;
+	}
+
+private:
+	TArray<EntryType> Entries;
+	int32 Capacity;
+	int32 Head = 0;
+	int64 LastSequence = 0;
+
+	/** Sequence of the newest evicted entry; queries with an older cursor are incomplete */
+	int64 EvictedSequence = 0;
+};
@@ -0,0 +1,109 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ExLevelSnapshotLibrary.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "Misc/FileHelper.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogExLevelSnapshot, Log, All);
+
+namespace ExLevelSnapshot
+{
+	/** Replace field/record separators so a label cannot break the packed format */
+	static FString SanitizeField(FString Value)
+	{
+		Value.ReplaceCharInline(TEXT('\t'), TEXT(' '));
+		Value.ReplaceCharInline(TEXT('\n'), TEXT(' '));
+		Value.ReplaceCharInline(TEXT('\r'), TEXT(' '));
+		return Value;
+	}
+
+	static bool IsInFolder(const FString& ActorFolder, const FString& FolderPath)
+	{
+		return ActorFolder == FolderPath
+			|| (ActorFolder.StartsWith(FolderPath) && ActorFolder[FolderPath.Len()] == TEXT('/'));
+	}
+}
+
+FString UExLevelSnapshotLibrary::GetLevelActorSnapshot(UWorld* TargetWorld, const TArray<FString>& ClassNames, const FString& FolderPath)
+{
+	FString Buffer;
+	BuildSnapshot(TargetWorld, ClassNames, FolderPath, Buffer);
+	return Buffer;
+}
+
+int32 UExLevelSnapshotLibrary::WriteLevelActorSnapshot(UWorld* TargetWorld, const FString& FilePath, const TArray<FString>& ClassNames, const FString& FolderPath)
+{
+	FString Buffer;
+	const int32 Count = BuildSnapshot(TargetWorld, ClassNames, FolderPath, Buffer);
+	if (Count < 0)
+	{
+		return -1;
+	}
+
+	if (!FFileHelper::SaveStringToFile(Buffer, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogExLevelSnapshot, Warning, TEXT("WriteLevelActorSnapshot: Failed to write %s"), *FilePath);
+		return -1;
+	}
+	return Count;
+}
+
+int32 UExLevelSnapshotLibrary::BuildSnapshot(UWorld* TargetWorld, const TArray<FString>& ClassNames, const FString& FolderPath, FString& OutBuffer)
+{
+	OutBuffer.Reset();
+
+	if (!TargetWorld)
+	{
+		UE_LOG(LogExLevelSnapshot, Warning, TEXT("BuildSnapshot: World is null"));
+		return -1;
+	}
+
+	TSet<FString> ClassFilter(ClassNames);
+	FString FolderFilter = FolderPath;
+	FolderFilter.RemoveFromEnd(TEXT("/"));
+
+	// Rough per-actor line length, so the buffer grows a handful of times at most
+	OutBuffer.Reserve(TargetWorld->GetActorCount() * 192);
+
+	int32 Count = 0;
+	for (TActorIterator<AActor> It(TargetWorld, AActor::StaticClass(), EActorIteratorFlags::SkipPendingKill); It; ++It)
+	{
+		AActor* Actor = *It;
+		// Same set of actors as EditorActorSubsystem::GetAllLevelActors
+		if (!IsValid(Actor) || Actor->IsTemplate() || Actor->HasAnyFlags(RF_Transient))
+		{
+			continue;
+		}
+
+		const FString ClassName = Actor->GetClass()->GetName();
+		if (ClassFilter.Num() > 0 && !ClassFilter.Contains(ClassName))
+		{
+			continue;
+		}
+
+		if (!FolderFilter.IsEmpty() && !ExLevelSnapshot::IsInFolder(Actor->GetFolderPath().ToString(), FolderFilter))
+		{
+			continue;
+		}
+
+		const FTransform& Transform = Actor->GetActorTransform();
+		const FVector Location = Transform.GetLocation();
+		const FRotator Rotation = Transform.Rotator();
+		const FVector Scale = Transform.GetScale3D();
+
+		OutBuffer.Appendf(
+			TEXT("%s\t%s\t%s\t%.4f\t%.4f\t%.4f\t%.4f\t%.4f\t%.4f\t%.4f\t%.4f\t%.4f\n"),
+			*Actor->GetPathName(),
+			*ExLevelSnapshot::SanitizeField(Actor->GetActorLabel()),
+			*ClassName,
+			Location.X, Location.Y, Location.Z,
+			Rotation.Pitch, Rotation.Yaw, Rotation.Roll,
+			Scale.X, Scale.Y, Scale.Z);
+		++Count;
+	}
+
+	UE_LOG(LogExLevelSnapshot, Verbose, TEXT("BuildSnapshot: %d actors, %d chars"), Count, OutBuffer.Len());
+	return Count;
+}
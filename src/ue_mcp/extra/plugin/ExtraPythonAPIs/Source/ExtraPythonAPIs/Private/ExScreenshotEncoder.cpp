@@ -0,0 +1,91 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ExScreenshotEncoder.h"
+#include "HAL/FileManager.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+FExScreenshotEncoder::FExScreenshotEncoder(IImageWrapperModule& InImageWrapperModule)
+	: ImageWrapperModule(InImageWrapperModule)
+{
+}
+
+bool FExScreenshotEncoder::WriteImage(
+	TArray<FColor>&& Pixels,
+	int32 Width,
+	int32 Height,
+	const FString& FilePath,
+	EExScreenshotFormat Format,
+	int32 Quality,
+	FString& OutError
+) const
+{
+	for (FColor& Pixel : Pixels)
+	{
+		Pixel.A = 255;
+	}
+
+	TArray64<uint8> Bytes;
+	if (!Encode(Pixels, Width, Height, Format, Quality, Bytes, OutError))
+	{
+		return false;
+	}
+
+	const FString Directory = FPaths::GetPath(FilePath);
+	if (!Directory.IsEmpty() && !IFileManager::Get().MakeDirectory(*Directory, true))
+	{
+		OutError = FString::Printf(TEXT("Failed to create directory %s"), *Directory);
+		return false;
+	}
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+	{
+		OutError = FString::Printf(TEXT("Failed to write %s"), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+bool FExScreenshotEncoder::Encode(
+	const TArray<FColor>& Pixels,
+	int32 Width,
+	int32 Height,
+	EExScreenshotFormat Format,
+	int32 Quality,
+	TArray64<uint8>& OutBytes,
+	FString& OutError
+) const
+{
+	if (Width <= 0 || Height <= 0 || Pixels.Num() != Width * Height)
+	{
+		OutError = FString::Printf(TEXT("Pixel buffer has %d pixels, expected %dx%d"), Pixels.Num(), Width, Height);
+		return false;
+	}
+
+	const EImageFormat ImageFormat = Format == EExScreenshotFormat::JPEG ? EImageFormat::JPEG : EImageFormat::PNG;
+	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(ImageFormat);
+	if (!ImageWrapper.IsValid())
+	{
+		OutError = TEXT("No image wrapper for the requested format");
+		return false;
+	}
+
+	const int64 RawSize = static_cast<int64>(Pixels.Num()) * sizeof(FColor);
+	if (!ImageWrapper->SetRaw(Pixels.GetData(), RawSize, Width, Height, ERGBFormat::BGRA, 8))
+	{
+		OutError = TEXT("Image wrapper rejected the pixel buffer");
+		return false;
+	}
+
+	// PNG ignores the quality; 0 selects its default compression
+	const int32 CompressionQuality = Format == EExScreenshotFormat::JPEG ? FMath::Clamp(Quality, 1, 100) : 0;
+	OutBytes = ImageWrapper->GetCompressed(CompressionQuality);
+	if (OutBytes.Num() == 0)
+	{
+		OutError = TEXT("Image encoding failed");
+		return false;
+	}
+	return true;
+}
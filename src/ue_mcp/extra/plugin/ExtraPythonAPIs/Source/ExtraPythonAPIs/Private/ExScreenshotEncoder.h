@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExScreenshotWriterLibrary.h"
+
+class IImageWrapperModule;
+
+/**
+ * Pixel-to-file stage of the screenshot writer
+ *
+ * Encodes an 8-bit BGRA pixel buffer as PNG or JPEG and writes it to disk. It touches
+ * no UObjects and no RHI, so it runs on any worker thread and can be driven with
+ * synthetic buffers under -nullrhi (see Tests/ExScreenshotEncoderTest.cpp).
+ */
+class FExScreenshotEncoder
+{
+public:
+	/** The ImageWrapper module must be loaded on the game thread before encoding elsewhere */
+	explicit FExScreenshotEncoder(IImageWrapperModule& InImageWrapperModule);
+
+	/**
+	 * Encode pixels and write them to a file, creating missing directories
+	 *
+	 * Alpha is forced opaque: scene captures leave it undefined.
+	 *
+	 * @param Pixels Width * Height pixels, row-major, top row first
+	 * @param Width Image width in pixels
+	 * @param Height Image height in pixels
+	 * @param FilePath Output file path
+	 * @param Format PNG or JPEG
+	 * @param Quality JPEG quality 1-100 (ignored for PNG)
+	 * @param OutError Failure reason
+	 * @return True if the file was written
+	 */
+	bool WriteImage(
+		TArray<FColor>&& Pixels,
+		int32 Width,
+		int32 Height,
+		const FString& FilePath,
+		EExScreenshotFormat Format,
+		int32 Quality,
+		FString& OutError
+	) const;
+
+	/**
+	 * Encode pixels to compressed image bytes
+	 *
+	 * @return False (with OutError set) if the buffer does not match the size or encoding failed
+	 */
+	bool Encode(
+		const TArray<FColor>& Pixels,
+		int32 Width,
+		int32 Height,
+		EExScreenshotFormat Format,
+		int32 Quality,
+		TArray64<uint8>& OutBytes,
+		FString& OutError
+	) const;
+
+private:
+	IImageWrapperModule& ImageWrapperModule;
+};
@@ -0,0 +1,286 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ExScreenshotWriter.h"
+#include "Async/Async.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "HAL/PlatformProcess.h"
+#include "IImageWrapperModule.h"
+#include "Misc/ScopeLock.h"
+#include "Modules/ModuleManager.h"
+#include "RHICommandList.h"
+#include "RenderingThread.h"
+#include "TextureResource.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogExScreenshotWriter, Log, All);
+
+/** Copy locked readback rows into FColor pixels, converting from the render target's format */
+static bool ConvertPixels(
+	const void* Data,
+	int32 RowPitchInPixels,
+	EPixelFormat PixelFormat,
+	int32 Width,
+	int32 Height,
+	TArray<FColor>& OutPixels
+)
+{
+	OutPixels.SetNumUninitialized(Width * Height);
+	for (int32 Y = 0; Y < Height; ++Y)
+	{
+		FColor* Dest = &OutPixels[Y * Width];
+		switch (PixelFormat)
+		{
+		case PF_B8G8R8A8:
+			FMemory::Memcpy(Dest, static_cast<const FColor*>(Data) + Y * RowPitchInPixels, Width * sizeof(FColor));
+			break;
+		case PF_R8G8B8A8:
+		{
+			const uint8* Src = static_cast<const uint8*>(Data) + Y * RowPitchInPixels * 4;
+			for (int32 X = 0; X < Width; ++X, Src += 4)
+			{
+				Dest[X] = FColor(Src[0], Src[1], Src[2], Src[3]);
+			}
+			break;
+		}
+		case PF_FloatRGBA:
+		{
+			// Same as ReadSurfaceData with RCM_UNorm: clamped, no sRGB conversion
+			const FFloat16Color* Src = static_cast<const FFloat16Color*>(Data) + Y * RowPitchInPixels;
+			for (int32 X = 0; X < Width; ++X)
+			{
+				Dest[X] = FLinearColor(Src[X]).ToFColor(false);
+			}
+			break;
+		}
+		default:
+			return false;
+		}
+	}
+	return true;
+}
+
+FExScreenshotWriter::FExScreenshotWriter()
+	: Encoder(FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper")))
+{
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FExScreenshotWriter::Tick));
+}
+
+FExScreenshotWriter::~FExScreenshotWriter()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+	if (NumPending.load() > 0 && !WaitForPending(30.0f))
+	{
+		UE_LOG(LogExScreenshotWriter, Error, TEXT("%d screenshot captures still in flight at shutdown"), NumPending.load());
+	}
+
+	// Readbacks the GPU never finished are released on the render thread
+	ENQUEUE_RENDER_COMMAND(ExScreenshotDiscardReadbacks)(
+		[this](FRHICommandListImmediate& RHICmdList)
+		{
+			Readbacks.Empty();
+		});
+	FlushRenderingCommands();
+}
+
+int64 FExScreenshotWriter::Capture(
+	UTextureRenderTarget2D* RenderTarget,
+	const FString& FilePath,
+	EExScreenshotFormat Format,
+	int32 Quality
+)
+{
+	check(IsInGameThread());
+
+	if (!RenderTarget)
+	{
+		UE_LOG(LogExScreenshotWriter, Warning, TEXT("CaptureRenderTargetAsync: Render target is null"));
+		return 0;
+	}
+
+	FTextureRenderTargetResource* Resource = RenderTarget->GameThread_GetRenderTargetResource();
+	if (!Resource)
+	{
+		UE_LOG(LogExScreenshotWriter, Warning, TEXT("CaptureRenderTargetAsync: %s has no render resource"), *RenderTarget->GetName());
+		return 0;
+	}
+
+	if (NumPending.load() >= MaxInFlight)
+	{
+		UE_LOG(LogExScreenshotWriter, Warning, TEXT("CaptureRenderTargetAsync: %d captures already in flight"), MaxInFlight);
+		return 0;
+	}
+
+	int64 Ticket;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Ticket = ++LastTicket;
+		Tickets.Add(Ticket);
+		if (Tickets.Num() > MaxRetainedTickets)
+		{
+			PruneTickets();
+		}
+	}
+	++NumPending;
+
+	const int32 Width = RenderTarget->SizeX;
+	const int32 Height = RenderTarget->SizeY;
+
+	// Queued behind the render commands already issued for this target (e.g. capture_scene).
+	// Only the GPU copy is enqueued here; PollReadbacks picks up the pixels once it is done.
+	ENQUEUE_RENDER_COMMAND(ExScreenshotReadback)(
+		[this, Resource, Width, Height, Ticket, FilePath, Format, Quality](FRHICommandListImmediate& RHICmdList)
+		{
+			FRHITexture* Texture = Resource->GetRenderTargetTexture();
+
+			FPendingReadback& Pending = Readbacks.AddDefaulted_GetRef();
+			Pending.Readback = MakeUnique<FRHIGPUTextureReadback>(TEXT("ExScreenshotReadback"));
+			Pending.PixelFormat = Texture->GetFormat();
+			Pending.Width = Width;
+			Pending.Height = Height;
+			Pending.Ticket = Ticket;
+			Pending.FilePath = FilePath;
+			Pending.Format = Format;
+			Pending.Quality = Quality;
+			Pending.Readback->EnqueueCopy(RHICmdList, Texture, FIntVector::ZeroValue, 0, FIntVector(Width, Height, 1));
+		});
+
+	return Ticket;
+}
+
+bool FExScreenshotWriter::Tick(float DeltaTime)
+{
+	if (NumPending.load() > 0)
+	{
+		ENQUEUE_RENDER_COMMAND(ExScreenshotPollReadbacks)(
+			[this](FRHICommandListImmediate& RHICmdList)
+			{
+				PollReadbacks();
+			});
+	}
+	return true;
+}
+
+void FExScreenshotWriter::PollReadbacks()
+{
+	check(IsInRenderingThread());
+
+	for (int32 Index = 0; Index < Readbacks.Num();)
+	{
+		FPendingReadback& Pending = Readbacks[Index];
+		if (!Pending.Readback->IsReady())
+		{
+			++Index;
+			continue;
+		}
+
+		TArray<FColor> Pixels;
+		int32 RowPitchInPixels = 0;
+		const void* Data = Pending.Readback->Lock(RowPitchInPixels);
+		const bool bConverted = Data && ConvertPixels(
+			Data, RowPitchInPixels, Pending.PixelFormat, Pending.Width, Pending.Height, Pixels);
+		Pending.Readback->Unlock();
+
+		if (!bConverted)
+		{
+			Finish(Pending.Ticket, false, FString::Printf(
+				TEXT("Unsupported render target pixel format %s"), GetPixelFormatString(Pending.PixelFormat)));
+		}
+		else
+		{
+			Async(EAsyncExecution::ThreadPool,
+				[this, Pixels = MoveTemp(Pixels), Width = Pending.Width, Height = Pending.Height,
+					Ticket = Pending.Ticket, FilePath = MoveTemp(Pending.FilePath),
+					Format = Pending.Format, Quality = Pending.Quality]() mutable
+				{
+					FString Error;
+					const bool bSuccess = Encoder.WriteImage(
+						MoveTemp(Pixels), Width, Height, FilePath, Format, Quality, Error);
+					Finish(Ticket, bSuccess, MoveTemp(Error));
+				});
+		}
+
+		Readbacks.RemoveAtSwap(Index);
+	}
+}
+
+EExScreenshotStatus FExScreenshotWriter::GetStatus(int64 Ticket, FString& OutError)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	const FTicketState* State = Tickets.Find(Ticket);
+	if (!State)
+	{
+		return EExScreenshotStatus::Unknown;
+	}
+
+	const EExScreenshotStatus Status = State->Status;
+	if (Status != EExScreenshotStatus::Pending)
+	{
+		OutError = State->Error;
+		Tickets.Remove(Ticket);
+	}
+	return Status;
+}
+
+bool FExScreenshotWriter::WaitForPending(float TimeoutSeconds)
+{
+	if (NumPending.load() == 0)
+	{
+		return true;
+	}
+
+	// Without a game thread tick in between, poll the readbacks here until the GPU
+	// copies are done and handed off to the workers
+	const double Deadline = FPlatformTime::Seconds() + TimeoutSeconds;
+	while (NumPending.load() > 0)
+	{
+		if (FPlatformTime::Seconds() >= Deadline)
+		{
+			return false;
+		}
+		if (IsInGameThread())
+		{
+			ENQUEUE_RENDER_COMMAND(ExScreenshotPollReadbacks)(
+				[this](FRHICommandListImmediate& RHICmdList)
+				{
+					PollReadbacks();
+				});
+			FlushRenderingCommands();
+		}
+		FPlatformProcess::Sleep(0.001f);
+	}
+	return true;
+}
+
+void FExScreenshotWriter::Finish(int64 Ticket, bool bSuccess, FString&& Error)
+{
+	if (!bSuccess)
+	{
+		UE_LOG(LogExScreenshotWriter, Warning, TEXT("Screenshot capture %lld failed: %s"), Ticket, *Error);
+	}
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (FTicketState* State = Tickets.Find(Ticket))
+		{
+			State->Status = bSuccess ? EExScreenshotStatus::Completed : EExScreenshotStatus::Failed;
+			State->Error = MoveTemp(Error);
+		}
+	}
+
+	// Last, so WaitForPending returning means the writer is no longer referenced
+	--NumPending;
+}
+
+void FExScreenshotWriter::PruneTickets()
+{
+	const int64 Oldest = LastTicket - MaxRetainedTickets;
+	for (auto It = Tickets.CreateIterator(); It; ++It)
+	{
+		if (It.Key() <= Oldest && It.Value().Status != EExScreenshotStatus::Pending)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,94 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "ExScreenshotEncoder.h"
+#include "ExScreenshotWriterLibrary.h"
+#include "RHIGPUReadback.h"
+#include <atomic>
+
+class UTextureRenderTarget2D;
+
+/**
+ * Asynchronous render target screenshot writer
+ *
+ * Each capture is a three-stage pipeline: the game thread issues a ticket and the
+ * render thread enqueues a GPU copy into an FRHIGPUTextureReadback; a core ticker
+ * polls the readbacks on the render thread and hands the pixels of each finished one
+ * to the thread pool, where FExScreenshotEncoder encodes and writes the file. Neither
+ * the game thread nor the render thread waits for the GPU, so taking a screenshot no
+ * longer stalls PIE on the readback, encoding or I/O.
+ */
+class FExScreenshotWriter
+{
+public:
+	/** Captures in flight before new ones are refused; bounds the memory held by pixel buffers */
+	static constexpr int32 MaxInFlight = 32;
+
+	/** Finished tickets kept for polling; older unpolled ones are dropped */
+	static constexpr int32 MaxRetainedTickets = 4096;
+
+	/** Must be constructed on the game thread (loads the ImageWrapper module) */
+	FExScreenshotWriter();
+
+	/** Waits for captures still in flight, since they reference the writer */
+	~FExScreenshotWriter();
+
+	/** Queue a capture. Returns its ticket, or 0 if it could not be queued. */
+	int64 Capture(UTextureRenderTarget2D* RenderTarget, const FString& FilePath, EExScreenshotFormat Format, int32 Quality);
+
+	/** Status of a ticket; a final status is returned once and the ticket forgotten */
+	EExScreenshotStatus GetStatus(int64 Ticket, FString& OutError);
+
+	/** Poll the readbacks until every capture is written. Returns false on timeout. */
+	bool WaitForPending(float TimeoutSeconds);
+
+	int32 GetNumPending() const { return NumPending.load(); }
+
+private:
+	struct FTicketState
+	{
+		EExScreenshotStatus Status = EExScreenshotStatus::Pending;
+		FString Error;
+	};
+
+	/** A GPU copy in flight; only touched on the render thread */
+	struct FPendingReadback
+	{
+		TUniquePtr<FRHIGPUTextureReadback> Readback;
+		EPixelFormat PixelFormat = PF_Unknown;
+		int32 Width = 0;
+		int32 Height = 0;
+		int64 Ticket = 0;
+		FString FilePath;
+		EExScreenshotFormat Format = EExScreenshotFormat::PNG;
+		int32 Quality = 0;
+	};
+
+	/** Core ticker: queues a readback poll on the render thread while captures are pending */
+	bool Tick(float DeltaTime);
+
+	/** Render thread: hand every finished readback to the thread pool */
+	void PollReadbacks();
+
+	/** Called on a worker thread when a capture has been written or has failed (render thread if its pixels could not be read) */
+	void Finish(int64 Ticket, bool bSuccess, FString&& Error);
+
+	/** Drop finished tickets that are too old to still be polled. Lock must be held. */
+	void PruneTickets();
+
+	FExScreenshotEncoder Encoder;
+
+	/** Render thread only */
+	TArray<FPendingReadback> Readbacks;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	FCriticalSection Lock;
+	TMap<int64, FTicketState> Tickets;
+	int64 LastTicket = 0;
+
+	std::atomic<int32> NumPending{0};
+};
@@ -0,0 +1,36 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ExScreenshotWriterLibrary.h"
+#include "ExScreenshotWriter.h"
+#include "ExtraPythonAPIsModule.h"
+
+int64 UExScreenshotWriterLibrary::CaptureRenderTargetAsync(
+	UTextureRenderTarget2D* RenderTarget,
+	const FString& FilePath,
+	EExScreenshotFormat Format,
+	int32 Quality
+)
+{
+	FExScreenshotWriter* Writer = FExtraPythonAPIsModule::GetScreenshotWriter();
+	return Writer ? Writer->Capture(RenderTarget, FilePath, Format, Quality) : 0;
+}
+
+EExScreenshotStatus UExScreenshotWriterLibrary::GetCaptureStatus(int64 Ticket, FString& OutError)
+{
+	OutError.Reset();
+
+	FExScreenshotWriter* Writer = FExtraPythonAPIsModule::GetScreenshotWriter();
+	return Writer ? Writer->GetStatus(Ticket, OutError) : EExScreenshotStatus::Unknown;
+}
+
+bool UExScreenshotWriterLibrary::WaitForCaptures(float TimeoutSeconds)
+{
+	FExScreenshotWriter* Writer = FExtraPythonAPIsModule::GetScreenshotWriter();
+	return !Writer || Writer->WaitForPending(TimeoutSeconds);
+}
+
+int32 UExScreenshotWriterLibrary::GetNumPendingCaptures()
+{
+	FExScreenshotWriter* Writer = FExtraPythonAPIsModule::GetScreenshotWriter();
+	return Writer ? Writer->GetNumPending() : 0;
+}
@@ -0,0 +1,62 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ExSimulationClock.h"
+#include "Editor/EditorPerformanceSettings.h"
+#include "Misc/App.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogExSimulationClock, Log, All);
+
+FExSimulationClock::~FExSimulationClock()
+{
+	Disable();
+}
+
+bool FExSimulationClock::Enable(double DeltaSeconds)
+{
+	check(IsInGameThread());
+
+	if (DeltaSeconds <= 0.0)
+	{
+		UE_LOG(LogExSimulationClock, Warning, TEXT("EnableFixedStep: Step must be positive, got %f"), DeltaSeconds);
+		return false;
+	}
+
+	UEditorPerformanceSettings* PerformanceSettings = GetMutableDefault<UEditorPerformanceSettings>();
+
+	if (!bEnabled)
+	{
+		bPreviousUseFixedTimeStep = FApp::UseFixedTimeStep();
+		PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+		bPreviousThrottleCPU = PerformanceSettings->bThrottleCPUWhenNotForeground;
+		bEnabled = true;
+	}
+
+	// The engine skips its max tick rate wait with a fixed step; an unfocused editor
+	// (e.g. on a CI runner) would still sleep every frame without this
+	PerformanceSettings->bThrottleCPUWhenNotForeground = false;
+
+	FApp::SetFixedDeltaTime(DeltaSeconds);
+	FApp::SetUseFixedTimeStep(true);
+
+	UE_LOG(LogExSimulationClock, Log, TEXT("Fixed step enabled: %.6f s per frame"), DeltaSeconds);
+	return true;
+}
+
+void FExSimulationClock::Disable()
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	FApp::SetUseFixedTimeStep(bPreviousUseFixedTimeStep);
+	FApp::SetFixedDeltaTime(PreviousFixedDeltaTime);
+
+	if (UEditorPerformanceSettings* PerformanceSettings = GetMutableDefault<UEditorPerformanceSettings>())
+	{
+		PerformanceSettings->bThrottleCPUWhenNotForeground = bPreviousThrottleCPU;
+	}
+
+	bEnabled = false;
+	UE_LOG(LogExSimulationClock, Log, TEXT("Fixed step disabled"));
+}
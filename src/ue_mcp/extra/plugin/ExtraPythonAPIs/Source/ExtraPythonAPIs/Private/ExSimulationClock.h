@@ -0,0 +1,35 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Fixed-step engine clock
+ *
+ * Switches FApp to a fixed time step and suspends the editor's background CPU
+ * throttling, remembering the previous settings so Disable (or module shutdown)
+ * puts them back. Game thread only.
+ */
+class FExSimulationClock
+{
+public:
+	/** Restores the previous clock settings if still enabled */
+	~FExSimulationClock();
+
+	/** Enable the fixed step, or change it if already enabled. Returns false for DeltaSeconds <= 0. */
+	bool Enable(double DeltaSeconds);
+
+	/** Restore the settings saved by the first Enable */
+	void Disable();
+
+	bool IsEnabled() const { return bEnabled; }
+
+private:
+	bool bEnabled = false;
+
+	/** Settings before Enable */
+	bool bPreviousUseFixedTimeStep = false;
+	double PreviousFixedDeltaTime = 0.0;
+	bool bPreviousThrottleCPU = false;
+};
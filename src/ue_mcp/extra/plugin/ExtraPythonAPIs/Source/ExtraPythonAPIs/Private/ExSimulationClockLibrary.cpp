@@ -0,0 +1,31 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ExSimulationClockLibrary.h"
+#include "ExSimulationClock.h"
+#include "ExtraPythonAPIsModule.h"
+#include "Misc/App.h"
+
+bool UExSimulationClockLibrary::EnableFixedStep(float DeltaSeconds)
+{
+	FExSimulationClock* Clock = FExtraPythonAPIsModule::GetSimulationClock();
+	return Clock && Clock->Enable(DeltaSeconds);
+}
+
+void UExSimulationClockLibrary::DisableFixedStep()
+{
+	if (FExSimulationClock* Clock = FExtraPythonAPIsModule::GetSimulationClock())
+	{
+		Clock->Disable();
+	}
+}
+
+bool UExSimulationClockLibrary::IsFixedStepEnabled()
+{
+	FExSimulationClock* Clock = FExtraPythonAPIsModule::GetSimulationClock();
+	return Clock && Clock->IsEnabled();
+}
+
+float UExSimulationClockLibrary::GetFixedStep()
+{
+	return static_cast<float>(FApp::GetFixedDeltaTime());
+}
@@ -1,17 +1,69 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "ExtraPythonAPIsModule.h"
+#include "ExActorChangeJournal.h"
+#include "ExAssetChangeJournal.h"
+#include "ExScreenshotWriter.h"
+#include "ExSimulationClock.h"
 
 #define LOCTEXT_NAMESPACE "FExtraPythonAPIsModule"
 
 void FExtraPythonAPIsModule::StartupModule()
 {
-	// This code will execute after your module is loaded into memory
+	ActorChangeJournal = MakeUnique<FExActorChangeJournal>();
+	ActorChangeJournal->Register();
+
+	AssetChangeJournal = MakeUnique<FExAssetChangeJournal>();
+	AssetChangeJournal->Register();
+
+	ScreenshotWriter = MakeUnique<FExScreenshotWriter>();
+
+	SimulationClock = MakeUnique<FExSimulationClock>();
 }
 
 void FExtraPythonAPIsModule::ShutdownModule()
 {
-	// This function may be called during shutdown to clean up your module
+	if (ActorChangeJournal)
+	{
+		ActorChangeJournal->Unregister();
+		ActorChangeJournal.Reset();
+	}
+
+	if (AssetChangeJournal)
+	{
+		AssetChangeJournal->Unregister();
+		AssetChangeJournal.Reset();
+	}
+
+	// Waits for screenshot captures still in flight
+	ScreenshotWriter.Reset();
+
+	// Restores the real-time clock if a fixed step is still active
+	SimulationClock.Reset();
+}
+
+FExActorChangeJournal* FExtraPythonAPIsModule::GetActorChangeJournal()
+{
+	FExtraPythonAPIsModule* Module = FModuleManager::GetModulePtr<FExtraPythonAPIsModule>("ExtraPythonAPIs");
+	return Module ? Module->ActorChangeJournal.Get() : nullptr;
+}
+
+FExAssetChangeJournal* FExtraPythonAPIsModule::GetAssetChangeJournal()
+{
+	FExtraPythonAPIsModule* Module = FModuleManager::GetModulePtr<FExtraPythonAPIsModule>("ExtraPythonAPIs");
+	return Module ? Module->AssetChangeJournal.Get() : nullptr;
+}
+
+FExScreenshotWriter* FExtraPythonAPIsModule::GetScreenshotWriter()
+{
+	FExtraPythonAPIsModule* Module = FModuleManager::GetModulePtr<FExtraPythonAPIsModule>("ExtraPythonAPIs");
+	return Module ? Module->ScreenshotWriter.Get() : nullptr;
+}
+
+FExSimulationClock* FExtraPythonAPIsModule::GetSimulationClock()
+{
+	FExtraPythonAPIsModule* Module = FModuleManager::GetModulePtr<FExtraPythonAPIsModule>("ExtraPythonAPIs");
+	return Module ? Module->SimulationClock.Get() : nullptr;
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,136 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ExScreenshotEncoder.h"
+#include "HAL/FileManager.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Pixel-to-file stage only: synthetic buffers, no render target or RHI, so these run
+// headless, e.g. UnrealEditor-Cmd <project> -nullrhi -unattended
+//     -ExecCmds="Automation RunTests ExtraPythonAPIs.ScreenshotEncoder; Quit"
+
+namespace ExScreenshotEncoderTest
+{
+	TArray<FColor> MakeGradient(int32 Width, int32 Height)
+	{
+		TArray<FColor> Pixels;
+		Pixels.Reserve(Width * Height);
+		for (int32 Y = 0; Y < Height; ++Y)
+		{
+			for (int32 X = 0; X < Width; ++X)
+			{
+				// Alpha 0, as scene captures leave it
+				Pixels.Add(FColor(X * 40, Y * 60, 200, 0));
+			}
+		}
+		return Pixels;
+	}
+
+	bool Decode(IImageWrapperModule& Module, const TArray64<uint8>& Bytes, EImageFormat Format, int32& OutWidth, int32& OutHeight, TArray64<uint8>& OutRaw)
+	{
+		TSharedPtr<IImageWrapper> Wrapper = Module.CreateImageWrapper(Format);
+		if (!Wrapper.IsValid() || !Wrapper->SetCompressed(Bytes.GetData(), Bytes.Num()))
+		{
+			return false;
+		}
+		OutWidth = Wrapper->GetWidth();
+		OutHeight = Wrapper->GetHeight();
+		return Wrapper->GetRaw(ERGBFormat::BGRA, 8, OutRaw);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FExScreenshotEncoderPngTest, "ExtraPythonAPIs.ScreenshotEncoder.PngRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FExScreenshotEncoderPngTest::RunTest(const FString& Parameters)
+{
+	IImageWrapperModule& Module = FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+	const FExScreenshotEncoder Encoder(Module);
+
+	const FString Directory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("ExScreenshotEncoder"));
+	const FString FilePath = FPaths::Combine(Directory, TEXT("nested"), TEXT("gradient.png"));
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+
+	FString Error;
+	TestTrue(TEXT("WriteImage succeeds"), Encoder.WriteImage(ExScreenshotEncoderTest::MakeGradient(5, 3), 5, 3, FilePath, EExScreenshotFormat::PNG, 0, Error));
+	TestTrue(TEXT("No error"), Error.IsEmpty());
+
+	TArray<uint8> FileBytes;
+	if (!TestTrue(TEXT("File written, with its directory"), FFileHelper::LoadFileToArray(FileBytes, *FilePath)))
+	{
+		return false;
+	}
+
+	int32 Width = 0;
+	int32 Height = 0;
+	TArray64<uint8> Raw;
+	TestTrue(TEXT("Decodes"), ExScreenshotEncoderTest::Decode(Module, TArray64<uint8>(FileBytes), EImageFormat::PNG, Width, Height, Raw));
+	TestEqual(TEXT("Width"), Width, 5);
+	TestEqual(TEXT("Height"), Height, 3);
+
+	// PNG is lossless: the pixels come back unchanged, with alpha forced opaque
+	const TArray<FColor> Expected = ExScreenshotEncoderTest::MakeGradient(5, 3);
+	if (TestEqual(TEXT("Raw size"), Raw.Num(), static_cast<int64>(Expected.Num() * sizeof(FColor))))
+	{
+		const FColor* Decoded = reinterpret_cast<const FColor*>(Raw.GetData());
+		for (int32 Index = 0; Index < Expected.Num(); ++Index)
+		{
+			FColor Want = Expected[Index];
+			Want.A = 255;
+			TestEqual(FString::Printf(TEXT("Pixel %d"), Index), Decoded[Index], Want);
+		}
+	}
+
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FExScreenshotEncoderJpegTest, "ExtraPythonAPIs.ScreenshotEncoder.Jpeg",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FExScreenshotEncoderJpegTest::RunTest(const FString& Parameters)
+{
+	IImageWrapperModule& Module = FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+	const FExScreenshotEncoder Encoder(Module);
+
+	TArray64<uint8> Bytes;
+	FString Error;
+	TestTrue(TEXT("Encode succeeds"), Encoder.Encode(ExScreenshotEncoderTest::MakeGradient(64, 32), 64, 32, EExScreenshotFormat::JPEG, 80, Bytes, Error));
+
+	int32 Width = 0;
+	int32 Height = 0;
+	TArray64<uint8> Raw;
+	TestTrue(TEXT("Decodes"), ExScreenshotEncoderTest::Decode(Module, Bytes, EImageFormat::JPEG, Width, Height, Raw));
+	TestEqual(TEXT("Width"), Width, 64);
+	TestEqual(TEXT("Height"), Height, 32);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FExScreenshotEncoderInvalidTest, "ExtraPythonAPIs.ScreenshotEncoder.InvalidBuffer",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FExScreenshotEncoderInvalidTest::RunTest(const FString& Parameters)
+{
+	IImageWrapperModule& Module = FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+	const FExScreenshotEncoder Encoder(Module);
+
+	const FString FilePath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("ExScreenshotEncoder"), TEXT("invalid.png"));
+
+	FString Error;
+	TestFalse(TEXT("Size mismatch fails"), Encoder.WriteImage(ExScreenshotEncoderTest::MakeGradient(4, 4), 5, 4, FilePath, EExScreenshotFormat::PNG, 0, Error));
+	TestFalse(TEXT("Error reported"), Error.IsEmpty());
+	TestFalse(TEXT("No file written"), FPaths::FileExists(FilePath));
+
+	Error.Reset();
+	TestFalse(TEXT("Empty image fails"), Encoder.WriteImage(TArray<FColor>(), 0, 0, FilePath, EExScreenshotFormat::PNG, 0, Error));
+	TestFalse(TEXT("Error reported"), Error.IsEmpty());
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,86 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "ExActorChangeJournalLibrary.generated.h"
+
+/** Kind of change recorded in the actor change journal */
+UENUM(BlueprintType)
+enum class EExActorChangeType : uint8
+{
+	Added,
+	Deleted,
+	Moved,
+	PropertyChanged
+};
+
+/**
+ * A single actor change journal entry
+ */
+USTRUCT(BlueprintType)
+struct EXTRAPYTHONAPIS_API FExActorChange
+{
+	GENERATED_BODY()
+
+	/** Journal sequence number; strictly increasing across entries */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python|ActorChangeJournal")
+	int64 Sequence = 0;
+
+	/** What happened to the actor */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python|ActorChangeJournal")
+	EExActorChangeType ChangeType = EExActorChangeType::PropertyChanged;
+
+	/** Actor path name at the time of the change */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python|ActorChangeJournal")
+	FString ActorPath;
+
+	/** Package name of the level (map) the actor belongs to, e.g. /Game/Maps/MyLevel */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python|ActorChangeJournal")
+	FString LevelPath;
+};
+
+/**
+ * Python/Blueprint access to the editor actor change journal
+ *
+ * The ExtraPythonAPIs module records actor added/deleted/moved/property-changed
+ * events of the editor world with increasing sequence numbers, so callers can ask
+ * "what changed since sequence N" instead of diffing full level snapshots.
+ *
+ * Typical Python usage:
+ *   cursor = unreal.ExActorChangeJournalLibrary.get_current_sequence()
+ *   ... modify the level ...
+ *   complete, changes, levels = unreal.ExActorChangeJournalLibrary.get_actor_changes_since(cursor)
+ */
+UCLASS()
+class EXTRAPYTHONAPIS_API UExActorChangeJournalLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Get the sequence number of the latest journal entry
+	 * Moves that bypass editor move notifications (e.g. SetActorLocation) are
+	 * journaled from root component transform updates queued since the last query.
+	 *
+	 * @return Latest sequence number, or -1 if the journal is not running
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python|ActorChangeJournal", meta = (DevelopmentOnly))
+	static int64 GetCurrentSequence();
+
+	/**
+	 * Get actor changes recorded after a sequence number
+	 *
+	 * @param Sequence Cursor previously returned by GetCurrentSequence
+	 * @param OutChanges Journal entries with Sequence greater than the cursor, oldest first
+	 * @param OutChangedLevels Level package names with at least one change after the cursor (always complete)
+	 * @return True if OutChanges is complete; false if older entries were already evicted from the journal
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python|ActorChangeJournal", meta = (DevelopmentOnly))
+	static bool GetActorChangesSince(int64 Sequence, TArray<FExActorChange>& OutChanges, TArray<FString>& OutChangedLevels);
+
+	/** @return True if the module's actor change journal is running */
+	UFUNCTION(BlueprintPure, Category = "Python|ActorChangeJournal", meta = (DevelopmentOnly))
+	static bool IsJournalActive();
+};
@@ -0,0 +1,139 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Engine/EngineBaseTypes.h"
+#include "ExActorTransformSampler.generated.h"
+
+class AActor;
+class UWorld;
+
+/**
+ * Native actor transform sampler for PIE tracing
+ * Samples location, rotation and velocity of registered actors on world post-actor-tick
+ * into a preallocated ring buffer, so Python only has to drain the buffer in bulk
+ * instead of making several reflective calls per actor per sample.
+ *
+ * Times are world time (UWorld::GetTimeSeconds) since StartSampling, the clock the
+ * Python sampling path also follows. Times and values are stored as doubles, so
+ * large world coordinates and long traces keep full precision.
+ *
+ * Ticks count every world tick since StartSampling, paused ones included: the first
+ * tick after StartSampling is 1. The PIE tracer adds the executor tick on which it
+ * called StartSampling, so native and Python samples share one tick numbering.
+ *
+ * Typical Python usage:
+ *   sampler = unreal.ExActorTransformSampler.create_sampler(pie_world, 1024)
+ *   sampler.register_actors(actors)
+ *   sampler.start_sampling(0.1)
+ *   ...
+ *   count, ticks, times, values, valid = sampler.drain_samples(0)
+ */
+UCLASS(BlueprintType)
+class EXTRAPYTHONAPIS_API UExActorTransformSampler : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Number of values written per actor per frame: Location XYZ, Rotation Pitch/Yaw/Roll, Velocity XYZ */
+	static constexpr int32 ValuesPerSample = 9;
+
+	/**
+	 * Create a sampler bound to a world
+	 *
+	 * @param TargetWorld The world whose ticks drive sampling (usually the PIE world)
+	 * @param CapacityFrames Number of sampled frames the ring buffer holds before overwriting the oldest
+	 * @return The new sampler, or nullptr if TargetWorld is invalid
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python|ActorTransformSampler", meta = (DevelopmentOnly))
+	static UExActorTransformSampler* CreateSampler(UWorld* TargetWorld, int32 CapacityFrames = 1024);
+
+	/**
+	 * Register actors to sample. Must be called before StartSampling.
+	 *
+	 * @param ActorsToSample Actors to sample; their order defines the actor index in drained data
+	 * @return Number of actors registered in total
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python|ActorTransformSampler", meta = (DevelopmentOnly))
+	int32 RegisterActors(const TArray<AActor*>& ActorsToSample);
+
+	/**
+	 * Start sampling on every world tick, allocating the ring buffer
+	 *
+	 * @param IntervalSeconds Minimum accumulated world time between samples (0 = every tick)
+	 * @return True if sampling started
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python|ActorTransformSampler", meta = (DevelopmentOnly))
+	bool StartSampling(float IntervalSeconds = 0.0f);
+
+	/** Stop sampling. Buffered frames remain available for DrainSamples. */
+	UFUNCTION(BlueprintCallable, Category = "Python|ActorTransformSampler", meta = (DevelopmentOnly))
+	void StopSampling();
+
+	/**
+	 * Move buffered frames out of the ring buffer, oldest first
+	 *
+	 * @param MaxFrames Maximum number of frames to drain (0 = all buffered frames)
+	 * @param OutTicks Tick index (world ticks since StartSampling, starting at 1) per frame
+	 * @param OutTimes World time in seconds since StartSampling per frame
+	 * @param OutValues Frame-major, actor-minor packed values, ValuesPerSample values per actor
+	 * @param OutValid Per frame per actor flag; false if the actor was no longer valid when sampled
+	 * @return Number of frames drained
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python|ActorTransformSampler", meta = (DevelopmentOnly))
+	int32 DrainSamples(
+		int32 MaxFrames,
+		TArray<int32>& OutTicks,
+		TArray<double>& OutTimes,
+		TArray<double>& OutValues,
+		TArray<bool>& OutValid
+	);
+
+	/** @return Number of frames currently buffered */
+	UFUNCTION(BlueprintPure, Category = "Python|ActorTransformSampler", meta = (DevelopmentOnly))
+	int32 GetNumBufferedFrames() const { return NumBuffered; }
+
+	/** @return Number of frames overwritten because the buffer was not drained in time */
+	UFUNCTION(BlueprintPure, Category = "Python|ActorTransformSampler", meta = (DevelopmentOnly))
+	int32 GetNumDroppedFrames() const { return NumDropped; }
+
+	/** @return Number of registered actors */
+	UFUNCTION(BlueprintPure, Category = "Python|ActorTransformSampler", meta = (DevelopmentOnly))
+	int32 GetNumActors() const { return Actors.Num(); }
+
+	/** @return True while sampling is active */
+	UFUNCTION(BlueprintPure, Category = "Python|ActorTransformSampler", meta = (DevelopmentOnly))
+	bool IsSampling() const { return TickHandle.IsValid(); }
+
+	//~ Begin UObject Interface
+	virtual void BeginDestroy() override;
+	//~ End UObject Interface
+
+private:
+	void OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+	void RecordFrame();
+
+	TWeakObjectPtr<UWorld> World;
+	TArray<TWeakObjectPtr<AActor>> Actors;
+
+	/** Ring buffer storage, preallocated in StartSampling */
+	TArray<int32> FrameTicks;
+	TArray<double> FrameTimes;
+	TArray<double> FrameValues;
+	TArray<bool> FrameValid;
+
+	int32 Capacity = 1024;
+	int32 Head = 0;
+	int32 NumBuffered = 0;
+	int32 NumDropped = 0;
+
+	double Interval = 0.0;
+	double StartTime = 0.0;
+	double NextSampleTime = 0.0;
+	double ElapsedTime = 0.0;
+	int32 TickIndex = 0;
+
+	FDelegateHandle TickHandle;
+};
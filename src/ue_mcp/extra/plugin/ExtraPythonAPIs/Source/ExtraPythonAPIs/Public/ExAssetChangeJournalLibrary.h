@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "ExAssetChangeJournalLibrary.generated.h"
+
+/** Kind of change recorded in the asset change journal */
+UENUM(BlueprintType)
+enum class EExAssetChangeType : uint8
+{
+	Added,
+	Removed,
+	Renamed,
+	Saved,
+	Dirtied
+};
+
+/**
+ * A single asset change journal entry
+ */
+USTRUCT(BlueprintType)
+struct EXTRAPYTHONAPIS_API FExAssetChange
+{
+	GENERATED_BODY()
+
+	/** Journal sequence number; strictly increasing across entries */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python|AssetChangeJournal")
+	int64 Sequence = 0;
+
+	/** What happened to the asset */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python|AssetChangeJournal")
+	EExAssetChangeType ChangeType = EExAssetChangeType::Saved;
+
+	/**
+	 * Object path of the asset, e.g. /Game/Maps/MyLevel.MyLevel
+	 * Saves of OFPA external actor/object packages are reported against their level.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python|AssetChangeJournal")
+	FString AssetPath;
+
+	/** Previous object path for Renamed entries, empty otherwise */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python|AssetChangeJournal")
+	FString OldAssetPath;
+};
+
+/**
+ * Python/Blueprint access to the editor asset change journal
+ *
+ * The ExtraPythonAPIs module records asset registry added/removed/renamed events and
+ * package saved/dirtied notifications with increasing sequence numbers, so callers can
+ * ask "what changed since sequence N" instead of listing and stat-ing every asset.
+ *
+ * Typical Python usage:
+ *   cursor = unreal.ExAssetChangeJournalLibrary.get_current_sequence()
+ *   ... create/save/delete assets ...
+ *   complete, changes, paths = unreal.ExAssetChangeJournalLibrary.get_asset_changes_since(
+ *       cursor, ["/Game/Maps/"], False)
+ */
+UCLASS()
+class EXTRAPYTHONAPIS_API UExAssetChangeJournalLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Get the sequence number of the latest journal entry
+	 *
+	 * @return Latest sequence number, or -1 if the journal is not running
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python|AssetChangeJournal", meta = (DevelopmentOnly))
+	static int64 GetCurrentSequence();
+
+	/**
+	 * Get asset changes recorded after a sequence number
+	 *
+	 * @param Sequence Cursor previously returned by GetCurrentSequence
+	 * @param PathPrefixes Only report assets whose path starts with one of these (empty = all)
+	 * @param bIncludeDirtied Also report packages that were only dirtied in memory
+	 * @param OutChanges Matching journal entries with Sequence greater than the cursor, oldest first
+	 * @param OutChangedAssets Sorted asset paths with at least one matching change after the cursor (always complete)
+	 * @return True if OutChanges is complete; false if older entries were already evicted from the journal
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python|AssetChangeJournal", meta = (DevelopmentOnly))
+	static bool GetAssetChangesSince(
+		int64 Sequence,
+		const TArray<FString>& PathPrefixes,
+		bool bIncludeDirtied,
+		TArray<FExAssetChange>& OutChanges,
+		TArray<FString>& OutChangedAssets
+	);
+
+	/** @return True if the module's asset change journal is running */
+	UFUNCTION(BlueprintPure, Category = "Python|AssetChangeJournal", meta = (DevelopmentOnly))
+	static bool IsJournalActive();
+};
@@ -10,6 +10,27 @@
 class UBlueprint;
 struct FSubobjectDataHandle;
 
+/**
+ * A single child -> parent/socket attachment request for SetupComponentAttachmentsBatch
+ */
+USTRUCT(BlueprintType)
+struct EXTRAPYTHONAPIS_API FExComponentAttachmentRequest
+{
+	GENERATED_BODY()
+
+	/** The subobject data handle for the child component to attach */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python|BlueprintComponent")
+	FSubobjectDataHandle ChildHandle;
+
+	/** The subobject data handle for the parent component (invalid handle = keep current parent, only set socket) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python|BlueprintComponent")
+	FSubobjectDataHandle ParentHandle;
+
+	/** The socket/bone name to attach to on the parent */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python|BlueprintComponent")
+	FName SocketName;
+};
+
 /**
  * Python/Blueprint utility library for manipulating Blueprint components
  * Specifically provides access to SCS_Node properties that are not exposed to Python
@@ -61,4 +82,18 @@ public:
 		const FSubobjectDataHandle& ParentHandle,
 		FName SocketName
 	);
+
+	/**
+	 * Apply many component attachments in a single native pass
+	 * All requests are applied inside one undo transaction and a single summary line is logged,
+	 * so rigging hundreds of socketed components costs one Python -> C++ crossing.
+	 *
+	 * Each request behaves like SetupComponentAttachment; if its ParentHandle is invalid,
+	 * only the socket name is set (like SetComponentSocketAttachment).
+	 *
+	 * @param Requests The (child, parent, socket) attachment requests, applied in order
+	 * @return Per-request success flags, same length and order as Requests
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python|BlueprintComponent", meta = (DevelopmentOnly))
+	static TArray<bool> SetupComponentAttachmentsBatch(const TArray<FExComponentAttachmentRequest>& Requests);
 };
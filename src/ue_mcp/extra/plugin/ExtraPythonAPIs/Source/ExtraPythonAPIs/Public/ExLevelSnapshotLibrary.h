@@ -0,0 +1,55 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "ExLevelSnapshotLibrary.generated.h"
+
+class UWorld;
+
+/**
+ * Python/Blueprint utility library for bulk level actor snapshots
+ * Walks the level natively and packs every actor's identity and transform into one
+ * text buffer, instead of several reflective Python calls per actor.
+ *
+ * Packed format (UTF-8, one actor per line, fields separated by tabs):
+ *   PathName  Label  ClassName  LocX LocY LocZ  Pitch Yaw Roll  ScaleX ScaleY ScaleZ
+ * Tabs and line breaks in labels are replaced with spaces.
+ *
+ * Typical Python usage:
+ *   count = unreal.ExLevelSnapshotLibrary.write_level_actor_snapshot(world, path, [], "")
+ */
+UCLASS()
+class EXTRAPYTHONAPIS_API UExLevelSnapshotLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Build the packed actor snapshot of a world
+	 *
+	 * @param TargetWorld The world to snapshot (usually the editor world)
+	 * @param ClassNames Only include actors whose class name is in this list (empty = all classes)
+	 * @param FolderPath Only include actors in this outliner folder or its subfolders (empty = all folders)
+	 * @return Packed snapshot buffer, empty if TargetWorld is invalid or no actor matched
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python|LevelSnapshot", meta = (DevelopmentOnly))
+	static FString GetLevelActorSnapshot(UWorld* TargetWorld, const TArray<FString>& ClassNames, const FString& FolderPath);
+
+	/**
+	 * Build the packed actor snapshot of a world and write it to a file
+	 * Avoids routing large snapshots through the Python output log.
+	 *
+	 * @param TargetWorld The world to snapshot (usually the editor world)
+	 * @param FilePath Output file path; overwritten if it exists
+	 * @param ClassNames Only include actors whose class name is in this list (empty = all classes)
+	 * @param FolderPath Only include actors in this outliner folder or its subfolders (empty = all folders)
+	 * @return Number of actors written, or -1 on failure
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python|LevelSnapshot", meta = (DevelopmentOnly))
+	static int32 WriteLevelActorSnapshot(UWorld* TargetWorld, const FString& FilePath, const TArray<FString>& ClassNames, const FString& FolderPath);
+
+private:
+	static int32 BuildSnapshot(UWorld* TargetWorld, const TArray<FString>& ClassNames, const FString& FolderPath, FString& OutBuffer);
+};
@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "ExScreenshotWriterLibrary.generated.h"
+
+class UTextureRenderTarget2D;
+
+/** Image file format written by the screenshot writer */
+UENUM(BlueprintType)
+enum class EExScreenshotFormat : uint8
+{
+	PNG,
+	JPEG
+};
+
+/** State of a screenshot capture ticket */
+UENUM(BlueprintType)
+enum class EExScreenshotStatus : uint8
+{
+	/** Readback or encoding still in progress */
+	Pending,
+	/** File written */
+	Completed,
+	/** Readback, encoding or the file write failed */
+	Failed,
+	/** Ticket never issued, or its final status was already returned */
+	Unknown
+};
+
+/**
+ * Python/Blueprint access to the asynchronous render target screenshot writer
+ *
+ * RenderingLibrary.export_render_target reads the render target back and encodes it
+ * on the game thread. CaptureRenderTargetAsync instead enqueues an asynchronous GPU
+ * readback on the render thread, polled each frame without waiting for the GPU, and
+ * hands the pixels to the thread pool for encoding and the file write, returning a
+ * ticket immediately.
+ *
+ * Typical Python usage:
+ *   capture_component.capture_scene()
+ *   ticket = unreal.ExScreenshotWriterLibrary.capture_render_target_async(
+ *       render_target, "C:/Out/front.png", unreal.ExScreenshotFormat.PNG, 90)
+ *   ...
+ *   status, error = unreal.ExScreenshotWriterLibrary.get_capture_status(ticket)
+ */
+UCLASS()
+class EXTRAPYTHONAPIS_API UExScreenshotWriterLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Queue a readback of a render target and write it to an image file off the game thread
+	 *
+	 * Commands already queued for the render target (e.g. a capture_scene) are rendered
+	 * before the readback. Missing directories are created.
+	 *
+	 * @param RenderTarget Render target to read back (RGBA8 or RGBA16f, converted to 8-bit color)
+	 * @param FilePath Output file path, including the extension
+	 * @param Format PNG or JPEG
+	 * @param Quality JPEG quality 1-100 (ignored for PNG)
+	 * @return Ticket for GetCaptureStatus, or 0 if the capture could not be queued
+	 *         (invalid render target, or too many captures already in flight)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python|ScreenshotWriter", meta = (DevelopmentOnly))
+	static int64 CaptureRenderTargetAsync(
+		UTextureRenderTarget2D* RenderTarget,
+		const FString& FilePath,
+		EExScreenshotFormat Format = EExScreenshotFormat::PNG,
+		int32 Quality = 90
+	);
+
+	/**
+	 * Get the status of a capture ticket
+	 *
+	 * A final status (Completed or Failed) is returned once; the ticket is then forgotten.
+	 *
+	 * @param Ticket Ticket returned by CaptureRenderTargetAsync
+	 * @param OutError Failure reason if the status is Failed, empty otherwise
+	 * @return Status of the ticket
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python|ScreenshotWriter", meta = (DevelopmentOnly))
+	static EExScreenshotStatus GetCaptureStatus(int64 Ticket, FString& OutError);
+
+	/**
+	 * Block until all queued captures have been written
+	 *
+	 * @param TimeoutSeconds Maximum time to wait
+	 * @return True if no capture is in flight anymore
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python|ScreenshotWriter", meta = (DevelopmentOnly))
+	static bool WaitForCaptures(float TimeoutSeconds = 10.0f);
+
+	/** @return Number of captures queued but not yet written */
+	UFUNCTION(BlueprintPure, Category = "Python|ScreenshotWriter", meta = (DevelopmentOnly))
+	static int32 GetNumPendingCaptures();
+};
@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "ExSimulationClockLibrary.generated.h"
+
+/**
+ * Python/Blueprint access to a fixed-step engine clock
+ *
+ * With a fixed step, every engine frame advances the world by exactly DeltaSeconds,
+ * the way -benchmark -fps=N runs do: the engine no longer waits for the max tick
+ * rate and PIE simulates as fast as the machine allows, so world time is
+ * deterministic per frame and decoupled from wall-clock time. The editor's
+ * background CPU throttling is suspended while the fixed step is active.
+ *
+ * Typical Python usage:
+ *   unreal.ExSimulationClockLibrary.enable_fixed_step(1.0 / 60.0)
+ *   ... run PIE ...
+ *   unreal.ExSimulationClockLibrary.disable_fixed_step()
+ */
+UCLASS()
+class EXTRAPYTHONAPIS_API UExSimulationClockLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Advance the engine clock by a fixed step every frame, without waiting for real time
+	 *
+	 * Calling it again while enabled only changes the step.
+	 *
+	 * @param DeltaSeconds Simulation seconds per frame (must be > 0)
+	 * @return True if the fixed step is active
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Python|SimulationClock", meta = (DevelopmentOnly))
+	static bool EnableFixedStep(float DeltaSeconds = 0.016666668f);
+
+	/** Restore the clock and editor throttling settings active before EnableFixedStep */
+	UFUNCTION(BlueprintCallable, Category = "Python|SimulationClock", meta = (DevelopmentOnly))
+	static void DisableFixedStep();
+
+	/** @return True if a fixed step set by EnableFixedStep is active */
+	UFUNCTION(BlueprintPure, Category = "Python|SimulationClock", meta = (DevelopmentOnly))
+	static bool IsFixedStepEnabled();
+
+	/** @return Simulation seconds per frame of the engine's fixed step (also when set by -fps) */
+	UFUNCTION(BlueprintPure, Category = "Python|SimulationClock", meta = (DevelopmentOnly))
+	static float GetFixedStep();
+};
@@ -5,10 +5,33 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+class FExActorChangeJournal;
+class FExAssetChangeJournal;
+class FExScreenshotWriter;
+class FExSimulationClock;
+
 class FExtraPythonAPIsModule : public IModuleInterface
 {
 public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+	/** @return The editor actor change journal, or nullptr if the module is not loaded */
+	static FExActorChangeJournal* GetActorChangeJournal();
+
+	/** @return The asset change journal, or nullptr if the module is not loaded */
+	static FExAssetChangeJournal* GetAssetChangeJournal();
+
+	/** @return The asynchronous screenshot writer, or nullptr if the module is not loaded */
+	static FExScreenshotWriter* GetScreenshotWriter();
+
+	/** @return The fixed-step simulation clock, or nullptr if the module is not loaded */
+	static FExSimulationClock* GetSimulationClock();
+
+private:
+	TUniquePtr<FExActorChangeJournal> ActorChangeJournal;
+	TUniquePtr<FExAssetChangeJournal> AssetChangeJournal;
+	TUniquePtr<FExScreenshotWriter> ScreenshotWriter;
+	TUniquePtr<FExSimulationClock> SimulationClock;
 };
@@ -8,6 +8,11 @@ and query Python APIs. It supports multiple modes:
 - class_info: Get detailed class information
 - member_info: Get specific member details
 - search: Fuzzy search across all names
+- index_key: Fingerprint of the API surface, used as the API index cache key
+- build_index: Write the full reflection index read by ue_mcp.core.api_index
+
+The MCP server answers list/search/class_info queries from the index and only
+runs the query modes here when no index is available.
 
 Parameters (via sys.argv or environment variables):
     mode: Query mode
@@ -15,17 +20,22 @@ Parameters (via sys.argv or environment variables):
     include_inherited: Include inherited members (for class_info)
     include_private: Include private members (_underscore)
     limit: Maximum results to return
+    index_path: Output file (for build_index)
 """
 
 import argparse
+import hashlib
 import inspect
 import json
+import os
 import re
+import time
 
 import unreal
 
 # Bootstrap from environment variables (must be before argparse.parse_args())
 from ue_mcp_capture.utils import bootstrap_from_env
+from ue_mcp_capture.utils import output_result as _output_result
 bootstrap_from_env()
 
 
@@ -37,7 +47,10 @@ def parse_args():
     parser.add_argument(
         "--mode",
         default="list_classes",
-        choices=["list_classes", "list_functions", "class_info", "member_info", "search"],
+        choices=[
+            "list_classes", "list_functions", "class_info", "member_info", "search",
+            "index_key", "build_index",
+        ],
         help="Query mode (default: list_classes)"
     )
     parser.add_argument(
@@ -69,6 +82,11 @@ def parse_args():
         default=100,
         help="Maximum results to return (default: 100)"
     )
+    parser.add_argument(
+        "--index-path",
+        default=None,
+        help="Output file for build_index mode"
+    )
     return parser.parse_args()
 
 
@@ -79,11 +97,15 @@ query = args.query
 include_inherited = args.include_inherited
 include_private = args.include_private
 limit = args.limit
+index_path = args.index_path
+
+# Must match API_INDEX_VERSION in ue_mcp.core.api_index
+API_INDEX_VERSION = 1
 
 
 def output_result(data):
-    """Output result as pure JSON (will be parsed as last line)."""
-    print(json.dumps(data, default=str))
+    """Output result through the shared result channel, stringifying unknown objects."""
+    _output_result(data, default=str)
 
 
 def parse_ue_property_doc(doc):
@@ -453,6 +475,124 @@ def search():
     })
 
 
+def compute_index_key():
+    """
+    Fingerprint the unreal API surface: engine version, index format, every
+    module-level name and the number of attributes each class defines. Enabling a
+    plugin or changing reflected project code changes the key.
+    """
+    engine_build = unreal.SystemLibrary.get_engine_version()
+    digest = hashlib.sha1(f"{API_INDEX_VERSION}\n{engine_build}\n".encode("utf-8"))
+    for name in sorted(dir(unreal)):
+        obj = getattr(unreal, name, None)
+        count = len(getattr(obj, "__dict__", ())) if inspect.isclass(obj) else 0
+        digest.update(f"{name}:{count}\n".encode("utf-8"))
+    return digest.hexdigest()[:16], engine_build
+
+
+def index_key():
+    """Output the API index cache key."""
+    key, engine_build = compute_index_key()
+    output_result({"success": True, "key": key, "engine_build": engine_build})
+
+
+def describe_member(name, obj):
+    """Index row tail for a class member: [kind, signature, docstring, property_type, access]."""
+    type_name = type(obj).__name__
+    if type_name == 'getset_descriptor':
+        prop_type, access, desc = parse_ue_property_doc(getattr(obj, '__doc__', '') or '')
+        return ["property", f"{name}: {prop_type or 'Unknown'} ({access})", desc, prop_type, access]
+    if isinstance(obj, property):
+        access = "read-write" if obj.fset else "read-only"
+        doc = ((obj.fget.__doc__ if obj.fget else "") or "").split('\n')[0][:200]
+        return ["property", f"{name} ({access})", doc, None, access]
+    if callable(obj) and not inspect.isclass(obj):
+        try:
+            sig = str(inspect.signature(obj))
+        except (ValueError, TypeError):
+            sig = "(self)"
+        doc = (getattr(obj, '__doc__', '') or '').split('\n')[0][:200]
+        return ["method", f"def {name}{sig}", doc, None, None]
+    if inspect.isclass(obj):
+        return None
+    return ["attribute", f"{name}: {type(obj).__name__}", "", None, None]
+
+
+def build_index():
+    """
+    Reflect the whole unreal module into an index file.
+
+    Classes store their MRO, and members are stored only on the class that defines
+    them, so inherited members are resolved by the reader instead of being repeated
+    for every subclass.
+    """
+    if not index_path:
+        output_result({"success": False, "error": "index_path is required for build_index"})
+        return
+
+    start = time.time()
+    key, engine_build = compute_index_key()
+    classes = []
+    functions = []
+    members = []
+
+    for name in sorted(dir(unreal)):
+        if name.startswith('__'):
+            continue
+        try:
+            obj = getattr(unreal, name)
+        except Exception:
+            continue
+
+        if inspect.isclass(obj):
+            mro = [b.__name__ for b in obj.__mro__[1:] if b is not object]
+            classes.append([name, (obj.__doc__ or "")[:2000], mro])
+            for mem_name in sorted(obj.__dict__):
+                if mem_name.startswith('__'):
+                    continue
+                try:
+                    row = describe_member(mem_name, getattr(obj, mem_name))
+                except Exception:
+                    continue
+                if row:
+                    members.append([name, mem_name] + row)
+        elif callable(obj):
+            try:
+                sig = str(inspect.signature(obj))
+            except (ValueError, TypeError):
+                sig = "()"
+            doc = (getattr(obj, '__doc__', '') or '').split('\n')[0][:200]
+            functions.append([name, f"def {name}{sig}", doc])
+
+    index = {
+        "version": API_INDEX_VERSION,
+        "key": key,
+        "engine_build": engine_build,
+        "created": time.time(),
+        "classes": classes,
+        "functions": functions,
+        "members": members,
+    }
+
+    # Write under a temporary name so the server never loads a partial index
+    os.makedirs(os.path.dirname(index_path), exist_ok=True)
+    temp_path = index_path + ".tmp"
+    with open(temp_path, "w", encoding="utf-8") as f:
+        json.dump(index, f, separators=(",", ":"), default=str)
+    os.replace(temp_path, index_path)
+
+    output_result({
+        "success": True,
+        "key": key,
+        "engine_build": engine_build,
+        "index_path": index_path,
+        "class_count": len(classes),
+        "function_count": len(functions),
+        "member_count": len(members),
+        "seconds": round(time.time() - start, 2),
+    })
+
+
 # Main execution
 mode_handlers = {
     'list_classes': list_classes,
@@ -460,6 +600,8 @@ mode_handlers = {
     'class_info': class_info,
     'member_info': member_info,
     'search': search,
+    'index_key': index_key,
+    'build_index': build_index,
 }
 
 handler = mode_handlers.get(mode)
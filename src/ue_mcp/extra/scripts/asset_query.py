@@ -19,7 +19,6 @@ Parameters:
 """
 
 import argparse
-import json
 
 import unreal
 
@@ -72,7 +71,7 @@ def query_assets_by_type(asset_type_path, base_path="/Game", limit=100):
 def main():
     """Main entry point."""
     # Bootstrap from environment variables (must be before argparse)
-    from ue_mcp_capture.utils import bootstrap_from_env
+    from ue_mcp_capture.utils import bootstrap_from_env, output_result
     bootstrap_from_env()
 
     parser = argparse.ArgumentParser(
@@ -124,8 +123,8 @@ def main():
             "truncated": len(items) >= limit,
         }
 
-    # Output result as pure JSON
-    print(json.dumps(result))
+    # Output result (out-of-band result file in MCP mode)
+    output_result(result)
 
 
 if __name__ == "__main__":
@@ -8,6 +8,9 @@ Current patches:
 1. LevelEditorSubsystem.load_level - calls RefreshSlateView after level load
    to ensure the Slate UI updates properly.
 
+It also preloads the code inspector, so execute_code's API validation requests
+only carry the API paths to check (see ExecutionManager._check_unreal_api).
+
 Usage:
     # Via MCP (automatically after editor launch):
     Executed by launch_manager.py after connection
@@ -17,6 +20,8 @@ Usage:
 """
 
 import json
+import os
+import sys
 
 import unreal
 
@@ -66,6 +71,32 @@ def patch_load_level() -> dict:
     return {"success": True, "message": "patched successfully", "patched": True}
 
 
+def preload_code_inspector() -> dict:
+    """
+    Import ue_mcp.validation.code_inspector so it stays resident in the editor.
+
+    The inspector keeps a per-process cache of resolved unreal API paths, so only
+    paths never seen before in this editor session cost a reflection lookup.
+
+    Returns:
+        dict with success status and the engine build used as the server's cache key
+    """
+    script_file = globals().get("__file__")
+    if not script_file:
+        # Not fatal: the first validation request imports the inspector instead
+        return {"success": True, "loaded": False, "message": "__file__ not available"}
+
+    # This script lives in src/ue_mcp/extra/scripts
+    src_path = os.path.abspath(os.path.join(os.path.dirname(script_file), "..", "..", ".."))
+    if src_path not in sys.path:
+        sys.path.insert(0, src_path)
+
+    from ue_mcp.validation.code_inspector import validate_unreal_api_paths
+
+    engine_build = validate_unreal_api_paths([])["engine_build"]
+    return {"success": True, "loaded": True, "engine_build": engine_build}
+
+
 def main():
     """Main entry point - apply all initialization patches."""
     results = {}
@@ -76,6 +107,12 @@ def main():
     except Exception as e:
         results["load_level_patch"] = {"success": False, "error": str(e)}
 
+    # Preload the code inspector
+    try:
+        results["code_inspector"] = preload_code_inspector()
+    except Exception as e:
+        results["code_inspector"] = {"success": False, "error": str(e)}
+
     # Overall success if all patches succeeded
     all_success = all(r.get("success", False) for r in results.values())
 
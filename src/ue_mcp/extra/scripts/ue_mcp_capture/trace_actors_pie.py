@@ -23,6 +23,14 @@ Output directory structure:
     │       └── ...
     └── ...
 
+With --output-format=columnar, per-sample transform.json files are replaced by a
+single columnar binary file (output_dir/trace.uetrace) that the MCP server can slice
+by actor and tick range without loading it fully.
+
+With --fixed-step, PIE advances by exactly that many simulation seconds per frame
+and runs as fast as the machine allows; timestamps and the duration are simulation
+time, so a long scenario finishes in less wall-clock time.
+
 Usage (CLI):
     python trace_actors_pie.py --output-dir=/path/to/output --level=/Game/Maps/TestLevel --actor-names=["Actor1","Actor2"]
 
@@ -36,6 +44,8 @@ Usage (CLI):
         --resolution-width=800    Screenshot width (default: 800)
         --resolution-height=600   Screenshot height (default: 600)
         --multi-angle             Enable multi-angle capture (default: True)
+        --output-format=json      Sample output format: json or columnar (default: json)
+        --fixed-step=0.0166667    Fixed simulation step in seconds (default: real time)
 
 MCP mode (sys.argv):
     task_id: str - Unique task identifier for completion file
@@ -50,6 +60,8 @@ MCP mode (sys.argv):
     resolution_width: int - Screenshot width (default: 800)
     resolution_height: int - Screenshot height (default: 600)
     multi_angle: bool - Enable multi-angle capture (default: True)
+    output_format: str - "json" or "columnar" (default: "json")
+    fixed_step: float - Fixed simulation step in seconds (default: None, real time)
 """
 import argparse
 import json
@@ -67,6 +79,8 @@ from ue_mcp_capture.utils import bootstrap_from_env, ensure_level_loaded, output
 #     "resolution_width": 800,
 #     "resolution_height": 600,
 #     "multi_angle": True,
+#     "output_format": "json",
+#     "fixed_step": None,
 # }
 
 # Required parameters (for reference)
@@ -164,6 +178,19 @@ def parse_args():
         dest="multi_angle",
         help="Disable multi-angle capture"
     )
+    parser.add_argument(
+        "--output-format",
+        type=str,
+        choices=["json", "columnar"],
+        default="json",
+        help="Sample output format: per-sample transform.json or single columnar trace file (default: json)"
+    )
+    parser.add_argument(
+        "--fixed-step",
+        type=float,
+        default=None,
+        help="Fixed simulation step in seconds; PIE runs faster than real time (default: real time)"
+    )
 
     args = parser.parse_args()
 
@@ -203,6 +230,8 @@ def main():
         target_height=args.target_height,
         resolution=resolution,
         multi_angle=args.multi_angle,
+        output_format=args.output_format,
+        fixed_step=args.fixed_step,
     )
 
     # Build result
@@ -213,6 +242,8 @@ def main():
         "interval": args.interval_seconds,
         "actor_count": len(args.actor_names),
         "capture_screenshots": args.capture_screenshots,
+        "output_format": args.output_format,
+        "fixed_step": args.fixed_step,
     }
 
     # Return immediately with started status
@@ -24,6 +24,7 @@ import unreal
 # Environment variable names for script parameter passing (must match _helpers.py)
 ENV_VAR_MODE = "UE_MCP_MODE"  # "1" when running via MCP (vs CLI)
 ENV_VAR_CALL = "UE_MCP_CALL"  # "<checksum>:<timestamp>:<json_params>" script call info
+ENV_VAR_RESULT = "UE_MCP_RESULT"  # Result file path for output_result()
 
 # Maximum allowed age for injected parameters (in seconds)
 # Increased to 5s to account for UE5's Python execution lag between
@@ -33,6 +34,9 @@ INJECT_TIME_MAX_AGE = 5.0
 # Flag to track if running in MCP mode (vs CLI mode)
 _mcp_mode = None
 
+# Out-of-band result file named by the MCP server (None = print the result)
+_result_file = None
+
 
 class StaleParametersError(RuntimeError):
     """Raised when injected parameters are too old (stale)."""
@@ -46,7 +50,7 @@ class ScriptMismatchError(RuntimeError):
 
 def _clean_env_vars() -> None:
     """Clean up all MCP env vars to prevent leakage to other scripts."""
-    for var in (ENV_VAR_MODE, ENV_VAR_CALL):
+    for var in (ENV_VAR_MODE, ENV_VAR_CALL, ENV_VAR_RESULT):
         if var in os.environ:
             del os.environ[var]
 
@@ -119,7 +123,10 @@ def bootstrap_from_env(script_path: str | None = None) -> tuple[bool, dict]:
             args = parser.parse_args()  # Works normally
             ...
     """
-    global _mcp_mode
+    global _mcp_mode, _result_file
+
+    # Never reuse a result file left over from a previous script
+    _result_file = None
 
     # Check if MCP mode is enabled
     mcp_mode_flag = os.environ.get(ENV_VAR_MODE)
@@ -189,6 +196,7 @@ def bootstrap_from_env(script_path: str | None = None) -> tuple[bool, dict]:
         return False, {}
 
     _mcp_mode = True
+    _result_file = os.environ.get(ENV_VAR_RESULT) or None
 
     # Build sys.argv from params
     sys.argv = [script_path or "script.py"]
@@ -326,23 +334,37 @@ def ensure_level_loaded(target_level: str) -> None:
         raise RuntimeError(f"Failed to load level: {target_level}")
 
 
-def output_result(data: dict) -> None:
+def output_result(data: dict, default=None) -> None:
     """
     Output result as pure JSON (last line of output).
 
     The MCP server will parse the last valid JSON object from the output.
     This enables clean output without special markers.
 
-    In MCP mode: Outputs compact JSON for parsing
+    In MCP mode: Writes the result file named by the server if there is one
+                 (see editor_capture.result_file), otherwise outputs compact JSON
     In CLI mode: Outputs formatted JSON for readability
+
+    Args:
+        data: Result dict
+        default: Optional json.dumps fallback for objects that are not serializable
     """
     if _is_mcp_mode():
+        if _result_file:
+            try:
+                from editor_capture.result_file import write_result_file
+
+                size = write_result_file(_result_file, data, default=default)
+                print(f"Result written to {_result_file} ({size} bytes)")
+                return
+            except Exception as e:
+                print(f"Warning: Failed to write result file, printing result instead: {e}")
         # MCP mode: compact JSON (will be parsed as last line)
-        print(json.dumps(data))
+        print(json.dumps(data, default=default))
     else:
         # CLI mode: human-readable formatted output
         print("\n" + "=" * 60)
         print("CAPTURE RESULT")
         print("=" * 60)
-        print(json.dumps(data, indent=2))
+        print(json.dumps(data, indent=2, default=default))
         print("=" * 60)
@@ -4,12 +4,14 @@
 import gc
 import unreal
 import math
+from collections import deque
 from typing import List, Dict, Any, Optional, Set
 from dataclasses import dataclass
 
 from .base import BaseDiagnostic
 from ..core import AssetType, DiagnosticResult, IssueSeverity
 from ..utils import (
+    AABBGrid,
     get_actor_size,
     calculate_distance,
     aabb_intersects,
@@ -480,19 +482,34 @@ class LevelDiagnostic(BaseDiagnostic):
 
         Excludes actors with parent-child attachment relationships from
         being flagged as overlapping.
+
+        Candidate pairs come from a uniform grid over the actor AABBs; pairs are
+        still visited in (i, j>i) list order, so issues match a full pairwise scan.
         """
         overlap_count = 0
         containment_count = 0
 
+        # Bounds per actor (origin is actor position, extent is half-size)
+        bounds = [
+            (
+                (a["x"], a["y"], a["z"]),
+                (a["x_extent"] / 2, a["y_extent"] / 2, a["z_extent"] / 2),
+            )
+            for a in actors
+        ]
+        grid = AABBGrid(bounds)
+
         for i, a1 in enumerate(actors):
             a1_actor = a1["actor"]
             a1_exclude = self._build_attach_exclude_set(a1_actor)
 
-            # Get a1's bounds (origin is actor position, extent is half-size)
-            a1_origin = (a1["x"], a1["y"], a1["z"])
-            a1_extent = (a1["x_extent"] / 2, a1["y_extent"] / 2, a1["z_extent"] / 2)
+            # Get a1's bounds
+            a1_origin, a1_extent = bounds[i]
 
-            for a2 in actors[i + 1 :]:
+            for j in grid.query_key(i):
+                if j <= i:
+                    continue
+                a2 = actors[j]
                 a2_actor = a2["actor"]
 
                 # Skip if actors have attachment relationship
@@ -500,8 +517,7 @@ class LevelDiagnostic(BaseDiagnostic):
                     continue
 
                 # Get a2's bounds
-                a2_origin = (a2["x"], a2["y"], a2["z"])
-                a2_extent = (a2["x_extent"] / 2, a2["y_extent"] / 2, a2["z_extent"] / 2)
+                a2_origin, a2_extent = bounds[j]
 
                 # Check AABB intersection
                 if not aabb_intersects(a1_origin, a1_extent, a2_origin, a2_extent):
@@ -786,40 +802,6 @@ class LevelDiagnostic(BaseDiagnostic):
             pass
         return exclude
 
-    def _get_overlapping_actors_for_support(
-        self,
-        actor_info: ActorSupportInfo,
-        all_actor_info: Dict[unreal.Actor, ActorSupportInfo],
-    ) -> List[unreal.Actor]:
-        """
-        Find actors that overlap with the given actor (for support chain detection).
-        Excludes actors with attachment relationships.
-
-        Args:
-            actor_info: The actor's support info
-            all_actor_info: Dict mapping actors to their support info
-
-        Returns:
-            List of overlapping actors
-        """
-        overlapping = []
-        exclude_set = self._build_attach_exclude_set(actor_info.actor)
-
-        for other_actor, other_info in all_actor_info.items():
-            if other_actor in exclude_set:
-                continue
-
-            # Use AABB intersection test
-            if aabb_intersects(
-                actor_info.origin,
-                actor_info.box_extent,
-                other_info.origin,
-                other_info.box_extent,
-            ):
-                overlapping.append(other_actor)
-
-        return overlapping
-
     def _detect_floating_objects(
         self, actors: List[unreal.Actor], ground_actors: List[unreal.Actor]
     ) -> tuple[List[FloatingCluster], int, Dict[unreal.Actor, ActorSupportInfo]]:
@@ -833,6 +815,10 @@ class LevelDiagnostic(BaseDiagnostic):
         4. Cluster unsupported actors into connected groups
         5. Return clusters of floating actors
 
+        Propagation is a breadth-first search from the supported frontier, with
+        overlap candidates taken from a uniform grid over the cached bounds.
+        Actors with attachment relationships do not support each other.
+
         Args:
             actors: All tangible actors to check
             ground_actors: Actors identified as ground surfaces
@@ -859,35 +845,49 @@ class LevelDiagnostic(BaseDiagnostic):
                 actor_info_map[actor].is_supported = True
                 actor_info_map[actor].support_depth = 0
 
-        # Propagation loop
+        # Spatial index over cached bounds (keys are indices into infos)
+        infos = list(actor_info_map.values())
+        grid = AABBGrid([(info.origin, info.box_extent) for info in infos])
+        exclude_sets = {}  # {index: attach exclude set}, built lazily
+
+        # Propagation: an actor gets depth N if it overlaps an actor of depth N-1
         max_depth = 0
         current_depth = 0
-        changed = True
+        frontier = [i for i, info in enumerate(infos) if info.is_supported]
 
-        while changed:
-            changed = False
+        while frontier:
             current_depth += 1
             newly_supported = []
 
-            # Find unsupported actors that overlap with supported actors
-            for actor, info in actor_info_map.items():
-                if info.is_supported:
-                    continue
+            # Find unsupported actors that overlap with the last supported layer
+            for supporter_index in frontier:
+                supporter = infos[supporter_index]
+                for index in grid.query_key(supporter_index):
+                    info = infos[index]
+                    if info.is_supported:
+                        continue
 
-                # Check if this actor overlaps with any supported actor
-                overlapping = self._get_overlapping_actors_for_support(info, actor_info_map)
-                for other in overlapping:
-                    other_info = actor_info_map.get(other)
-                    if other_info and other_info.is_supported:
-                        newly_supported.append((actor, current_depth))
-                        break
+                    # Exclusion is from the supported-candidate actor's perspective
+                    exclude_set = exclude_sets.get(index)
+                    if exclude_set is None:
+                        exclude_set = self._build_attach_exclude_set(info.actor)
+                        exclude_sets[index] = exclude_set
+                    if supporter.actor in exclude_set:
+                        continue
 
-            # Mark newly supported actors
-            for actor, depth in newly_supported:
-                actor_info_map[actor].is_supported = True
-                actor_info_map[actor].support_depth = depth
-                max_depth = max(max_depth, depth)
-                changed = True
+                    if aabb_intersects(
+                        info.origin,
+                        info.box_extent,
+                        supporter.origin,
+                        supporter.box_extent,
+                    ):
+                        info.is_supported = True
+                        info.support_depth = current_depth
+                        newly_supported.append(index)
+
+            if newly_supported:
+                max_depth = current_depth
+            frontier = newly_supported
 
             # Prevent infinite loops (max depth 100)
             if current_depth > 100:
@@ -895,7 +895,7 @@ class LevelDiagnostic(BaseDiagnostic):
 
         # Collect floating (unsupported) actors and cluster them
         floating_actors = [info.actor for info in actor_info_map.values() if not info.is_supported]
-        clusters = self._cluster_floating_actors(floating_actors, actor_info_map)
+        clusters = self._cluster_floating_actors(floating_actors, actor_info_map, grid)
 
         return clusters, max_depth, actor_info_map
 
@@ -903,16 +903,19 @@ class LevelDiagnostic(BaseDiagnostic):
         self,
         floating_actors: List[unreal.Actor],
         actor_info_map: Dict[unreal.Actor, ActorSupportInfo],
+        grid: Optional[AABBGrid] = None,
     ) -> List[FloatingCluster]:
         """
         Group floating actors into connected clusters using AABB intersection.
 
         Uses BFS to find connected components. Two floating actors belong to the
-        same cluster if their bounding boxes intersect.
+        same cluster if their bounding boxes intersect. Neighbours are visited in
+        floating_actors order, so cluster contents and order match a full scan.
 
         Args:
             floating_actors: List of actors identified as floating
             actor_info_map: Dict mapping actors to their support info (contains bounds)
+            grid: AABBGrid over actor_info_map values (in dict order); built if not given
 
         Returns:
             List of FloatingCluster, each containing connected floating actors
@@ -920,7 +923,13 @@ class LevelDiagnostic(BaseDiagnostic):
         if not floating_actors:
             return []
 
-        floating_set = set(floating_actors)
+        if grid is None:
+            grid = AABBGrid([(info.origin, info.box_extent) for info in actor_info_map.values()])
+        grid_actors = list(actor_info_map.keys())
+        grid_index = {actor: i for i, actor in enumerate(grid_actors)}
+
+        # Position of each floating actor in floating_actors (neighbour visit order)
+        floating_order = {actor: i for i, actor in enumerate(floating_actors)}
         visited = set()
         clusters = []
 
@@ -930,10 +939,10 @@ class LevelDiagnostic(BaseDiagnostic):
 
             # BFS to find all connected floating actors
             cluster_actors = []
-            queue = [start_actor]
+            queue = deque([start_actor])
 
             while queue:
-                current = queue.pop(0)
+                current = queue.popleft()
                 if current in visited:
                     continue
 
@@ -945,8 +954,14 @@ class LevelDiagnostic(BaseDiagnostic):
                     continue
 
                 current_info = actor_info_map[current]
-                for other in floating_actors:
-                    if other in visited or other not in actor_info_map:
+                neighbours = [
+                    grid_actors[i]
+                    for i in grid.query_key(grid_index[current])
+                    if grid_actors[i] in floating_order
+                ]
+                neighbours.sort(key=floating_order.__getitem__)
+                for other in neighbours:
+                    if other in visited:
                         continue
 
                     other_info = actor_info_map[other]
@@ -365,6 +365,118 @@ def aabb_intersects(origin1, extent1, origin2, extent2, epsilon=0.1):
     return True
 
 
+def _to_tuple(v):
+    """Convert an unreal.Vector (or any x/y/z object) to a tuple; pass tuples through."""
+    if hasattr(v, "x"):
+        return (v.x, v.y, v.z)
+    return v
+
+
+class AABBGrid:
+    """
+    Uniform grid spatial index over axis-aligned bounding boxes.
+
+    Used to find candidate pairs for aabb_intersects() without comparing every
+    pair of actors. The grid only prunes: query() returns a superset of the boxes
+    that aabb_intersects() (with the same epsilon) would accept, so callers must
+    still run the exact test on each candidate. Results are therefore identical
+    to a brute-force scan.
+
+    Boxes that would cover more than MAX_CELLS_PER_BOX cells (e.g. landscapes)
+    are kept in a separate list and returned as candidates for every query.
+    """
+
+    MAX_CELLS_PER_BOX = 512
+
+    def __init__(self, boxes, cell_size=None, epsilon=0.1):
+        """
+        Build the grid.
+
+        Args:
+            boxes: Sequence of (origin, extent) pairs (unreal.Vector or tuples, extent is
+                   half-size). The key of each box is its index in this sequence.
+            cell_size: Grid cell edge length. Defaults to the median full box size.
+            epsilon: Same tolerance as passed to aabb_intersects()
+        """
+        self.epsilon = epsilon
+        self._boxes = [(_to_tuple(o), _to_tuple(e)) for o, e in boxes]
+        self._cells = {}
+        self._large = []
+
+        if cell_size is None:
+            sizes = sorted(2.0 * max(e) for _o, e in self._boxes) if self._boxes else []
+            cell_size = sizes[len(sizes) // 2] if sizes else 1.0
+        self.cell_size = max(float(cell_size), 1.0)
+
+        for key, (origin, extent) in enumerate(self._boxes):
+            # Insert expanded by epsilon so that any box within epsilon shares a cell
+            try:
+                lo, hi = self._cell_range(origin, extent, self.epsilon)
+            except (OverflowError, ValueError):
+                # Non-finite bounds - always a candidate
+                self._large.append(key)
+                continue
+            cell_count = (hi[0] - lo[0] + 1) * (hi[1] - lo[1] + 1) * (hi[2] - lo[2] + 1)
+            if cell_count > self.MAX_CELLS_PER_BOX:
+                self._large.append(key)
+                continue
+            for cx in range(lo[0], hi[0] + 1):
+                for cy in range(lo[1], hi[1] + 1):
+                    for cz in range(lo[2], hi[2] + 1):
+                        self._cells.setdefault((cx, cy, cz), []).append(key)
+
+    def _cell_range(self, origin, extent, pad):
+        """Return (min_cell, max_cell) integer coordinates covered by a padded box."""
+        size = self.cell_size
+        lo = tuple(math.floor((origin[i] - extent[i] - pad) / size) for i in range(3))
+        hi = tuple(math.floor((origin[i] + extent[i] + pad) / size) for i in range(3))
+        return lo, hi
+
+    def query(self, origin, extent):
+        """
+        Get candidate boxes that may intersect the given box.
+
+        Args:
+            origin: Box center (unreal.Vector or tuple)
+            extent: Box half-extents (unreal.Vector or tuple)
+
+        Returns:
+            Sorted list of candidate keys (box indices)
+        """
+        origin = _to_tuple(origin)
+        extent = _to_tuple(extent)
+        try:
+            lo, hi = self._cell_range(origin, extent, 0.0)
+        except (OverflowError, ValueError):
+            return list(range(len(self._boxes)))
+
+        candidates = set(self._large)
+        cell_count = (hi[0] - lo[0] + 1) * (hi[1] - lo[1] + 1) * (hi[2] - lo[2] + 1)
+        if cell_count > len(self._cells):
+            # Query box covers more cells than are occupied - scan occupied cells instead
+            for (cx, cy, cz), keys in self._cells.items():
+                if lo[0] <= cx <= hi[0] and lo[1] <= cy <= hi[1] and lo[2] <= cz <= hi[2]:
+                    candidates.update(keys)
+        else:
+            for cx in range(lo[0], hi[0] + 1):
+                for cy in range(lo[1], hi[1] + 1):
+                    for cz in range(lo[2], hi[2] + 1):
+                        keys = self._cells.get((cx, cy, cz))
+                        if keys:
+                            candidates.update(keys)
+        return sorted(candidates)
+
+    def query_key(self, key):
+        """
+        Get candidate boxes that may intersect the box with the given key.
+
+        Returns:
+            Sorted list of candidate keys, excluding key itself
+        """
+        origin, extent = self._boxes[key]
+        return [k for k in self.query(origin, extent) if k != key]
+
+
 def is_horizontal_orientation(actor, tolerance_degrees=5.0):
     """
     Check if an actor is oriented horizontally (facing forward, not tilted).
@@ -1,17 +1,13 @@
-"""
-Asset snapshot script for UE-MCP.
-
-Takes a snapshot of assets in specified directories, including their types and
-filesystem timestamps. Runs inside UE5 editor.
-
-MCP mode (sys.argv):
-    paths: list[str] - Directory paths to scan (e.g., ["/Game/Maps/", "/Game/Blueprints/"])
-    project_dir: str - Project directory path for filesystem path conversion
-"""
-import argparse
-import json
+# Asset snapshot helpers for UE5
+#
+# Lists assets under directories with their types and filesystem timestamps, so
+# two snapshots taken around an execution reveal created, deleted and modified
+# assets. Level assets also account for their OFPA __ExternalActors__ and
+# __ExternalObjects__ files.
+#
+# Used by execution_tracking.
+
 import os
-import sys
 import time
 
 import unreal
@@ -45,37 +41,6 @@ _ASSET_TYPE_MAP = {
 }
 
 
-def parse_args():
-    """Parse command-line arguments."""
-    parser = argparse.ArgumentParser(
-        description="Take a snapshot of assets in specified directories"
-    )
-    parser.add_argument(
-        "--paths",
-        required=True,
-        help="JSON array of directory paths to scan (e.g., '[\"/ Game/Maps/\", \"/Game/Blueprints/\"]')"
-    )
-    parser.add_argument(
-        "--project-dir",
-        required=True,
-        help="Project directory path for filesystem path conversion"
-    )
-    args = parser.parse_args()
-
-    # Parse JSON paths parameter
-    try:
-        paths_list = json.loads(args.paths)
-        if not isinstance(paths_list, list):
-            raise ValueError("--paths must be a JSON array")
-    except json.JSONDecodeError as e:
-        raise ValueError(f"Invalid JSON for --paths: {e}")
-
-    return {
-        "paths": paths_list,
-        "project_dir": args.project_dir
-    }
-
-
 def get_asset_type(asset_path: str) -> str:
     """Get the asset type from asset data."""
     try:
@@ -329,36 +294,3 @@ def take_snapshot(paths: list[str], project_dir: str) -> dict:
             print(f"Warning: Failed to scan {scan_path}: {e}")
 
     return result
-
-
-def main():
-    """Main entry point."""
-    params = parse_args()
-
-    paths = params.get("paths", [])
-    project_dir = params.get("project_dir", "")
-
-    if not paths:
-        print("SNAPSHOT_RESULT:" + json.dumps({
-            "error": "No paths specified",
-            "timestamp": time.time(),
-            "scanned_paths": [],
-            "assets": {},
-        }))
-        return
-
-    if not project_dir:
-        print("SNAPSHOT_RESULT:" + json.dumps({
-            "error": "No project_dir specified",
-            "timestamp": time.time(),
-            "scanned_paths": paths,
-            "assets": {},
-        }))
-        return
-
-    snapshot = take_snapshot(paths, project_dir)
-    print("SNAPSHOT_RESULT:" + json.dumps(snapshot))
-
-
-# Execute main
-main()
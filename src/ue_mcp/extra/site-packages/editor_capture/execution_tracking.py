@@ -0,0 +1,379 @@
+# Execution change tracking for UE-MCP
+#
+# Captures everything the MCP server needs to report asset and actor changes of
+# an execution in one call before it and one call after it:
+#
+#   capture_pre_execution()   current level, asset journal cursor (or asset
+#                             snapshot), actor journal cursor (or actor snapshot)
+#   capture_post_execution()  asset/actor changes since the cursors (or the
+#                             matching snapshots), dirty packages; refreshes the
+#                             Slate UI when the journals or dirty packages show
+#                             changes
+#
+# run_tracked() wraps user code between the two, so a tracked execute_code is a
+# single remote request. Snapshots are compared by the server
+# (ue_mcp.tracking.execution_tracking), which also reads packed actor snapshots.
+#
+# Tracking failures are reported in the state instead of raised, so they never
+# stop the user code from running.
+
+import sys
+import time
+
+import unreal
+
+from .asset_snapshot import take_snapshot
+from .result_file import write_result_file
+
+
+# ============================================
+# CURRENT LEVEL / DIRTY PACKAGES
+# ============================================
+
+def get_current_level_dir():
+    """
+    Directory of the currently loaded level (e.g. "/Game/ThirdPerson/Maps/").
+
+    Returns:
+        Directory path, or None if no level under /Game/ is loaded
+    """
+    editor_sub = unreal.get_editor_subsystem(unreal.UnrealEditorSubsystem)
+    world = editor_sub.get_editor_world()
+    level = world.get_outer() if world else None
+    path = level.get_path_name() if level else ""
+    level = None
+    world = None
+
+    # Only paths under /Game/ (not temp levels)
+    if not path.startswith("/Game/"):
+        return None
+    parts = path.rstrip("/").split("/")
+    if len(parts) >= 3:
+        return "/".join(parts[:-1]) + "/"
+    return path.rstrip("/") + "/"
+
+
+def get_dirty_asset_paths():
+    """Paths of packages with unsaved changes (content and maps)."""
+    try:
+        packages = list(unreal.EditorLoadingAndSavingUtils.get_dirty_content_packages())
+        packages += list(unreal.EditorLoadingAndSavingUtils.get_dirty_map_packages())
+    except AttributeError:
+        # EditorLoadingAndSavingUtils may not have these methods in all UE versions
+        return []
+    return [pkg.get_path_name() for pkg in packages if pkg]
+
+
+def refresh_slate_view():
+    """Refresh the editor UI so changes made by code show up immediately."""
+    if hasattr(unreal, "ExSlateTabLibrary"):
+        unreal.ExSlateTabLibrary.refresh_slate_view()
+
+
+# ============================================
+# CHANGE JOURNALS
+# ============================================
+
+def get_asset_journal_cursor():
+    """Current asset change journal sequence, or None if the journal is unavailable."""
+    if not hasattr(unreal, "ExAssetChangeJournalLibrary"):
+        return None
+    sequence = unreal.ExAssetChangeJournalLibrary.get_current_sequence()
+    return sequence if sequence >= 0 else None
+
+
+def get_asset_changes_since(cursor, paths):
+    """Sorted asset paths created, deleted, renamed or saved under paths since cursor."""
+    complete, changes, assets = unreal.ExAssetChangeJournalLibrary.get_asset_changes_since(
+        cursor, paths, False
+    )
+    changes = None
+    return sorted(str(a) for a in assets)
+
+
+def get_actor_journal_cursor():
+    """Current actor change journal sequence, or None if the journal is unavailable."""
+    if not hasattr(unreal, "ExActorChangeJournalLibrary"):
+        return None
+    sequence = unreal.ExActorChangeJournalLibrary.get_current_sequence()
+    return sequence if sequence >= 0 else None
+
+
+def get_actor_changes_since(cursor):
+    """
+    Actors changed since cursor, grouped by level.
+
+    Returns:
+        {"complete": bool, "levels": {level_asset_path: [actor_paths]}}
+    """
+    complete, changes, levels = unreal.ExActorChangeJournalLibrary.get_actor_changes_since(cursor)
+    changed_levels = {str(level): [] for level in levels}
+    for change in changes:
+        actors = changed_levels.setdefault(change.level_path, [])
+        if change.actor_path not in actors:
+            actors.append(change.actor_path)
+    changes = None
+    return {"complete": complete, "levels": changed_levels}
+
+
+# ============================================
+# ACTOR SNAPSHOT
+# ============================================
+
+def snapshot_level_actors(packed_file=None, class_filter=(), folder_filter=""):
+    """
+    Snapshot the actors of the current level.
+
+    With ExLevelSnapshotLibrary the actors are written natively to packed_file and
+    only a summary is returned; otherwise they are collected in Python.
+
+    Args:
+        packed_file: Output file for the native snapshot (None = always use Python)
+        class_filter: Actor class names to include; empty = all
+        folder_filter: Outliner folder; only actors in it or its subfolders are included
+
+    Both filters ignore case, like the FString comparisons of the native path.
+
+    Returns:
+        {"packed_file", "asset_path", "actor_count", "current_level"} (native),
+        {"levels": {...}, "current_level"} (Python), or {"error": ...}
+    """
+    folder_filter = (folder_filter or "").rstrip("/")
+
+    # Initialize variables for cleanup in finally block
+    world = None
+    current_level = None
+    all_actors = None
+    try:
+        editor_sub = unreal.get_editor_subsystem(unreal.UnrealEditorSubsystem)
+        actor_sub = unreal.get_editor_subsystem(unreal.EditorActorSubsystem)
+        world = editor_sub.get_editor_world()
+        if not world:
+            return {"error": "No world loaded"}
+
+        current_level = world.get_outer()
+        current_level_path = current_level.get_path_name() if current_level else "Unknown"
+
+        # Extract asset path from full level path (remove .LevelName:PersistentLevel suffix)
+        current_asset_path = (
+            current_level_path.split(".")[0] if "." in current_level_path else current_level_path
+        )
+
+        # Note: Streaming level snapshot not supported - UE5 Python API doesn't expose
+        # Level.get_level_actors() or World.get_streaming_levels() for sub-level access.
+        # Only the current persistent level is snapshotted.
+
+        if packed_file and hasattr(unreal, "ExLevelSnapshotLibrary"):
+            actor_count = unreal.ExLevelSnapshotLibrary.write_level_actor_snapshot(
+                world, packed_file, list(class_filter), folder_filter
+            )
+            if actor_count < 0:
+                return {"error": "ExLevelSnapshotLibrary failed to write snapshot"}
+            return {
+                "packed_file": packed_file,
+                "asset_path": current_asset_path,
+                "actor_count": actor_count,
+                "current_level": current_level_path,
+            }
+
+        class_set = {name.casefold() for name in class_filter}
+        folder_key = folder_filter.casefold()
+        all_actors = actor_sub.get_all_level_actors()
+        actors_data = {}
+        for actor in all_actors:
+            try:
+                class_name = actor.get_class().get_name()
+                if class_set and class_name.casefold() not in class_set:
+                    continue
+                if folder_key:
+                    folder = str(actor.get_folder_path()).casefold()
+                    if folder != folder_key and not folder.startswith(folder_key + "/"):
+                        continue
+                loc = actor.get_actor_location()
+                rot = actor.get_actor_rotation()
+                scale = actor.get_actor_scale3d()
+                actors_data[actor.get_path_name()] = {
+                    "label": actor.get_actor_label(),
+                    "class": class_name,
+                    "location": [loc.x, loc.y, loc.z],
+                    "rotation": [rot.pitch, rot.yaw, rot.roll],
+                    "scale": [scale.x, scale.y, scale.z],
+                }
+            except Exception:
+                pass
+
+        return {
+            "levels": {
+                current_asset_path: {
+                    "level_path": current_level_path,
+                    "actor_count": len(actors_data),
+                    "actors": actors_data,
+                }
+            },
+            "current_level": current_level_path,
+        }
+    except Exception as e:
+        return {"error": str(e)}
+    finally:
+        # Clean up references to prevent World memory leaks
+        all_actors = None
+        current_level = None
+        world = None
+
+
+# ============================================
+# PRE / POST EXECUTION
+# ============================================
+
+def capture_pre_execution(game_paths, project_dir, packed_file=None):
+    """
+    Capture the tracking state before an execution.
+
+    Args:
+        game_paths: Asset directories referenced by the code (the current level's
+                    directory is added automatically)
+        project_dir: Project directory, for asset file timestamps
+        packed_file: Output file for a native actor snapshot
+
+    Returns:
+        {"game_paths", "asset_cursor" | "asset_snapshot", "actor_cursor" | "actor_snapshot"}
+        plus "errors" for parts that could not be captured
+    """
+    state = {"errors": []}
+    paths = list(game_paths)
+    try:
+        level_dir = get_current_level_dir()
+        if level_dir and level_dir not in paths:
+            paths.append(level_dir)
+    except Exception as e:
+        state["errors"].append(f"current level: {e}")
+    state["game_paths"] = paths
+
+    if paths:
+        try:
+            cursor = get_asset_journal_cursor()
+            if cursor is not None:
+                state["asset_cursor"] = cursor
+            else:
+                state["asset_snapshot"] = take_snapshot(paths, project_dir)
+        except Exception as e:
+            state["errors"].append(f"assets: {e}")
+
+    try:
+        cursor = get_actor_journal_cursor()
+        if cursor is not None:
+            state["actor_cursor"] = cursor
+        else:
+            state["actor_snapshot"] = snapshot_level_actors(packed_file)
+    except Exception as e:
+        state["errors"].append(f"actors: {e}")
+    return state
+
+
+def capture_post_execution(pre, project_dir, packed_file=None):
+    """
+    Capture the tracking state after an execution, matching a pre-execution state.
+
+    Args:
+        pre: Result of capture_pre_execution()
+        project_dir: Project directory, for asset file timestamps
+        packed_file: Output file for a native actor snapshot (not the pre one)
+
+    Returns:
+        {"asset_changes" | "asset_snapshot", "actor_changes" | "actor_snapshot",
+         "dirty_assets", "refreshed"} plus "errors"
+    """
+    post = {"errors": []}
+    try:
+        if "asset_cursor" in pre:
+            post["asset_changes"] = get_asset_changes_since(pre["asset_cursor"], pre["game_paths"])
+        elif "asset_snapshot" in pre:
+            post["asset_snapshot"] = take_snapshot(pre["game_paths"], project_dir)
+    except Exception as e:
+        post["errors"].append(f"assets: {e}")
+
+    try:
+        if "actor_cursor" in pre:
+            post["actor_changes"] = get_actor_changes_since(pre["actor_cursor"])
+        elif "actor_snapshot" in pre:
+            post["actor_snapshot"] = snapshot_level_actors(packed_file)
+    except Exception as e:
+        post["errors"].append(f"actors: {e}")
+
+    try:
+        post["dirty_assets"] = get_dirty_asset_paths()
+    except Exception as e:
+        post["dirty_assets"] = []
+        post["errors"].append(f"dirty packages: {e}")
+
+    # Changes the journals already know about; snapshot changes are only known to
+    # the server, which refreshes itself when the editor did not
+    known_changes = (
+        post["dirty_assets"]
+        or post.get("asset_changes")
+        or (post.get("actor_changes") or {}).get("levels")
+    )
+    post["refreshed"] = False
+    if known_changes:
+        try:
+            refresh_slate_view()
+            post["refreshed"] = True
+        except Exception as e:
+            post["errors"].append(f"refresh: {e}")
+    return post
+
+
+def run_tracked(code, options, globals_dict, prelude=""):
+    """
+    Run user code between pre- and post-execution tracking in one request.
+
+    The code is compiled on its own, so its line numbers in tracebacks are the
+    same as when it runs untracked. If it raises, the exception propagates and no
+    tracking result is written (tracking only reports successful executions).
+
+    A single expression is evaluated instead of executed, so its value is not lost:
+    like the statement path, it is echoed through sys.displayhook, and it is
+    returned and stored (as its repr) under "value".
+
+    Args:
+        code: User code
+        options: {"result_file", "game_paths", "project_dir", "packed_files": [pre, post]}
+        globals_dict: Namespace the code runs in (the caller's globals())
+        prelude: Code run before the user code (bundled module unloading)
+
+    The result file holds {"pre", "post", "timings": {"pre_capture", "post_capture"}},
+    plus "value" for an expression.
+
+    Returns:
+        The expression's value, or None for statements
+    """
+    pre_packed, post_packed = options.get("packed_files") or (None, None)
+    start = time.perf_counter()
+    pre = capture_pre_execution(options["game_paths"], options["project_dir"], pre_packed)
+    pre_done = time.perf_counter()
+
+    if prelude:
+        exec(compile(prelude, "<ue_mcp>", "exec"), globals_dict)
+    try:
+        expression = compile(code, "<string>", "eval")
+    except SyntaxError:
+        expression = None
+    value = None
+    if expression is not None:
+        value = eval(expression, globals_dict)
+        sys.displayhook(value)
+    else:
+        exec(compile(code, "<string>", "exec"), globals_dict)
+
+    post_start = time.perf_counter()
+    post = capture_post_execution(pre, options["project_dir"], post_packed)
+    # Capture durations (seconds), so the server can split the request time
+    timings = {
+        "pre_capture": pre_done - start,
+        "post_capture": time.perf_counter() - post_start,
+    }
+    states = {"pre": pre, "post": post, "timings": timings}
+    if expression is not None:
+        states["value"] = repr(value)
+    write_result_file(options["result_file"], states)
+    return value
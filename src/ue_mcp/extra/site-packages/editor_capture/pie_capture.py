@@ -25,6 +25,9 @@
 #       target_height=90
 #   )
 #
+#   # Sequential multi-angle mode (one view per frame through the viewport)
+#   capturer = pie_capture.start_pie_capture(auto_start_pie=True, single_frame=False)
+#
 #   # Stop capturer
 #   pie_capture.stop_pie_capture()
 #
@@ -38,6 +41,8 @@ import os
 import json
 from datetime import datetime
 
+from .scene_capture import SceneCaptureRig
+
 
 # ============================================
 # VIEW CONFIGURATIONS
@@ -171,6 +176,7 @@ class PIECapturer:
         duration=None,
         auto_stop_pie=True,
         task_id=None,
+        single_frame=True,
     ):
         """
         Initialize the PIE capturer.
@@ -189,6 +195,9 @@ class PIECapturer:
             duration: Auto-stop after this many seconds (None = run indefinitely)
             auto_stop_pie: Whether to stop PIE session when duration is reached
             task_id: Unique task identifier for completion file (used by MCP server)
+            single_frame: In multi-angle mode, render all views in one frame through a
+                          SceneCapture2D (default: True). False takes one high-res
+                          screenshot per view, one view after another.
         """
         # Set output directory
         if output_dir is None:
@@ -206,6 +215,7 @@ class PIECapturer:
         self.duration = duration
         self.auto_stop_pie = auto_stop_pie
         self.task_id = task_id
+        self.single_frame = single_frame
 
         # State variables
         self._tick_handle = None
@@ -217,6 +227,7 @@ class PIECapturer:
         self._pending_task = None
         self._is_in_pie = False
         self._camera_actor = None
+        self._capture_rig = None  # SceneCaptureRig for single-frame multi-angle capture
 
         # Multi-angle state machine
         self._current_angle_index = 0
@@ -264,11 +275,14 @@ class PIECapturer:
         pie_worlds = unreal.EditorLevelLibrary.get_pie_worlds(False)
         pie_already_running = len(pie_worlds) > 0
 
-        # Pre-create camera for multi-angle mode (must be done BEFORE PIE starts)
-        # If PIE is already running, camera spawn will fail and we'll fallback to single-angle
+        # Pre-create scene capture or camera for multi-angle mode (must be done BEFORE PIE
+        # starts). If PIE is already running, spawning fails and we fallback to single-angle
         if self.multi_angle and not pie_already_running:
-            self._create_camera()
-            if self._camera_actor is None:
+            if self.single_frame:
+                self._create_capture_rig()
+            if self._capture_rig is None:
+                self._create_camera()
+            if self._capture_rig is None and self._camera_actor is None:
                 unreal.log_warning(
                     "[WARNING] Failed to create camera, falling back to single-angle mode"
                 )
@@ -277,14 +291,19 @@ class PIECapturer:
         # Handle late start if PIE already running
         if pie_already_running:
             unreal.log("[INFO] PIE already running, starting capture immediately")
-            if self.multi_angle and self._camera_actor is None:
+            if self.multi_angle and self._camera_actor is None and self._capture_rig is None:
                 unreal.log_warning(
                     "[WARNING] Cannot create camera during PIE, using single-angle mode"
                 )
                 self.multi_angle = False
             self._on_pie_started(False)
 
-        mode_str = f"Multi-angle ({len(self.views)} views)" if self.multi_angle else "Single view"
+        if not self.multi_angle:
+            mode_str = "Single view"
+        elif self._capture_rig is not None:
+            mode_str = f"Multi-angle ({len(self.views)} views, single frame)"
+        else:
+            mode_str = f"Multi-angle ({len(self.views)} views)"
         unreal.log(f"[OK] PIE capturer started - Mode: {mode_str}")
         unreal.log(f"[INFO] Interval: {self.interval_seconds}s, Resolution: {self.resolution}")
         if self.multi_angle:
@@ -325,6 +344,12 @@ class PIECapturer:
                 pass  # Camera already destroyed (e.g., when PIE ended)
             self._camera_actor = None
 
+        # Wait for queued screenshot writes, then destroy the scene capture
+        if self._capture_rig is not None:
+            self._capture_rig.collect(wait=True)
+            self._capture_rig.destroy()
+            self._capture_rig = None
+
         self._is_in_pie = False
         unreal.log(f"[OK] PIE capturer stopped - Total screenshots: {self._screenshot_count}")
 
@@ -344,6 +369,16 @@ class PIECapturer:
         else:
             unreal.log_error("[ERROR] Failed to create camera actor")
 
+    def _create_capture_rig(self):
+        """Create the SceneCapture2D rig for single-frame multi-angle capture."""
+        rig = SceneCaptureRig("PIE_Screenshot_SceneCapture", self.resolution)
+        if rig.create():
+            self._capture_rig = rig
+            unreal.log(f"[OK] Created screenshot scene capture ({rig.backend} writes)")
+        else:
+            rig.destroy()
+            unreal.log_warning("[WARNING] Failed to create scene capture, using camera instead")
+
     def _on_pie_started(self, is_simulating):
         """Called when PIE session starts."""
         if not self._is_running:
@@ -390,6 +425,12 @@ class PIECapturer:
                 pass  # Camera already destroyed
             self._camera_actor = None
 
+        # The PIE duplicate of the scene capture goes away with PIE; the editor actor
+        # stays for the next session
+        if self._capture_rig is not None:
+            self._capture_rig.collect(wait=True)
+            self._capture_rig.detach()
+
         unreal.log("[INFO] PIE ended - pausing capture")
 
     def _find_target_actor(self, pie_world):
@@ -599,6 +640,10 @@ class PIECapturer:
             self._auto_complete()
             return
 
+        # Collect finished async screenshot writes
+        if self._capture_rig is not None:
+            self._capture_rig.collect()
+
         # Check for pending screenshot task
         if self._pending_task is not None:
             if self._pending_task.is_task_done():
@@ -629,7 +674,9 @@ class PIECapturer:
 
             pie_world = pie_worlds[0]
 
-            if self.multi_angle:
+            if self.multi_angle and self._capture_rig is not None:
+                self._capture_all_angles(pie_world)
+            elif self.multi_angle:
                 self._start_multi_angle_capture(pie_world)
             else:
                 self._take_single_screenshot()
@@ -659,6 +706,43 @@ class PIECapturer:
         self._screenshot_count += 1
         unreal.log(f"[OK] Screenshot #{self._screenshot_count}: {os.path.basename(filename)}")
 
+    def _capture_all_angles(self, pie_world):
+        """
+        Capture every angle within the current frame using the scene capture rig.
+
+        All views show the same moment, and a set costs one frame instead of one
+        frame (plus a high-res screenshot task) per view.
+        """
+        # Get target location (may return error if target_actor not found)
+        target, error = self._get_target_location(pie_world)
+        if error:
+            # Target actor not found - fail with error
+            self._fail_with_error(error)
+            return
+
+        try:
+            if not self._capture_rig.is_attached:
+                self._capture_rig.attach_to_pie()
+        except RuntimeError as e:
+            unreal.log_error(f"[ERROR] {e}, taking single-angle screenshot")
+            self._take_single_screenshot()
+            return
+
+        timestamp = datetime.now().strftime("%Y%m%d_%H%M%S")
+        for view_config in self.views:
+            cam_pos, cam_rot = _calculate_pie_camera_transform(
+                target, view_config, self.camera_distance, self.target_height
+            )
+            filename = os.path.join(
+                self.output_dir,
+                f"PIE_Screenshot_{timestamp}_{self._screenshot_count:04d}_{view_config['name']}.png",
+            )
+            if self._capture_rig.capture(cam_pos, cam_rot, filename):
+                unreal.log(f"[OK] Screenshot {view_config['name']}: {os.path.basename(filename)}")
+
+        self._screenshot_count += 1
+        unreal.log(f"[OK] Completed set #{self._screenshot_count} ({len(self.views)} angles)")
+
     def _start_multi_angle_capture(self, pie_world):
         """Start multi-angle capture sequence."""
         if self._camera_actor is None:
@@ -847,6 +931,7 @@ def start_pie_capture(
     duration=None,
     auto_stop_pie=True,
     task_id=None,
+    single_frame=True,
 ):
     """
     Start PIE screenshot capturer.
@@ -865,6 +950,7 @@ def start_pie_capture(
         duration: Auto-stop after this many seconds (None = run indefinitely)
         auto_stop_pie: Whether to stop PIE session when duration is reached
         task_id: Unique task identifier for completion file (used by MCP server)
+        single_frame: Render all angles of a set within one frame (multi-angle mode only)
 
     Returns:
         PIECapturer instance
@@ -886,6 +972,7 @@ def start_pie_capture(
         duration=duration,
         auto_stop_pie=auto_stop_pie,
         task_id=task_id,
+        single_frame=single_frame,
     )
     _capturer_instance.start()
 
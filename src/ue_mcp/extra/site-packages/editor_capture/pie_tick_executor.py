@@ -6,9 +6,12 @@
 import unreal
 import os
 import json
+import hashlib
+import time
 from datetime import datetime
 from io import StringIO
 import sys
+import types
 
 
 # ============================================
@@ -60,6 +63,15 @@ def _stop_pie_session():
     return True
 
 
+def _relabel_code(code_obj, filename):
+    """Copy of a code object (and its nested code objects) reporting another filename."""
+    consts = tuple(
+        _relabel_code(const, filename) if isinstance(const, types.CodeType) else const
+        for const in code_obj.co_consts
+    )
+    return code_obj.replace(co_filename=filename, co_consts=consts)
+
+
 # ============================================
 # PIE TICK EXECUTOR CLASS
 # ============================================
@@ -74,27 +86,34 @@ class PIETickExecutor:
         auto_stop_pie=True,
         task_id=None,
         on_before_complete=None,
+        on_pie_ended=None,
     ):
         """
         Initialize the PIE tick executor.
 
         Args:
-            total_ticks: Total number of ticks to run PIE
-            code_snippets: List of code snippet configurations, each with:
+            total_ticks: Total number of ticks to run PIE, or None for an open budget
+                (runs until a snippet calls __executor__._auto_complete())
+            code_snippets: List of code snippet configurations (compiled once up front), each with:
                 - code: Python code string to execute
                 - start_tick: Tick number to start execution (0-indexed)
-                - execution_count: Number of consecutive ticks to execute (default: 1)
+                - execution_count: Number of consecutive ticks to execute (default: 1),
+                  or None for every tick until the executor completes
             auto_stop_pie: Whether to stop PIE session when total_ticks reached
             task_id: Unique task identifier for completion file (used by MCP server)
             on_before_complete: Callback function called before stopping PIE.
                                 Signature: callback(executor) -> None
                                 Use this to save data before PIE stops.
+            on_pie_ended: Callback function called when PIE ends before completion
+                          (e.g. stopped by the user), which only pauses execution.
+                          Signature: callback(executor) -> None
         """
         self.total_ticks = total_ticks
         self.code_snippets = code_snippets
         self.auto_stop_pie = auto_stop_pie
         self.task_id = task_id
         self.on_before_complete = on_before_complete
+        self.on_pie_ended = on_pie_ended
 
         # State variables
         self._tick_handle = None
@@ -106,8 +125,22 @@ class PIETickExecutor:
         self._is_complete = False
         self._result = None
 
-        # Build execution schedule: {tick_number: [(snippet_index, code), ...]}
-        self._schedule = self._build_schedule()
+        # Compile cache: {content_hash: (code_object, compile_error_message)}
+        self._compiled = {}
+
+        # Per-snippet code, labelled with the snippet's own index:
+        # {snippet_index: (code_object, compile_error_message)}
+        self._snippet_code = {}
+
+        # Snippets whose compile error has been recorded (reported once, then skipped)
+        self._reported_compile_errors = set()
+
+        # Per-snippet timing: {snippet_index: {compile_ms, exec_count, exec_total_ms, exec_max_ms}}
+        self._snippet_timings = {}
+
+        # Build execution schedule: {tick_number: [snippet_index, ...]},
+        # plus the open-ended snippets: [(start_tick, snippet_index), ...]
+        self._schedule, self._open_schedule = self._build_schedule()
 
         # Execution results
         self._executions = []
@@ -123,22 +156,77 @@ class PIETickExecutor:
         """
         Build execution schedule from code snippets.
 
+        Each snippet is compiled once here (deduplicated by content hash), so
+        every-tick snippets are not re-parsed on each frame.
+
         Returns:
-            dict: {tick_number: [(snippet_index, code), ...]}
+            tuple: ({tick_number: [snippet_index, ...]},
+                    [(start_tick, snippet_index), ...] for snippets with
+                    execution_count None)
         """
         schedule = {}
+        open_schedule = []
         for idx, snippet in enumerate(self.code_snippets):
             code = snippet.get("code", "")
             start_tick = snippet.get("start_tick", 0)
             execution_count = snippet.get("execution_count", 1)
 
+            self._compile_snippet(idx, code)
+
+            if execution_count is None:
+                open_schedule.append((start_tick, idx))
+                continue
+
             for i in range(execution_count):
                 tick = start_tick + i
                 if tick not in schedule:
                     schedule[tick] = []
-                schedule[tick].append((idx, code))
+                schedule[tick].append(idx)
 
-        return schedule
+        return schedule, open_schedule
+
+    def _compile_snippet(self, snippet_index, code):
+        """
+        Compile a snippet (once per distinct code) and record its compile time.
+
+        Identical snippets share the compiled code, relabelled with each snippet's
+        own index. Compile errors are stored and reported the first time the
+        snippet is scheduled, the same way runtime errors are.
+
+        Args:
+            snippet_index: Index of the snippet in original list
+            code: Python code string
+        """
+        code_hash = hashlib.sha1(code.encode("utf-8")).hexdigest()
+        compile_ms = 0.0
+        filename = f"<pie_snippet_{snippet_index}>"
+
+        if code_hash not in self._compiled:
+            start = time.perf_counter()
+            try:
+                compiled = (compile(code, filename, "exec"), None)
+            except (SyntaxError, ValueError) as e:
+                # ValueError: source with null bytes
+                error = f"{type(e).__name__}: {getattr(e, 'msg', None) or e}"
+                if getattr(e, "lineno", None):
+                    error += f" (line {e.lineno})"
+                compiled = (None, error)
+            compile_ms = (time.perf_counter() - start) * 1000.0
+            self._compiled[code_hash] = compiled
+
+        code_obj, compile_error = self._compiled[code_hash]
+        if code_obj is not None and code_obj.co_filename != filename:
+            code_obj = _relabel_code(code_obj, filename)
+        self._snippet_code[snippet_index] = (code_obj, compile_error)
+        if compile_error is not None:
+            unreal.log_error(f"[ERROR] Snippet {snippet_index} failed to compile: {compile_error}")
+
+        self._snippet_timings[snippet_index] = {
+            "compile_ms": round(compile_ms, 3),
+            "exec_count": 0,
+            "exec_total_ms": 0.0,
+            "exec_max_ms": 0.0,
+        }
 
     def start(self):
         """Start the executor."""
@@ -153,6 +241,9 @@ class PIETickExecutor:
         self._result = None
         self._executions = []
         self._errors = []
+        self._reported_compile_errors = set()
+        for timing in self._snippet_timings.values():
+            timing.update(exec_count=0, exec_total_ms=0.0, exec_max_ms=0.0)
 
         # Reset shared context
         self._exec_context = {
@@ -172,7 +263,8 @@ class PIETickExecutor:
         self._pie_begin_handle = editor_utility.on_begin_pie.add_callable(self._on_pie_started)
         self._pie_end_handle = editor_utility.on_end_pie.add_callable(self._on_pie_ended)
 
-        unreal.log(f"[OK] PIE tick executor started - {len(self.code_snippets)} snippets, {self.total_ticks} total ticks")
+        budget = "open tick budget" if self.total_ticks is None else f"{self.total_ticks} total ticks"
+        unreal.log(f"[OK] PIE tick executor started - {len(self.code_snippets)} snippets, {budget}")
 
     def stop(self):
         """Stop the executor."""
@@ -233,6 +325,12 @@ class PIETickExecutor:
 
         unreal.log("[INFO] PIE ended - pausing execution")
 
+        if self.on_pie_ended and not self._is_complete:
+            try:
+                self.on_pie_ended(self)
+            except Exception as e:
+                unreal.log_error(f"[ERROR] on_pie_ended callback failed: {e}")
+
     def _on_tick(self, delta_time):
         """Tick callback function - only called when PIE is running."""
         if not self._is_running or not self._is_in_pie:
@@ -240,25 +338,37 @@ class PIETickExecutor:
 
         # Execute scheduled code for current tick
         if self._tick_count in self._schedule:
-            for snippet_index, code in self._schedule[self._tick_count]:
-                self._execute_code(snippet_index, self._tick_count, code)
+            for snippet_index in self._schedule[self._tick_count]:
+                self._execute_code(snippet_index, self._tick_count)
+        for start_tick, snippet_index in self._open_schedule:
+            if self._tick_count >= start_tick and not self._is_complete:
+                self._execute_code(snippet_index, self._tick_count)
 
         # Increment tick count
         self._tick_count += 1
 
         # Check if total ticks reached - auto stop
-        if self._tick_count >= self.total_ticks:
+        if self.total_ticks is not None and self._tick_count >= self.total_ticks:
             self._auto_complete()
 
-    def _execute_code(self, snippet_index, tick, code):
+    def _execute_code(self, snippet_index, tick):
         """
-        Execute a code snippet.
+        Execute a precompiled code snippet.
+
+        A snippet that failed to compile records its error the first time it is
+        scheduled and is skipped afterwards.
 
         Args:
             snippet_index: Index of the snippet in original list
             tick: Current tick number
-            code: Python code string to execute
         """
+        code_obj, compile_error = self._snippet_code[snippet_index]
+        if compile_error is not None:
+            if snippet_index not in self._reported_compile_errors:
+                self._reported_compile_errors.add(snippet_index)
+                self._record_execution(snippet_index, tick, "", 0.0, compile_error)
+            return
+
         # Add current tick info to context
         self._exec_context["__tick__"] = tick
         self._exec_context["__snippet_index__"] = snippet_index
@@ -270,25 +380,40 @@ class PIETickExecutor:
         success = True
         error_msg = None
 
+        start = time.perf_counter()
         try:
-            exec(code, self._exec_context)
+            exec(code_obj, self._exec_context)
         except Exception as e:
             success = False
             error_msg = str(e)
             unreal.log_error(f"[ERROR] Snippet {snippet_index} at tick {tick} failed: {e}")
+        exec_ms = (time.perf_counter() - start) * 1000.0
 
         # Restore stdout and get output
         sys.stdout = old_stdout
         output = captured_output.getvalue()
 
-        # Record execution result
+        # Update per-snippet timing
+        timing = self._snippet_timings[snippet_index]
+        timing["exec_count"] += 1
+        timing["exec_total_ms"] += exec_ms
+        timing["exec_max_ms"] = max(timing["exec_max_ms"], exec_ms)
+
+        self._record_execution(snippet_index, tick, output, exec_ms, error_msg)
+
+        if success:
+            unreal.log(f"[OK] Executed snippet {snippet_index} at tick {tick}")
+
+    def _record_execution(self, snippet_index, tick, output, exec_ms, error_msg=None):
+        """Record an execution result (and its error, if any)."""
         result = {
             "snippet_index": snippet_index,
             "tick": tick,
-            "success": success,
+            "success": error_msg is None,
             "output": output,
+            "exec_ms": round(exec_ms, 3),
         }
-        if error_msg:
+        if error_msg is not None:
             result["error"] = error_msg
             self._errors.append({
                 "snippet_index": snippet_index,
@@ -298,15 +423,12 @@ class PIETickExecutor:
 
         self._executions.append(result)
 
-        if success:
-            unreal.log(f"[OK] Executed snippet {snippet_index} at tick {tick}")
-
     def _auto_complete(self):
-        """Auto-complete when total ticks reached (called from tick callback)."""
+        """Auto-complete when total ticks reached or a snippet asks to (called from tick callback)."""
         if self._is_complete:
             return  # Already completed
 
-        unreal.log(f"[INFO] Total ticks ({self.total_ticks}) reached, auto-stopping...")
+        unreal.log(f"[INFO] Completing after {self._tick_count} ticks, auto-stopping...")
 
         # Build result
         self._result = {
@@ -316,6 +438,7 @@ class PIETickExecutor:
             "execution_count": len(self._executions),
             "executions": self._executions,
             "errors": self._errors,
+            "snippet_timings": self.get_snippet_timings(),
         }
 
         # Call on_before_complete callback (before stopping PIE)
@@ -361,11 +484,33 @@ class PIETickExecutor:
         Get the execution result.
 
         Returns:
-            dict with success, total_ticks, executed_ticks, executions, errors
-            or None if not complete
+            dict with success, total_ticks, executed_ticks, executions, errors,
+            snippet_timings or None if not complete
         """
         return self._result
 
+    def get_snippet_timings(self):
+        """
+        Get per-snippet compile and execution timing.
+
+        Returns:
+            list of dicts with snippet_index, compile_ms, exec_count,
+            exec_total_ms, exec_avg_ms and exec_max_ms
+        """
+        timings = []
+        for snippet_index in sorted(self._snippet_timings):
+            timing = self._snippet_timings[snippet_index]
+            count = timing["exec_count"]
+            timings.append({
+                "snippet_index": snippet_index,
+                "compile_ms": timing["compile_ms"],
+                "exec_count": count,
+                "exec_total_ms": round(timing["exec_total_ms"], 3),
+                "exec_avg_ms": round(timing["exec_total_ms"] / count, 3) if count else 0.0,
+                "exec_max_ms": round(timing["exec_max_ms"], 3),
+            })
+        return timings
+
     def get_context(self):
         """
         Get the shared execution context.
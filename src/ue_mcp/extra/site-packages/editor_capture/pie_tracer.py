@@ -4,14 +4,20 @@
 # runtime using PIETickExecutor for tick-based execution.
 #
 # Optionally captures screenshots of tracked actors at each sample interval.
+#
+# With fixed_step, PIE runs on a fixed-step clock (ExSimulationClockLibrary) as fast
+# as the machine allows, and timestamps are simulation time.
 
 import unreal
 import os
 import json
 import math
+import time
 from datetime import datetime
 
 from .pie_tick_executor import PIETickExecutor
+from .scene_capture import SceneCaptureRig
+from .trace_file import TRACE_FILE_NAME, TraceFileWriter
 
 
 # ============================================
@@ -26,6 +32,11 @@ PIE_TRACER_VIEWS = [
 ]
 
 
+# Values per actor per frame in ExActorTransformSampler.drain_samples() output
+# (matches UExActorTransformSampler::ValuesPerSample: location xyz, rotation pyr, velocity xyz)
+NATIVE_VALUES_PER_SAMPLE = 9
+
+
 def _ensure_output_directory(path):
     """
     Ensure output directory exists, creating it if necessary.
@@ -62,6 +73,13 @@ class PIETracer:
     # Assumed FPS for time-to-tick conversion
     ASSUMED_FPS = 60
 
+    # Native sampler ring buffer capacity (frames) and drain batch size
+    NATIVE_SAMPLER_CAPACITY = 1024
+    NATIVE_DRAIN_BATCH_FRAMES = 30
+
+    # Actor label of the tracer's SceneCapture2D (found again in the PIE world)
+    SCENE_CAPTURE_LABEL = "PIE_Tracer_SceneCapture"
+
     def __init__(
         self,
         output_dir,
@@ -78,6 +96,10 @@ class PIETracer:
         resolution=(800, 600),
         multi_angle=True,
         views=None,
+        native_sampling=True,
+        output_format="json",
+        single_frame_views=True,
+        fixed_step=None,
     ):
         """
         Initialize the PIE tracer.
@@ -98,7 +120,26 @@ class PIETracer:
             resolution: Screenshot resolution as (width, height) tuple (default: (800, 600))
             multi_angle: Whether to capture multiple angles (default: True)
             views: Custom view configurations (defaults to PIE_TRACER_VIEWS)
+            native_sampling: Sample transforms with the ExtraPythonAPIs native sampler when
+                            available (default: True). Falls back to per-actor Python sampling
+                            if the plugin is missing or screenshots are enabled.
+            output_format: "json" writes {actor}/sample_at_tick_N/transform.json per sample;
+                          "columnar" writes a single trace.uetrace file for the session
+                          (screenshots, if enabled, still go to per-sample directories)
+            single_frame_views: Render all views of all tracked actors within the sampled
+                               frame (default: True). False takes one view per tick with
+                               the game paused until the sample's views are done.
+            fixed_step: Simulation seconds per frame (e.g. 1/60). PIE then advances by
+                        exactly this step every frame without waiting for real time, so
+                        traces are deterministic per frame and finish faster than real
+                        time. Needs the ExtraPythonAPIs plugin; without it the trace runs
+                        in real time. None (default) keeps the real-time clock.
         """
+        if output_format not in ("json", "columnar"):
+            raise ValueError(f"Unknown output_format: {output_format}")
+        if fixed_step is not None and fixed_step <= 0:
+            raise ValueError(f"fixed_step must be positive: {fixed_step}")
+
         self.output_dir = output_dir
         self.actor_names = actor_names
         self.interval_seconds = interval_seconds
@@ -114,6 +155,10 @@ class PIETracer:
         self.resolution = resolution
         self.multi_angle = multi_angle
         self.views = views if views is not None else PIE_TRACER_VIEWS
+        self.native_sampling = native_sampling
+        self.output_format = output_format
+        self.single_frame_views = single_frame_views
+        self.fixed_step = fixed_step
 
         # Internal executor
         self._executor = None
@@ -126,19 +171,31 @@ class PIETracer:
         self._is_running = False
         self._is_complete = False
         self._result = None
+        self._fixed_step_active = False  # Whether this tracer enabled the fixed-step clock
+        self._wall_start = 0.0
+        self._pie_world = None  # PIE world whose clock drives _tick_delta
+        self._last_world_time = None  # World time seen on the previous tick
 
         # Actor tracking
         self._actor_refs = {}  # {name: actor_object}
         self._actor_labels = {}  # {name: actor_label} - for directory naming
+        self._actor_paths = {}  # {name: object path} - unique key in the columnar trace
         self._actors_not_found = []
 
+        # Native sampler state (ExActorTransformSampler from ExtraPythonAPIs plugin)
+        self._use_native_sampling = False
+        self._native_sampler = None
+        self._native_actor_names = []  # Actor names in sampler registration order
+        self._native_tick_base = 0  # Executor tick on which the native sampler started
+
+        # Columnar trace writer (output_format="columnar")
+        self._trace_writer = None
+
         # Screenshot state (using SceneCapture2D for PIE world rendering)
-        self._scene_capture_actor = None  # SceneCapture2D in EDITOR world
-        self._pie_capture_actor = None  # SceneCapture2D duplicate in PIE world (lazy init)
-        self._render_target = None  # TextureRenderTarget2D for rendering
-        self._pie_world = None  # Reference to PIE world
+        self._capture_rig = None  # SceneCaptureRig, attached to PIE lazily
         self._current_screenshot_queue = []  # [(actor_name, view_config, filename), ...]
-        self._current_sample_screenshots = {}  # {actor_name: [screenshot_paths]}
+        self._current_sample_screenshots = {}  # {actor_name: sample info} for the current sample
+        self._unwritten_samples = []  # Sample infos whose transform.json awaits their screenshots
         self._is_paused_for_screenshots = False  # Whether game is paused for screenshot capture
 
         # Metadata (will be written to metadata.json at the end)
@@ -152,6 +209,8 @@ class PIETracer:
             "actors": [],
             "actors_not_found": [],
             "capture_screenshots": capture_screenshots,
+            "sampling_backend": "",
+            "output_format": output_format,
         }
 
         # Ensure output directory exists
@@ -172,15 +231,32 @@ class PIETracer:
         self._result = None
         self._actor_refs = {}
         self._actor_labels = {}
+        self._actor_paths = {}
         self._actors_not_found = []
+        self._wall_start = time.perf_counter()
+        self._pie_world = None
+        self._last_world_time = None
+
+        # Native sampling needs the game to keep ticking between samples, so screenshot
+        # capture (which pauses the game per sample) stays on the Python path
+        self._use_native_sampling = (
+            self.native_sampling
+            and not self.capture_screenshots
+            and hasattr(unreal, "ExActorTransformSampler")
+        )
+        self._native_sampler = None
+        self._native_actor_names = []
+        self._native_tick_base = 0
+
+        self._trace_writer = None
+        if self.output_format == "columnar":
+            self._trace_writer = TraceFileWriter(os.path.join(self.output_dir, TRACE_FILE_NAME))
 
         # Reset screenshot state
-        self._scene_capture_actor = None
-        self._pie_capture_actor = None
-        self._render_target = None
-        self._pie_world = None
+        self._capture_rig = None
         self._current_screenshot_queue = []
         self._current_sample_screenshots = {}
+        self._unwritten_samples = []
         self._is_paused_for_screenshots = False
 
         # Initialize metadata
@@ -194,6 +270,9 @@ class PIETracer:
             "actors": [],
             "actors_not_found": [],
             "capture_screenshots": self.capture_screenshots,
+            "sampling_backend": "native" if self._use_native_sampling else "python",
+            "output_format": self.output_format,
+            "clock": "realtime",
         }
 
         # Check if PIE already running - stop it and warn user
@@ -203,22 +282,30 @@ class PIETracer:
             level_editor = unreal.get_editor_subsystem(unreal.LevelEditorSubsystem)
             level_editor.editor_set_game_view(False)
             # Brief wait for PIE to fully stop
-            import time
             time.sleep(0.5)
 
         # Create SceneCapture2D in editor world if screenshots enabled
         # It will be automatically duplicated to PIE world when PIE starts
         if self.capture_screenshots:
-            if not self._create_scene_capture():
+            self._capture_rig = SceneCaptureRig(self.SCENE_CAPTURE_LABEL, self.resolution)
+            if self._capture_rig.create():
+                self._metadata["screenshot_backend"] = self._capture_rig.backend
+                self._metadata["single_frame_views"] = self.single_frame_views
+            else:
                 unreal.log_warning("[WARNING] Failed to create scene capture, disabling screenshots")
+                self._capture_rig.destroy()
+                self._capture_rig = None
                 self.capture_screenshots = False
 
-        # Calculate total ticks
+        # With a duration the sample code ends the trace once _total_elapsed reaches
+        # it, however many frames that takes (frames paused for screenshots do not
+        # advance it), so the executor gets an open tick budget
         if self.duration is not None:
-            total_ticks = int(self.duration * self.ASSUMED_FPS) + 1
+            total_ticks = None
         else:
             # Run for a very long time if no duration specified
-            total_ticks = 10 * 60 * self.ASSUMED_FPS  # 10 minutes max
+            fps = 1.0 / self.fixed_step if self.fixed_step is not None else self.ASSUMED_FPS
+            total_ticks = int(10 * 60 * fps)  # 10 minutes max
 
         # Build the sampling code that will be executed each tick
         sample_code = self._build_sample_code()
@@ -237,17 +324,28 @@ class PIETracer:
             auto_stop_pie=self.auto_stop_pie,  # Let executor handle PIE stop
             task_id=None,  # We write completion file ourselves
             on_before_complete=self._on_executor_complete,  # Save data before PIE stops
+            on_pie_ended=self._on_pie_ended,  # Restore the clock if PIE stops early
         )
 
-        # Start the executor (this resets exec_context, so we inject after)
-        self._executor.start()
+        # Switch to the fixed-step clock before PIE starts, and restore it if
+        # anything below fails
+        if self.fixed_step is not None:
+            self._enable_fixed_step()
+        try:
+            # Start the executor (this resets exec_context, so we inject after)
+            self._executor.start()
 
-        # Inject tracer context into executor AFTER start() which resets the context
-        self._executor._exec_context.update(
-            {
-                "__tracer__": self,
-            }
-        )
+            # Inject tracer context into executor AFTER start() which resets the context
+            self._executor._exec_context.update(
+                {
+                    "__tracer__": self,
+                }
+            )
+        except Exception:
+            self._disable_fixed_step()
+            self._destroy_scene_capture()
+            self._is_running = False
+            raise
 
         unreal.log(f"[OK] PIE tracer started - Tracking {len(self.actor_names)} actors")
         unreal.log(f"[INFO] Interval: {self.interval_seconds}s, Output: {self.output_dir}")
@@ -258,7 +356,7 @@ class PIETracer:
         # It handles time accumulation, sampling, and screenshot capture internally
         return """
 tracer = __tracer__
-delta_time = 1.0 / 60.0  # Approximate delta time
+delta_time = tracer._tick_delta()
 
 # Update current tick from executor (use _tick_count attribute)
 tracer._current_tick = __executor__._tick_count
@@ -274,6 +372,9 @@ elif tracer.duration is not None and tracer._total_elapsed >= tracer.duration:
     # Duration reached - trigger executor completion
     # This will call on_before_complete callback before stopping PIE
     __executor__._auto_complete()
+elif tracer._use_native_sampling:
+    # Native sampler handles interval timing; just drain its buffer
+    tracer._native_tick()
 else:
     # Accumulate time for interval
     tracer._accumulated_time += delta_time
@@ -284,6 +385,74 @@ else:
         tracer._do_sample()
 """
 
+    def _tick_delta(self):
+        """
+        Simulation seconds since the previous tick.
+
+        Read from the PIE world's clock, like the native sampler, so both paths
+        measure duration and timestamps in world time: frames paused for
+        screenshots do not advance it, and with a fixed step every frame advances
+        it by exactly the step. Without a PIE world, the fixed step (zero while
+        paused) or 1 / ASSUMED_FPS is assumed.
+        """
+        world_time = self._world_time()
+        if world_time is not None:
+            previous, self._last_world_time = self._last_world_time, world_time
+            return max(world_time - previous, 0.0) if previous is not None else 0.0
+        if self._fixed_step_active:
+            return 0.0 if self._is_paused_for_screenshots else self.fixed_step
+        return 1.0 / self.ASSUMED_FPS
+
+    def _world_time(self):
+        """World time of the PIE world in seconds, or None without a PIE world."""
+        if self._pie_world is None:
+            pie_worlds = unreal.EditorLevelLibrary.get_pie_worlds(False)
+            if len(pie_worlds) == 0:
+                return None
+            self._pie_world = pie_worlds[0]
+        try:
+            return unreal.GameplayStatics.get_time_seconds(self._pie_world)
+        except Exception:
+            self._pie_world = None
+            return None
+
+    def _enable_fixed_step(self):
+        """Switch the engine to the fixed-step clock (ExSimulationClockLibrary)."""
+        if not hasattr(unreal, "ExSimulationClockLibrary"):
+            unreal.log_warning(
+                "[WARNING] ExSimulationClockLibrary not available, tracing in real time"
+            )
+            return
+
+        if not unreal.ExSimulationClockLibrary.enable_fixed_step(self.fixed_step):
+            unreal.log_warning("[WARNING] Failed to enable fixed step, tracing in real time")
+            return
+
+        self._fixed_step_active = True
+        self._metadata["clock"] = "fixed_step"
+        self._metadata["fixed_step"] = self.fixed_step
+        unreal.log(f"[OK] Fixed-step clock enabled: {self.fixed_step:.6f}s per frame")
+
+    def _disable_fixed_step(self):
+        """Restore the real-time clock if this tracer enabled the fixed step."""
+        if not self._fixed_step_active:
+            return
+        unreal.ExSimulationClockLibrary.disable_fixed_step()
+        self._fixed_step_active = False
+        unreal.log("[OK] Fixed-step clock disabled")
+
+    def _on_pie_ended(self, executor):
+        """
+        Called by the executor when PIE ends before the trace completed.
+
+        The executor only pauses then, so the real-time clock is restored here
+        instead of leaving the editor on the fixed step.
+        """
+        self._disable_fixed_step()
+        # A new PIE session has its own world and clock
+        self._pie_world = None
+        self._last_world_time = None
+
     def _do_sample(self):
         """Perform a single sample of all tracked actors."""
         # Get PIE world
@@ -317,32 +486,22 @@ else:
         # Sample each tracked actor and write transform.json
         for name, actor in self._actor_refs.items():
             try:
-                # Get actor label for directory naming
-                actor_label = self._actor_labels.get(name, name)
-                safe_label = self._sanitize_dirname(actor_label)
-
-                # Create sample directory: output_dir/{actor_label}/sample_at_tick_{tick}/
-                sample_dir = os.path.join(self.output_dir, safe_label, f"sample_at_tick_{tick}")
-                _ensure_directory(sample_dir)
-
                 # Sample transform data
                 sample_data = self._sample_actor(actor, self._total_elapsed, tick)
 
-                # Create screenshots directory if capturing
-                if self.capture_screenshots:
-                    screenshots_dir = os.path.join(sample_dir, "screenshots")
-                    _ensure_directory(screenshots_dir)
-
-                # Write transform.json immediately
-                transform_file = os.path.join(sample_dir, "transform.json")
-                with open(transform_file, "w", encoding="utf-8") as f:
-                    json.dump(sample_data, f, indent=2)
+                # Write transform.json (deferred until its screenshots are taken)
+                sample_dir = self._write_sample(name, tick, sample_data)
 
                 # Store sample directory for screenshot capture
-                self._current_sample_screenshots[name] = {
+                sample_info = {
                     "sample_dir": sample_dir,
+                    "sample_data": sample_data,
                     "screenshots": [],
+                    "pending_writes": 0,
                 }
+                self._current_sample_screenshots[name] = sample_info
+                if self.capture_screenshots and self._trace_writer is None:
+                    self._unwritten_samples.append(sample_info)
 
             except (RuntimeError, ReferenceError):
                 # Actor was destroyed during PIE
@@ -356,14 +515,236 @@ else:
         if self.capture_screenshots:
             self._start_screenshot_capture()
 
-            # Pause the game while capturing screenshots
-            # This ensures screenshots are taken at the exact moment of transform sampling
-            if self._current_screenshot_queue:
+            if self.single_frame_views:
+                # Every view renders in this frame, at the moment of transform sampling
+                while self._current_screenshot_queue:
+                    self._take_screenshot(self._current_screenshot_queue.pop(0))
+                self._flush_sample_manifests()
+            elif self._current_screenshot_queue:
+                # One view per tick: pause the game so all views show the sampled moment
                 self._pause_game(True)
 
         # Execute tick callback if registered for this sample number
         self._execute_tick_callback(self._sample_count - 1)
 
+    def _write_sample(self, name, tick, sample_data):
+        """
+        Write a single actor sample.
+
+        In "json" format, writes output_dir/{actor_label}/sample_at_tick_{tick}/transform.json;
+        with screenshots, the file is written once they are all taken (_flush_sample_manifests).
+        In "columnar" format, appends to the session trace file; a sample directory is only
+        created when screenshots need somewhere to go.
+
+        Args:
+            name: Tracked actor name (key into _actor_labels)
+            tick: Tick number used for the sample directory name
+            sample_data: Sample dict as returned by _sample_actor
+
+        Returns:
+            Path of the sample directory
+        """
+        # Get actor label for directory naming
+        actor_label = self._actor_labels.get(name, name)
+        safe_label = self._sanitize_dirname(actor_label)
+
+        # Sample directory: output_dir/{actor_label}/sample_at_tick_{tick}/
+        sample_dir = os.path.join(self.output_dir, safe_label, f"sample_at_tick_{tick}")
+
+        if self._trace_writer is not None:
+            loc = sample_data["location"]
+            rot = sample_data["rotation"]
+            vel = sample_data["velocity"]
+            # Labels are not unique, so the trace is keyed by object path
+            self._trace_writer.add_sample(
+                self._actor_paths.get(name, name),
+                tick,
+                sample_data["timestamp"],
+                (loc["x"], loc["y"], loc["z"]),
+                (rot["pitch"], rot["yaw"], rot["roll"]),
+                (vel["x"], vel["y"], vel["z"]) if vel else None,
+                label=actor_label,
+            )
+            if self.capture_screenshots:
+                _ensure_directory(os.path.join(sample_dir, "screenshots"))
+            return sample_dir
+
+        _ensure_directory(sample_dir)
+
+        # Create screenshots directory if capturing
+        if self.capture_screenshots:
+            screenshots_dir = os.path.join(sample_dir, "screenshots")
+            _ensure_directory(screenshots_dir)
+            return sample_dir
+
+        self._write_manifest(sample_dir, sample_data)
+        return sample_dir
+
+    def _write_manifest(self, sample_dir, sample_data):
+        """Write a sample's transform.json."""
+        transform_file = os.path.join(sample_dir, "transform.json")
+        with open(transform_file, "w", encoding="utf-8") as f:
+            json.dump(sample_data, f, indent=2)
+
+    def _flush_sample_manifests(self, force=False):
+        """
+        Write transform.json, with its screenshot list, for samples whose screenshots are done.
+
+        Each manifest is written once instead of being rewritten after every screenshot.
+        Called when the screenshot queue is empty; a sample still waits while any of its
+        async screenshot writes is pending.
+
+        Args:
+            force: Write all remaining manifests, even with writes still pending
+        """
+        remaining = []
+        for sample_info in self._unwritten_samples:
+            if sample_info["pending_writes"] and not force:
+                remaining.append(sample_info)
+                continue
+            sample_data = dict(sample_info["sample_data"])
+            sample_data["screenshots"] = sample_info["screenshots"]
+            try:
+                self._write_manifest(sample_info["sample_dir"], sample_data)
+            except Exception as e:
+                unreal.log_warning(
+                    f"[WARNING] Failed to write transform.json in {sample_info['sample_dir']}: {e}"
+                )
+        self._unwritten_samples = remaining
+
+    def _close_trace_writer(self):
+        """
+        Write the columnar trace file (if enabled).
+
+        Returns:
+            Path of the trace file, or None
+        """
+        if self._trace_writer is None:
+            return None
+
+        writer = self._trace_writer
+        self._trace_writer = None
+        try:
+            trace_file = writer.close(
+                metadata={
+                    "level": self._metadata.get("level", ""),
+                    "interval": self.interval_seconds,
+                    "sampling_backend": self._metadata.get("sampling_backend", ""),
+                }
+            )
+            unreal.log(f"[OK] Wrote trace file: {trace_file} ({writer.sample_count} samples)")
+            return trace_file
+        except Exception as e:
+            unreal.log_error(f"[ERROR] Failed to write trace file: {e}")
+            return None
+
+    # ============================================
+    # NATIVE SAMPLING METHODS
+    # ============================================
+
+    def _native_tick(self):
+        """
+        Per-tick handler when native sampling is enabled.
+
+        On the first tick, finds actors and starts the native sampler. Afterwards, drains
+        buffered frames in batches (every tick if tick callbacks are registered, so they
+        still run close to their sample).
+        """
+        if self._native_sampler is None:
+            self._start_native_sampler()
+            return
+
+        buffered = self._native_sampler.get_num_buffered_frames()
+        if buffered >= self.NATIVE_DRAIN_BATCH_FRAMES or (buffered > 0 and self.tick_callbacks):
+            self._drain_native_samples()
+
+    def _start_native_sampler(self):
+        """Find tracked actors in the PIE world and start the native sampler."""
+        pie_worlds = unreal.EditorLevelLibrary.get_pie_worlds(False)
+        if len(pie_worlds) == 0:
+            return  # PIE not running yet
+
+        pie_world = pie_worlds[0]
+        self._metadata["level"] = pie_world.get_name()
+
+        found_count = self._find_actors(pie_world)
+        if found_count == 0:
+            unreal.log_error("[ERROR] No actors found to track, stopping tracer")
+            if self._executor:
+                self._executor._auto_complete()
+            return
+
+        sampler = unreal.ExActorTransformSampler.create_sampler(
+            pie_world, self.NATIVE_SAMPLER_CAPACITY
+        )
+        self._native_actor_names = list(self._actor_refs.keys())
+        if sampler is not None:
+            sampler.register_actors([self._actor_refs[n] for n in self._native_actor_names])
+        if sampler is None or not sampler.start_sampling(self.interval_seconds):
+            unreal.log_warning("[WARNING] Native sampler failed to start, using Python sampling")
+            self._use_native_sampling = False
+            self._metadata["sampling_backend"] = "python"
+            return
+
+        self._native_sampler = sampler
+        # The sampler counts world ticks from its start; the executor ticks once per
+        # world tick, so base + native tick is the executor tick of the sampled frame
+        self._native_tick_base = self._current_tick
+        unreal.log(f"[OK] Native transform sampler started for {found_count} actors")
+
+    def _drain_native_samples(self):
+        """Drain all buffered frames from the native sampler and write them out."""
+        if self._native_sampler is None:
+            return
+
+        count, ticks, times, values, valid = self._native_sampler.drain_samples(0)
+        if count == 0:
+            return
+
+        values = list(values)
+        valid = list(valid)
+        num_actors = len(self._native_actor_names)
+        stride = NATIVE_VALUES_PER_SAMPLE
+
+        for frame in range(count):
+            tick = self._native_tick_base + ticks[frame]
+            timestamp = times[frame]
+            for actor_index, name in enumerate(self._native_actor_names):
+                if not valid[frame * num_actors + actor_index]:
+                    continue
+                base = (frame * num_actors + actor_index) * stride
+                v = values[base : base + stride]
+                sample_data = {
+                    "tick": tick,
+                    "timestamp": round(timestamp, 3),
+                    "location": {"x": round(v[0], 2), "y": round(v[1], 2), "z": round(v[2], 2)},
+                    "rotation": {
+                        "pitch": round(v[3], 2),
+                        "yaw": round(v[4], 2),
+                        "roll": round(v[5], 2),
+                    },
+                    "velocity": {"x": v[6], "y": v[7], "z": v[8]},
+                    "screenshots": [],
+                }
+                try:
+                    self._write_sample(name, tick, sample_data)
+                except OSError as e:
+                    unreal.log_warning(f"[WARNING] Failed to write sample for '{name}': {e}")
+
+            self._sample_count += 1
+            self._execute_tick_callback(self._sample_count - 1)
+
+    def _stop_native_sampler(self):
+        """Stop the native sampler and flush any remaining frames."""
+        if self._native_sampler is None:
+            return
+        self._native_sampler.stop_sampling()
+        self._drain_native_samples()
+        dropped = self._native_sampler.get_num_dropped_frames()
+        if dropped:
+            unreal.log_warning(f"[WARNING] Native sampler dropped {dropped} frames (buffer overflow)")
+        self._native_sampler = None
+
     def _sanitize_dirname(self, name):
         """
         Sanitize a string for use as a directory name.
@@ -393,6 +774,12 @@ else:
         if self._is_paused_for_screenshots:
             self._pause_game(False)
 
+        # Flush native samples, any buffered columnar trace data and queued screenshots
+        self._stop_native_sampler()
+        self._close_trace_writer()
+        self._collect_screenshots(wait=True)
+        self._flush_sample_manifests(force=True)
+
         # Stop the executor
         if self._executor is not None:
             self._executor.stop()
@@ -400,6 +787,7 @@ else:
 
         # Destroy camera if exists
         self._destroy_scene_capture()
+        self._disable_fixed_step()
 
         unreal.log(f"[OK] PIE tracer stopped - Total samples: {self._sample_count}")
 
@@ -494,7 +882,18 @@ else:
                         break
 
             if found_actor:
+                actual_path = found_actor.get_path_name()
+                tracked_as = next(
+                    (n for n, p in self._actor_paths.items() if p == actual_path), None
+                )
+                if tracked_as is not None:
+                    unreal.log_warning(
+                        f"[WARNING] Actor '{target_name}' resolves to the same actor as "
+                        f"'{tracked_as}', tracking it once"
+                    )
+                    continue
                 self._actor_refs[target_name] = found_actor
+                self._actor_paths[target_name] = actual_path
                 # Save actor label for directory naming (prefer label over name)
                 actual_label = found_actor.get_actor_label()
                 actual_name = found_actor.get_name()
@@ -555,100 +954,11 @@ else:
     # SCREENSHOT CAPTURE METHODS
     # ============================================
 
-    def _create_scene_capture(self):
-        """
-        Create SceneCapture2D actor in EDITOR world.
-        Will be automatically duplicated to PIE world when PIE starts.
-        """
-        # Get editor world (not PIE world)
-        editor_world = unreal.EditorLevelLibrary.get_editor_world()
-        if not editor_world:
-            unreal.log_error("[ERROR] Failed to get editor world")
-            return False
-
-        # Use EditorActorSubsystem to create in editor world
-        actor_subsystem = unreal.get_editor_subsystem(unreal.EditorActorSubsystem)
-        if not actor_subsystem:
-            unreal.log_error("[ERROR] Failed to get EditorActorSubsystem")
-            return False
-
-        # Create SceneCapture2D in editor world
-        # NOTE: Do NOT use transient=True as it prevents duplication to PIE world
-        self._scene_capture_actor = actor_subsystem.spawn_actor_from_class(
-            unreal.SceneCapture2D,
-            unreal.Vector(0, 0, 0)
-        )
-
-        if not self._scene_capture_actor:
-            unreal.log_error("[ERROR] Failed to create SceneCapture2D actor")
-            return False
-
-        self._scene_capture_actor.set_actor_label("PIE_Tracer_SceneCapture")
-        unreal.log(f"[OK] Created SceneCapture2D in editor world: {self._scene_capture_actor.get_name()}")
-
-        # Create render target in editor world
-        self._render_target = unreal.RenderingLibrary.create_render_target2d(
-            editor_world,
-            self.resolution[0],
-            self.resolution[1],
-            unreal.TextureRenderTargetFormat.RTF_RGBA8
-        )
-
-        if not self._render_target:
-            unreal.log_error("[ERROR] Failed to create render target")
-            return False
-
-        # Configure capture component
-        capture_component = self._scene_capture_actor.capture_component2d
-        capture_component.texture_target = self._render_target
-        capture_component.capture_source = unreal.SceneCaptureSource.SCS_FINAL_COLOR_LDR
-
-        unreal.log("[OK] SceneCapture2D created (will be duplicated to PIE)")
-        return True
-
-    def _find_scene_capture_in_pie(self):
-        """
-        Find the PIE duplicate of our SceneCapture2D actor.
-
-        When PIE starts, UE5 automatically duplicates all editor actors into PIE world.
-        This should always succeed - if it doesn't, let the exception propagate.
-
-        Returns:
-            SceneCapture2D actor in PIE world
-        """
-        pie_worlds = unreal.EditorLevelLibrary.get_pie_worlds(False)
-        self._pie_world = pie_worlds[0]
-
-        # Find all SceneCapture2D actors in PIE world
-        scene_captures = unreal.GameplayStatics.get_all_actors_of_class(
-            self._pie_world,
-            unreal.SceneCapture2D
-        )
-
-        # Find our actor by label
-        for actor in scene_captures:
-            if actor.get_actor_label() == "PIE_Tracer_SceneCapture":
-                unreal.log(f"[OK] Found SceneCapture2D in PIE: {actor.get_name()}")
-                return actor
-
-        # This should never happen - if it does, raise an exception
-        raise RuntimeError("SceneCapture2D duplicate not found in PIE world")
-
     def _destroy_scene_capture(self):
         """Destroy the SceneCapture2D actor and render target if they exist."""
-        # Destroy editor world actor
-        if self._scene_capture_actor is not None:
-            try:
-                if unreal.SystemLibrary.is_valid(self._scene_capture_actor):
-                    self._scene_capture_actor.destroy_actor()
-            except Exception:
-                pass  # Actor already destroyed
-            self._scene_capture_actor = None
-
-        # PIE duplicate will be destroyed automatically when PIE ends
-        self._pie_capture_actor = None
-        self._render_target = None
-        self._pie_world = None
+        if self._capture_rig is not None:
+            self._capture_rig.destroy()
+            self._capture_rig = None
 
     def _pause_game(self, paused):
         """
@@ -746,10 +1056,10 @@ else:
     def _start_screenshot_capture(self):
         """Start capturing screenshots for all tracked actors in current sample."""
         # On first screenshot capture, find PIE duplicate of our scene capture
-        if self._pie_capture_actor is None:
+        if not self._capture_rig.is_attached:
             # Find PIE duplicate (lazy initialization on first use)
             # If this fails, let the exception propagate
-            self._pie_capture_actor = self._find_scene_capture_in_pie()
+            self._capture_rig.attach_to_pie()
             unreal.log("[OK] Using SceneCapture2D duplicate from PIE world")
 
         # Build the screenshot queue for this sample
@@ -809,8 +1119,11 @@ else:
         Returns:
             True if there are still screenshots being processed, False otherwise
         """
+        self._collect_screenshots()
+
         # Check if there are more screenshots to take
         if not self._current_screenshot_queue:
+            self._flush_sample_manifests()
             # Queue empty - resume game if it was paused
             if self._is_paused_for_screenshots:
                 self._pause_game(False)
@@ -834,7 +1147,6 @@ else:
         view_config = shot_info["view_config"]
         filename = shot_info["filename"]
         actor_name = shot_info["actor_name"]
-        sample_dir = shot_info["sample_dir"]
 
         unreal.log(f"[DEBUG] Taking screenshot for {actor_name}, view={view_config['name']}")
 
@@ -845,12 +1157,6 @@ else:
                 )
                 return
 
-            if not self._pie_capture_actor or not self._render_target:
-                unreal.log_error("[ERROR] SceneCapture2D or render target not available")
-                return
-
-            unreal.log(f"[DEBUG] Using PIE SceneCapture2D: {self._pie_capture_actor.get_name()}")
-
             # Get actor location
             target_location = actor.get_actor_location()
             unreal.log(f"[DEBUG] Target location: {target_location}")
@@ -858,62 +1164,45 @@ else:
             # Calculate camera transform
             cam_pos, cam_rot = self._calculate_camera_transform(target_location, view_config)
 
-            # Move PIE SceneCapture2D actor (not editor actor)
-            self._pie_capture_actor.set_actor_location_and_rotation(
-                cam_pos, cam_rot, sweep=False, teleport=True
-            )
-
-            # Capture the scene using PIE actor
-            capture_component = self._pie_capture_actor.capture_component2d
-            capture_component.capture_scene()
-
-            # Export render target to file
-            # Note: export_render_target requires filename without extension
-            output_dir = os.path.dirname(filename)
-            screenshot_basename = os.path.splitext(os.path.basename(filename))[0]
-
-            unreal.RenderingLibrary.export_render_target(
-                self._pie_world,
-                self._render_target,
-                output_dir,
-                screenshot_basename
-            )
-
-            # UE5 exports without .png extension, need to rename
-            temp_path = os.path.join(output_dir, screenshot_basename)
-            final_path = filename  # This should already have .png extension
-
-            if os.path.exists(temp_path):
-                if os.path.exists(final_path):
-                    os.remove(final_path)
-                os.rename(temp_path, final_path)
-            elif not os.path.exists(final_path):
-                unreal.log_warning(f"[WARNING] Screenshot file not created: {filename}")
+            # Render from the PIE SceneCapture2D; an async write is collected later
+            # by _collect_screenshots, and the sample's manifest waits for it
+            sample_info = self._current_sample_screenshots.get(actor_name)
+            queued_before = self._capture_rig.pending()
+            if not self._capture_rig.capture(cam_pos, cam_rot, filename, owner=sample_info):
                 return
+            if sample_info and self._capture_rig.pending() > queued_before:
+                sample_info["pending_writes"] += 1
 
-            # Record screenshot in sample info (just the view name, not full path)
+            # Record screenshot in sample info (just the view name, not full path);
+            # transform.json is written once the sample's screenshots are done
             view_name = view_config["name"]
-            sample_info = self._current_sample_screenshots.get(actor_name)
             if sample_info:
                 sample_info["screenshots"].append(f"{view_name}.png")
 
-                # Update transform.json with screenshot list
-                transform_file = os.path.join(sample_dir, "transform.json")
-                if os.path.exists(transform_file):
-                    try:
-                        with open(transform_file, "r", encoding="utf-8") as f:
-                            transform_data = json.load(f)
-                        transform_data["screenshots"] = sample_info["screenshots"]
-                        with open(transform_file, "w", encoding="utf-8") as f:
-                            json.dump(transform_data, f, indent=2)
-                    except Exception as e:
-                        unreal.log_warning(f"[WARNING] Failed to update transform.json: {e}")
-
             unreal.log(f"[OK] Screenshot: {actor_name}/{view_name} -> {os.path.basename(filename)}")
 
         except Exception as e:
             unreal.log_error(f"[ERROR] Failed to take screenshot for {actor_name}: {e}")
 
+    def _collect_screenshots(self, wait=False):
+        """
+        Collect finished async screenshot writes, dropping failed ones from their sample.
+
+        Args:
+            wait: Block until all queued writes finish (up to SceneCaptureRig.FLUSH_TIMEOUT)
+        """
+        if self._capture_rig is None:
+            return
+
+        for filename, sample_info, error in self._capture_rig.collect(wait=wait):
+            if not sample_info:
+                continue
+            sample_info["pending_writes"] -= 1
+            if error:
+                shot = os.path.basename(filename)
+                if shot in sample_info["screenshots"]:
+                    sample_info["screenshots"].remove(shot)
+
     def _execute_tick_callback(self, sample_number):
         """
         Execute tick callback code for a specific sample number.
@@ -957,39 +1246,59 @@ else:
 
         unreal.log(f"[INFO] Tracer completing - saving metadata...")
 
-        # Update metadata
-        self._metadata["duration"] = round(self._total_elapsed, 3)
-        self._metadata["sample_count"] = self._sample_count
-        self._metadata["end_time"] = datetime.now().isoformat()
-        self._metadata["actors"] = list(self._actor_labels.values())
-        self._metadata["actors_not_found"] = self._actors_not_found
-
-        # Write metadata.json
-        metadata_file = os.path.join(self.output_dir, "metadata.json")
         try:
-            with open(metadata_file, "w", encoding="utf-8") as f:
-                json.dump(self._metadata, f, indent=2)
-            unreal.log(f"[OK] Wrote metadata file: {metadata_file}")
-        except Exception as e:
-            unreal.log_error(f"[ERROR] Failed to write metadata file: {e}")
-
-        # Build result
-        self._result = {
-            "success": True,
-            "output_dir": self.output_dir,
-            "duration": self._total_elapsed,
-            "interval": self.interval_seconds,
-            "sample_count": self._sample_count,
-            "actor_count": len(self._actor_refs),
-            "actors_not_found": self._actors_not_found,
-        }
+            # Flush native samples while PIE actors are still alive
+            self._stop_native_sampler()
+            trace_file = self._close_trace_writer()
+            self._collect_screenshots(wait=True)
+            self._flush_sample_manifests(force=True)
+            if trace_file:
+                self._metadata["trace_file"] = trace_file
+
+            # Update metadata (duration is simulation time, wall_time real time)
+            self._metadata["duration"] = round(self._total_elapsed, 3)
+            self._metadata["wall_time"] = round(time.perf_counter() - self._wall_start, 3)
+            self._metadata["sample_count"] = self._sample_count
+            self._metadata["end_time"] = datetime.now().isoformat()
+            self._metadata["actors"] = list(self._actor_labels.values())
+            self._metadata["actors_not_found"] = self._actors_not_found
+            if self._capture_rig is not None:
+                # Screenshots the async writer refused and that were exported synchronously
+                self._metadata["screenshot_sync_fallbacks"] = self._capture_rig.sync_fallbacks
+
+            # Write metadata.json
+            metadata_file = os.path.join(self.output_dir, "metadata.json")
+            try:
+                with open(metadata_file, "w", encoding="utf-8") as f:
+                    json.dump(self._metadata, f, indent=2)
+                unreal.log(f"[OK] Wrote metadata file: {metadata_file}")
+            except Exception as e:
+                unreal.log_error(f"[ERROR] Failed to write metadata file: {e}")
+
+            # Build result
+            self._result = {
+                "success": True,
+                "output_dir": self.output_dir,
+                "duration": self._total_elapsed,
+                "interval": self.interval_seconds,
+                "sample_count": self._sample_count,
+                "actor_count": len(self._actor_refs),
+                "actors_not_found": self._actors_not_found,
+                "clock": self._metadata["clock"],
+                "wall_time": self._metadata["wall_time"],
+            }
+            if trace_file:
+                self._result["trace_file"] = trace_file
 
-        # Resume game if paused before stopping PIE
-        if self._is_paused_for_screenshots:
-            self._pause_game(False)
+            # Resume game if paused before stopping PIE
+            if self._is_paused_for_screenshots:
+                self._pause_game(False)
 
-        # Destroy camera before PIE stops
-        self._destroy_scene_capture()
+            # Destroy camera before PIE stops
+            self._destroy_scene_capture()
+        finally:
+            # Restore the real-time clock before PIE stops, even if saving failed
+            self._disable_fixed_step()
 
         # Mark as complete (executor will stop PIE and itself)
         self._is_complete = True
@@ -1052,6 +1361,10 @@ def start_pie_tracer(
     resolution=(800, 600),
     multi_angle=True,
     views=None,
+    native_sampling=True,
+    output_format="json",
+    single_frame_views=True,
+    fixed_step=None,
 ):
     """
     Start PIE actor tracer.
@@ -1072,6 +1385,11 @@ def start_pie_tracer(
         resolution: Screenshot resolution as (width, height) tuple (default: (800, 600))
         multi_angle: Whether to capture multiple angles (default: True)
         views: Custom view configurations (defaults to PIE_TRACER_VIEWS)
+        native_sampling: Use the ExtraPythonAPIs native transform sampler when available
+        output_format: "json" (per-sample transform.json) or "columnar" (single trace.uetrace)
+        single_frame_views: Render all views of a sample within the sampled frame (default: True)
+        fixed_step: Simulation seconds per frame for a fixed-step, faster-than-real-time
+                    trace (default: None, real time)
 
     Returns:
         PIETracer instance
@@ -1095,6 +1413,10 @@ def start_pie_tracer(
         resolution=resolution,
         multi_angle=multi_angle,
         views=views,
+        native_sampling=native_sampling,
+        output_format=output_format,
+        single_frame_views=single_frame_views,
+        fixed_step=fixed_step,
     )
     _tracer_instance.start()
 
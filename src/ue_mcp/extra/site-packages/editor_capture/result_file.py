@@ -0,0 +1,61 @@
+# Out-of-band result file writer for editor-side scripts
+#
+# Script results can be several megabytes (asset inspection, API search, actor
+# snapshots). Printing them sends every line through UE's log pipe and the remote
+# execution framing, and the server then has to search the output for the JSON.
+# When the MCP server names a result file, the result is written there instead
+# and only a short notice is printed.
+#
+# File layout (all values little-endian):
+#
+#   Header (24 bytes): struct "<8sIIQ"
+#       magic          8s   b"UEMCPRES"
+#       version        u32  RESULT_FILE_VERSION
+#       encoding       u32  RESULT_ENCODING_JSON (compact UTF-8 JSON)
+#       payload_length u64  Byte length of the payload following the header
+#
+# The file is written under a temporary name and renamed into place, so a reader
+# never sees a partially written result.
+#
+# The server-side reader lives in ue_mcp.core.result_file and must be kept in sync.
+
+import json
+import os
+import struct
+
+RESULT_FILE_MAGIC = b"UEMCPRES"
+RESULT_FILE_VERSION = 1
+RESULT_FILE_HEADER = struct.Struct("<8sIIQ")
+RESULT_ENCODING_JSON = 1
+
+
+def write_result_file(path, data, default=None):
+    """
+    Write a script result to a result file.
+
+    Args:
+        path: Result file path chosen by the MCP server
+        data: JSON-serializable result
+        default: Optional json.dumps fallback for objects that are not serializable
+
+    Returns:
+        Number of payload bytes written
+
+    Raises:
+        TypeError/ValueError: If data is not JSON-serializable (nothing is written)
+        OSError: If the file cannot be written
+    """
+    payload = json.dumps(
+        data, separators=(",", ":"), ensure_ascii=False, default=default
+    ).encode("utf-8")
+
+    temp_path = path + ".tmp"
+    with open(temp_path, "wb") as f:
+        f.write(
+            RESULT_FILE_HEADER.pack(
+                RESULT_FILE_MAGIC, RESULT_FILE_VERSION, RESULT_ENCODING_JSON, len(payload)
+            )
+        )
+        f.write(payload)
+    os.replace(temp_path, path)
+    return len(payload)
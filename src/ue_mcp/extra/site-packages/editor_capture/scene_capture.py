@@ -0,0 +1,272 @@
+# editor_capture/scene_capture.py
+# SceneCapture2D rig for PIE screenshots
+#
+# Renders views of the PIE world through a SceneCapture2D actor and writes them as
+# PNG files, several views per frame: capture_scene() renders immediately and the
+# readback of each view is queued right behind it, so render commands execute in
+# order and one capture component and render target serve every view of the frame.
+# Taking N views therefore costs one game frame, not N.
+#
+# With the ExtraPythonAPIs plugin, the readback and PNG encoding run off the game
+# thread (ExScreenshotWriterLibrary); otherwise RenderingLibrary.export_render_target
+# is used synchronously. When the writer refuses a capture (too many in flight), the
+# rig waits up to DRAIN_TIMEOUT for queued writes to finish and retries; captures
+# still refused are exported synchronously and counted in sync_fallbacks.
+#
+# Usage:
+#   rig = SceneCaptureRig("PIE_Tracer_SceneCapture", (800, 600))
+#   rig.create()                 # editor world, before PIE starts
+#   ...
+#   rig.attach_to_pie()          # once PIE is running
+#   rig.capture(location, rotation, "C:/Out/front.png")
+#   rig.capture(location2, rotation2, "C:/Out/side.png")
+#   for filename, owner, error in rig.collect(wait=True):
+#       ...
+#   rig.destroy()
+
+import os
+
+import unreal
+
+
+class SceneCaptureRig:
+    """A SceneCapture2D and render target that capture views of the PIE world to files."""
+
+    # Seconds to wait for queued async screenshot writes in collect(wait=True)
+    FLUSH_TIMEOUT = 30.0
+    # Seconds to wait for queued writes when the writer refuses a capture
+    DRAIN_TIMEOUT = 2.0
+
+    def __init__(self, label, resolution):
+        """
+        Initialize the rig.
+
+        Args:
+            label: Actor label of the SceneCapture2D, used to find its PIE duplicate
+            resolution: Render target resolution as (width, height)
+        """
+        self.label = label
+        self.resolution = resolution
+
+        self._editor_actor = None  # SceneCapture2D in EDITOR world
+        self._pie_actor = None  # SceneCapture2D duplicate in PIE world
+        self._render_target = None
+        self._pie_world = None
+        self._tickets = []  # [(ticket, filename, owner), ...] not yet written
+        self._finished = []  # [(filename, owner, error), ...] written, not yet collected
+
+        self.use_async = hasattr(unreal, "ExScreenshotWriterLibrary")
+        # Captures exported synchronously because the async writer refused them
+        self.sync_fallbacks = 0
+
+    @property
+    def backend(self):
+        """Screenshot backend name: "async" (ExtraPythonAPIs writer) or "export"."""
+        return "async" if self.use_async else "export"
+
+    @property
+    def is_attached(self):
+        """True once the PIE duplicate has been found."""
+        return self._pie_actor is not None
+
+    def create(self):
+        """
+        Create the SceneCapture2D actor and render target in the EDITOR world.
+
+        Must be called before PIE starts; the actor is duplicated into the PIE world.
+
+        Returns:
+            True if created
+        """
+        editor_world = unreal.EditorLevelLibrary.get_editor_world()
+        if not editor_world:
+            unreal.log_error("[ERROR] Failed to get editor world")
+            return False
+
+        actor_subsystem = unreal.get_editor_subsystem(unreal.EditorActorSubsystem)
+        if not actor_subsystem:
+            unreal.log_error("[ERROR] Failed to get EditorActorSubsystem")
+            return False
+
+        # NOTE: Do NOT use transient=True as it prevents duplication to PIE world
+        self._editor_actor = actor_subsystem.spawn_actor_from_class(
+            unreal.SceneCapture2D, unreal.Vector(0, 0, 0)
+        )
+        if not self._editor_actor:
+            unreal.log_error("[ERROR] Failed to create SceneCapture2D actor")
+            return False
+
+        self._editor_actor.set_actor_label(self.label)
+        unreal.log(f"[OK] Created SceneCapture2D in editor world: {self._editor_actor.get_name()}")
+
+        self._render_target = unreal.RenderingLibrary.create_render_target2d(
+            editor_world,
+            self.resolution[0],
+            self.resolution[1],
+            unreal.TextureRenderTargetFormat.RTF_RGBA8,
+        )
+        if not self._render_target:
+            unreal.log_error("[ERROR] Failed to create render target")
+            return False
+
+        capture_component = self._editor_actor.capture_component2d
+        capture_component.texture_target = self._render_target
+        capture_component.capture_source = unreal.SceneCaptureSource.SCS_FINAL_COLOR_LDR
+        # Only render on capture(), not every frame
+        capture_component.capture_every_frame = False
+        capture_component.capture_on_movement = False
+
+        unreal.log("[OK] SceneCapture2D created (will be duplicated to PIE)")
+        return True
+
+    def attach_to_pie(self):
+        """
+        Find the PIE duplicate of the SceneCapture2D actor.
+
+        Raises:
+            RuntimeError: If PIE is not running or the duplicate is missing
+        """
+        pie_worlds = unreal.EditorLevelLibrary.get_pie_worlds(False)
+        if not pie_worlds:
+            raise RuntimeError("PIE is not running")
+        self._pie_world = pie_worlds[0]
+
+        scene_captures = unreal.GameplayStatics.get_all_actors_of_class(
+            self._pie_world, unreal.SceneCapture2D
+        )
+        for actor in scene_captures:
+            if actor.get_actor_label() == self.label:
+                unreal.log(f"[OK] Found SceneCapture2D in PIE: {actor.get_name()}")
+                self._pie_actor = actor
+                return
+
+        raise RuntimeError("SceneCapture2D duplicate not found in PIE world")
+
+    def detach(self):
+        """Forget the PIE duplicate (it is destroyed when PIE ends)."""
+        self._pie_actor = None
+        self._pie_world = None
+
+    def capture(self, location, rotation, filename, owner=None):
+        """
+        Render one view and write it to a PNG file.
+
+        Several captures in the same frame are fine: each view is rendered and
+        read back before the next one overwrites the render target.
+
+        Args:
+            location: Camera location (unreal.Vector)
+            rotation: Camera rotation (unreal.Rotator)
+            filename: Output .png path
+            owner: Returned with the file by collect() once an async write finishes
+
+        Returns:
+            True if the screenshot was written or queued
+        """
+        if self._pie_actor is None or self._render_target is None:
+            unreal.log_error("[ERROR] SceneCapture2D or render target not available")
+            return False
+
+        self._pie_actor.set_actor_location_and_rotation(
+            location, rotation, sweep=False, teleport=True
+        )
+        self._pie_actor.capture_component2d.capture_scene()
+
+        if self.use_async:
+            library = unreal.ExScreenshotWriterLibrary
+            ticket = library.capture_render_target_async(
+                self._render_target, filename, unreal.ExScreenshotFormat.PNG, 90
+            )
+            if not ticket:
+                # Let the queued writes drain, then collect them and retry once
+                library.wait_for_captures(self.DRAIN_TIMEOUT)
+                self._finished.extend(self._poll())
+                ticket = library.capture_render_target_async(
+                    self._render_target, filename, unreal.ExScreenshotFormat.PNG, 90
+                )
+            if ticket:
+                self._tickets.append((ticket, filename, owner))
+                return True
+            if not self.sync_fallbacks:
+                unreal.log_warning(
+                    "[WARNING] Async screenshot writer refused a capture, exporting synchronously"
+                )
+            self.sync_fallbacks += 1
+
+        return self._export(filename)
+
+    def collect(self, wait=False):
+        """
+        Collect finished async screenshot writes.
+
+        Args:
+            wait: Block until all queued writes finish (up to FLUSH_TIMEOUT)
+
+        Returns:
+            List of (filename, owner, error) for finished writes; error is None on success
+        """
+        finished, self._finished = self._finished, []
+        if not self._tickets:
+            return finished
+
+        if wait and not unreal.ExScreenshotWriterLibrary.wait_for_captures(self.FLUSH_TIMEOUT):
+            unreal.log_warning(
+                f"[WARNING] Screenshot writes still pending after {self.FLUSH_TIMEOUT}s"
+            )
+        return finished + self._poll()
+
+    def _poll(self):
+        """Take the finished writes off the ticket list, as (filename, owner, error)."""
+        library = unreal.ExScreenshotWriterLibrary
+        finished = []
+        pending = []
+        for ticket, filename, owner in self._tickets:
+            status, error = library.get_capture_status(ticket)
+            if status == unreal.ExScreenshotStatus.PENDING:
+                pending.append((ticket, filename, owner))
+            elif status == unreal.ExScreenshotStatus.FAILED:
+                unreal.log_warning(f"[WARNING] Screenshot not written: {filename}: {error}")
+                finished.append((filename, owner, error or "write failed"))
+            else:
+                finished.append((filename, owner, None))
+        self._tickets = pending
+        return finished
+
+    def pending(self):
+        """Number of async writes not yet collected."""
+        return len(self._tickets) + len(self._finished)
+
+    def destroy(self):
+        """Destroy the editor world actor; the PIE duplicate goes away with PIE."""
+        if self._editor_actor is not None:
+            try:
+                if unreal.SystemLibrary.is_valid(self._editor_actor):
+                    self._editor_actor.destroy_actor()
+            except Exception:
+                pass  # Actor already destroyed
+            self._editor_actor = None
+
+        self._pie_actor = None
+        self._render_target = None
+        self._pie_world = None
+
+    def _export(self, filename):
+        """Export the render target synchronously on the game thread."""
+        # Note: export_render_target requires filename without extension
+        output_dir = os.path.dirname(filename)
+        screenshot_basename = os.path.splitext(os.path.basename(filename))[0]
+
+        unreal.RenderingLibrary.export_render_target(
+            self._pie_world, self._render_target, output_dir, screenshot_basename
+        )
+
+        # UE5 exports without .png extension, need to rename
+        temp_path = os.path.join(output_dir, screenshot_basename)
+        if os.path.exists(temp_path):
+            if os.path.exists(filename):
+                os.remove(filename)
+            os.rename(temp_path, filename)
+        elif not os.path.exists(filename):
+            unreal.log_warning(f"[WARNING] Screenshot file not created: {filename}")
+            return False
+        return True
@@ -0,0 +1,187 @@
+# Columnar binary trace file writer for PIE actor traces
+#
+# Writes one memory-mappable file per trace session instead of one
+# sample_at_tick_N/transform.json per actor per sample.
+#
+# File layout (all values little-endian):
+#
+#   Header (32 bytes): struct "<8sIIQQ"
+#       magic        8s   b"UEMCPTRC"
+#       version      u32  TRACE_FILE_VERSION
+#       actor_count  u32
+#       index_offset u64  Byte offset of the JSON index
+#       index_length u64  Byte length of the JSON index
+#
+#   Column data: for each actor, each column of TRACE_COLUMNS stored as a
+#   contiguous array of `count` values, every column 8-byte aligned.
+#   The tick column is sorted ascending, so readers can binary-search it.
+#
+#   Index (UTF-8 JSON):
+#       {"version": 1,
+#        "columns": [{"name": "tick", "type": "i"}, ...],
+#        "actors": [{"name", "label", "count", "tick_min", "tick_max",
+#                    "offsets": {column_name: byte_offset}}],
+#        "metadata": {...}}
+#
+#   "name" is the actor's object path, unique within the trace; "label" is its
+#   editor label, kept for display only since several actors can share one.
+#
+# The server-side reader lives in ue_mcp.core.trace_file and must be kept in sync.
+
+import json
+import math
+import os
+import struct
+import sys
+from array import array
+
+TRACE_FILE_MAGIC = b"UEMCPTRC"
+TRACE_FILE_VERSION = 1
+TRACE_FILE_HEADER = struct.Struct("<8sIIQQ")
+TRACE_FILE_NAME = "trace.uetrace"
+
+# (column name, array typecode) - "i" int32, "d" float64, "f" float32
+TRACE_COLUMNS = [
+    ("tick", "i"),
+    ("timestamp", "d"),
+    ("location_x", "f"),
+    ("location_y", "f"),
+    ("location_z", "f"),
+    ("rotation_pitch", "f"),
+    ("rotation_yaw", "f"),
+    ("rotation_roll", "f"),
+    ("velocity_x", "f"),
+    ("velocity_y", "f"),
+    ("velocity_z", "f"),
+]
+
+_ALIGNMENT = 8
+
+
+class TraceFileWriter:
+    """
+    Buffers trace samples per actor in typed column arrays and writes them as a
+    single columnar file on close().
+    """
+
+    def __init__(self, path):
+        """
+        Args:
+            path: Output file path (usually {output_dir}/trace.uetrace)
+        """
+        self.path = path
+        self._actors = {}  # {actor_name: {column_name: array}}
+        self._actor_order = []
+        self._labels = {}  # {actor_name: display label}
+
+    def add_sample(
+        self, actor_name, tick, timestamp, location, rotation, velocity=None, label=None
+    ):
+        """
+        Append one sample for an actor.
+
+        Args:
+            actor_name: Unique actor key used in the index (the actor's object path)
+            tick: Tick number (must be non-decreasing per actor)
+            timestamp: Sample time in seconds
+            location: (x, y, z)
+            rotation: (pitch, yaw, roll)
+            velocity: (x, y, z) or None if unavailable (stored as NaN)
+            label: Display label stored alongside the key (default: actor_name)
+        """
+        columns = self._actors.get(actor_name)
+        if columns is None:
+            columns = {name: array(code) for name, code in TRACE_COLUMNS}
+            self._actors[actor_name] = columns
+            self._actor_order.append(actor_name)
+            self._labels[actor_name] = label or actor_name
+
+        if velocity is None:
+            velocity = (math.nan, math.nan, math.nan)
+
+        columns["tick"].append(tick)
+        columns["timestamp"].append(timestamp)
+        columns["location_x"].append(location[0])
+        columns["location_y"].append(location[1])
+        columns["location_z"].append(location[2])
+        columns["rotation_pitch"].append(rotation[0])
+        columns["rotation_yaw"].append(rotation[1])
+        columns["rotation_roll"].append(rotation[2])
+        columns["velocity_x"].append(velocity[0])
+        columns["velocity_y"].append(velocity[1])
+        columns["velocity_z"].append(velocity[2])
+
+    @property
+    def sample_count(self):
+        """Total number of samples buffered across all actors."""
+        return sum(len(c["tick"]) for c in self._actors.values())
+
+    def close(self, metadata=None):
+        """
+        Write the trace file.
+
+        Args:
+            metadata: Optional JSON-serializable dict stored in the index
+
+        Returns:
+            Path of the written file
+        """
+        dir_path = os.path.dirname(self.path)
+        if dir_path and not os.path.exists(dir_path):
+            os.makedirs(dir_path)
+
+        actors_index = []
+        with open(self.path, "wb") as f:
+            f.write(b"\0" * TRACE_FILE_HEADER.size)
+            offset = TRACE_FILE_HEADER.size
+
+            for actor_name in self._actor_order:
+                columns = self._actors[actor_name]
+                ticks = columns["tick"]
+                offsets = {}
+                for name, _code in TRACE_COLUMNS:
+                    data = columns[name]
+                    if sys.byteorder != "little":
+                        data = array(data.typecode, data)
+                        data.byteswap()
+                    offsets[name] = offset
+                    raw = data.tobytes()
+                    f.write(raw)
+                    offset += len(raw)
+                    pad = (-offset) % _ALIGNMENT
+                    if pad:
+                        f.write(b"\0" * pad)
+                        offset += pad
+
+                actors_index.append(
+                    {
+                        "name": actor_name,
+                        "label": self._labels[actor_name],
+                        "count": len(ticks),
+                        "tick_min": ticks[0] if ticks else None,
+                        "tick_max": ticks[-1] if ticks else None,
+                        "offsets": offsets,
+                    }
+                )
+
+            index = {
+                "version": TRACE_FILE_VERSION,
+                "columns": [{"name": name, "type": code} for name, code in TRACE_COLUMNS],
+                "actors": actors_index,
+                "metadata": metadata or {},
+            }
+            index_bytes = json.dumps(index).encode("utf-8")
+            f.write(index_bytes)
+
+            f.seek(0)
+            f.write(
+                TRACE_FILE_HEADER.pack(
+                    TRACE_FILE_MAGIC,
+                    TRACE_FILE_VERSION,
+                    len(actors_index),
+                    offset,
+                    len(index_bytes),
+                )
+            )
+
+        return self.path
@@ -7,13 +7,122 @@ Based on UE5's Python Remote Execution protocol.
 
 import json
 import logging
+import re
 import socket
 import time
+from collections import deque
+from dataclasses import dataclass
 from typing import Any, Optional
 
 logger = logging.getLogger(__name__)
 
 
+class JsonStreamDecoder:
+    """
+    Incrementally split a TCP byte stream of concatenated JSON objects into messages.
+
+    UE5's remote execution command channel sends bare JSON objects without a length
+    prefix. Instead of retrying json.loads on an ever-growing buffer after every recv
+    (quadratic for large outputs), this tracks object depth and string state across
+    chunks, so every byte is scanned once and each message is parsed exactly once.
+    """
+
+    # A complete string literal, an object brace, or the opening quote of a string
+    # that continues past the end of the buffer
+    _TOKEN = re.compile(rb'"[^"\\]*(?:\\.[^"\\]*)*"|[{}]|"', re.DOTALL)
+    # Longest run of string content: stops at the closing quote, or before a trailing
+    # backslash whose escaped byte has not arrived yet
+    _STRING_BODY = re.compile(rb'[^"\\]*(?:\\.[^"\\]*)*', re.DOTALL)
+
+    def __init__(self) -> None:
+        self._buffer = bytearray()
+        self._pos = 0
+        self._depth = 0
+        self._in_string = False
+
+    def reset(self) -> None:
+        """Discard any partially received message."""
+        self._buffer.clear()
+        self._pos = 0
+        self._depth = 0
+        self._in_string = False
+
+    @property
+    def pending_bytes(self) -> int:
+        """Number of buffered bytes belonging to an incomplete message."""
+        return len(self._buffer)
+
+    def feed(self, data: bytes) -> list[dict[str, Any]]:
+        """
+        Add received bytes and return every message completed by them.
+
+        Args:
+            data: Bytes received from the socket
+
+        Returns:
+            Decoded JSON objects in stream order (invalid objects are skipped)
+        """
+        buf = self._buffer
+        buf += data
+        pos = self._pos
+        # The buffer always starts at the current message (or at unconsumed bytes)
+        message_start = 0
+        spans: list[tuple[int, int]] = []
+
+        while pos < len(buf):
+            if self._in_string:
+                pos = self._STRING_BODY.match(buf, pos).end()
+                if pos >= len(buf) or buf[pos] != 0x22:
+                    break  # String continues in the next chunk
+                pos += 1
+                self._in_string = False
+                continue
+
+            tokens = self._TOKEN.finditer(buf, pos)
+            pos = len(buf)
+            for match in tokens:
+                char = buf[match.start()]
+                if char == 0x22:  # "
+                    if match.end() - match.start() == 1:
+                        self._in_string = True
+                        pos = match.end()
+                        break
+                elif char == 0x7B:  # {
+                    if self._depth == 0:
+                        message_start = match.start()
+                    self._depth += 1
+                elif self._depth > 0:  # }
+                    self._depth -= 1
+                    if self._depth == 0:
+                        spans.append((message_start, match.end()))
+            # Release the scanner's buffer export before the buffer is resized below
+            del tokens
+
+        messages: list[dict[str, Any]] = []
+        for start, end in spans:
+            try:
+                messages.append(json.loads(buf[start:end]))
+            except (json.JSONDecodeError, UnicodeDecodeError) as e:
+                logger.debug(f"Skipping undecodable message ({end - start} bytes): {e}")
+
+        # Drop consumed bytes, keeping only the incomplete message (if any)
+        consumed = message_start if self._depth > 0 else pos
+        if consumed:
+            del buf[:consumed]
+            pos -= consumed
+        self._pos = pos
+        return messages
+
+
+@dataclass
+class _PendingCommand:
+    """A command submitted on the command channel, matched to its response in FIFO order."""
+
+    request_id: int
+    payload: bytes
+    abandoned: bool = False
+
+
 class RemoteExecutionClient:
     """
     Execute commands in UE5 editor via Python Remote Execution (socket-based).
@@ -29,6 +138,11 @@ class RemoteExecutionClient:
     SOCKET_TIMEOUT = 0.5
     BUFFER_SIZE = 2_097_152
 
+    # UE5's command connection parses one message at a time from its receive buffer,
+    # so by default the next command is written only once the previous response arrived.
+    # Peers that accept back-to-back messages can allow more in-flight commands.
+    DEFAULT_MAX_IN_FLIGHT = 1
+
     class ExecTypes:
         EXECUTE_FILE = "ExecuteFile"
         EXECUTE_STATEMENT = "ExecuteStatement"
@@ -41,6 +155,7 @@ class RemoteExecutionClient:
         project_name: str = "",
         expected_node_id: Optional[str] = None,
         expected_pid: Optional[int] = None,
+        max_in_flight: int = DEFAULT_MAX_IN_FLIGHT,
     ):
         """
         Initialize RemoteExecutionClient.
@@ -51,6 +166,7 @@ class RemoteExecutionClient:
             project_name: Project name to filter UE5 instances
             expected_node_id: If set, only connect to this specific node_id
             expected_pid: If set, verify the editor process ID matches
+            max_in_flight: Commands written to the connection before waiting for responses
         """
         self.multicast_group = multicast_group
         self.multicast_bind_address = multicast_bind_address
@@ -62,12 +178,28 @@ class RemoteExecutionClient:
         self.cmd_sock: Optional[socket.socket] = None
         self.cmd_connection: Optional[socket.socket] = None
 
+        # Command channel state: responses are matched to commands in FIFO order
+        self.max_in_flight = max(1, max_in_flight)
+        self._decoder = JsonStreamDecoder()
+        self._next_request_id = 1
+        self._in_flight: deque[_PendingCommand] = deque()
+        self._queued: deque[_PendingCommand] = deque()
+        self._responses: dict[int, dict[str, Any]] = {}
+
     def __del__(self) -> None:
         """Clean up sockets on garbage collection."""
         self._cleanup_sockets()
 
+    def _reset_command_channel(self) -> None:
+        """Forget all submitted commands and any partially received response."""
+        self._decoder.reset()
+        self._in_flight.clear()
+        self._queued.clear()
+        self._responses.clear()
+
     def _cleanup_sockets(self) -> None:
         """Close all sockets without sending close message."""
+        self._reset_command_channel()
         if self.cmd_connection is not None:
             try:
                 self.cmd_connection.close()
@@ -113,7 +245,8 @@ class RemoteExecutionClient:
         self, sock: socket.socket, message_type: str, timeout: float = 1.0
     ) -> list[dict[str, Any]]:
         """
-        Collect ALL responses from multicast socket during timeout window.
+        Collect ALL responses from multicast socket during timeout window
+        (returns early once expected_node_id, if set, has answered).
 
         Args:
             sock: Socket to receive from
@@ -152,6 +285,10 @@ class RemoteExecutionClient:
                     if not any(r.get("source") == node_id for r in responses):
                         responses.append(json_data)
 
+                    # Only the expected node is accepted: no need to wait any longer
+                    if self.expected_node_id:
+                        return responses
+
                 except socket.timeout:
                     continue
                 except json.JSONDecodeError:
@@ -371,6 +508,7 @@ class RemoteExecutionClient:
 
             self.cmd_connection, _ = self.cmd_sock.accept()
             self.cmd_connection.settimeout(5.0)
+            self._reset_command_channel()
 
             logger.info("Command connection established")
             return True
@@ -379,97 +517,173 @@ class RemoteExecutionClient:
             logger.error(f"Failed to open connection: {e}")
             return False
 
-    def execute(
-        self,
-        command: str,
-        exec_type: Optional[str] = None,
-        timeout: float = 30.0,
-    ) -> dict[str, Any]:
+    def submit(self, command: str, exec_type: Optional[str] = None) -> int:
         """
-        Execute Python command in UE5.
+        Queue a Python command without waiting for its result.
+
+        Commands are written to the connection in submission order, up to
+        max_in_flight at a time; use collect() to get each result.
 
         Args:
             command: Python code or file path
             exec_type: ExecTypes.EXECUTE_FILE, EXECUTE_STATEMENT, or EVALUATE_STATEMENT
-            timeout: Timeout for command execution
 
         Returns:
-            Dictionary with execution result
+            Request ID to pass to collect()
         """
         if exec_type is None:
             exec_type = self.ExecTypes.EXECUTE_FILE
 
-        try:
-            # Send command message
-            cmd_msg = {
-                "type": "command",
-                "version": self.PROTOCOL_VERSION,
-                "magic": self.MAGIC,
-                "source": "ue_mcp",
-                "dest": self.unreal_node_id,
-                "data": {
-                    "command": command,
-                    "unattended": True,
-                    "exec_mode": exec_type,
-                },
-            }
-
-            data = json.dumps(cmd_msg).encode()
-            self.cmd_connection.sendto(data, ("127.0.0.1", 0))
+        cmd_msg = {
+            "type": "command",
+            "version": self.PROTOCOL_VERSION,
+            "magic": self.MAGIC,
+            "source": "ue_mcp",
+            "dest": self.unreal_node_id,
+            "data": {
+                "command": command,
+                "unattended": True,
+                "exec_mode": exec_type,
+            },
+        }
+
+        pending = _PendingCommand(self._next_request_id, json.dumps(cmd_msg).encode())
+        self._next_request_id += 1
+        self._queued.append(pending)
+        self._send_queued()
+        return pending.request_id
+
+    def _send_queued(self) -> None:
+        """Write queued commands while fewer than max_in_flight are awaiting responses."""
+        while self._queued and len(self._in_flight) < self.max_in_flight:
+            pending = self._queued.popleft()
+            self.cmd_connection.sendall(pending.payload)
+            self._in_flight.append(pending)
+
+    def _receive_responses(self, timeout: float) -> None:
+        """Receive once from the command connection and dispatch completed responses."""
+        self.cmd_connection.settimeout(max(timeout, 0.001))
+        data = self.cmd_connection.recv(self.BUFFER_SIZE)
+        if not data:
+            raise ConnectionResetError("Command connection closed by UE5")
+
+        for message in self._decoder.feed(data):
+            if message.get("type") == "command":
+                continue  # Ignore echo
+            if not self._in_flight:
+                logger.debug(f"Discarding unexpected message: {message.get('type')}")
+                continue
+            pending = self._in_flight.popleft()
+            if not pending.abandoned:
+                self._responses[pending.request_id] = message
+
+        self._send_queued()
+
+    def collect(self, request_id: int, timeout: float = 30.0) -> dict[str, Any]:
+        """
+        Wait for the result of a submitted command.
 
-            # Receive result
-            self.cmd_connection.settimeout(timeout)
-            data_received = b""
-            result_data = None
+        Responses to other commands that arrive first are kept for their own collect().
 
-            while True:
-                try:
-                    recv_data, _ = self.cmd_connection.recvfrom(self.BUFFER_SIZE)
-                    data_received += recv_data
+        Args:
+            request_id: Value returned by submit()
+            timeout: Maximum time to wait for this command's response
 
-                    try:
-                        json_data = json.loads(data_received)
-                        data_received = b""
-                    except json.JSONDecodeError:
-                        continue
+        Returns:
+            Dictionary with execution result, same format as execute()
+        """
+        deadline = time.monotonic() + timeout
+        while request_id not in self._responses:
+            remaining = deadline - time.monotonic()
+            if remaining <= 0:
+                break
+            try:
+                self._receive_responses(remaining)
+            except socket.timeout:
+                break
+
+        result_data = self._responses.pop(request_id, None)
+        if result_data is None:
+            # The late response (if any) must not be taken as the next command's result
+            for pending in (*self._in_flight, *self._queued):
+                if pending.request_id == request_id:
+                    pending.abandoned = True
+            self._queued = deque(p for p in self._queued if p.request_id != request_id)
+            return {"success": False, "error": "No response from UE5", "output": []}
+
+        success = result_data.get("data", {}).get("success", False)
+        result = result_data.get("data", {}).get("result", "")
+        output = result_data.get("data", {}).get("output", [])
+
+        logger.info(f"Command executed: {'Success' if success else 'Failed'}")
+
+        return {
+            "success": success,
+            "result": result,
+            "output": output,
+        }
 
-                    if json_data.get("type") == "command":
-                        continue  # Ignore echo
+    def execute(
+        self,
+        command: str,
+        exec_type: Optional[str] = None,
+        timeout: float = 30.0,
+    ) -> dict[str, Any]:
+        """
+        Execute Python command in UE5.
 
-                    result_data = json_data
-                    break
+        Args:
+            command: Python code or file path
+            exec_type: ExecTypes.EXECUTE_FILE, EXECUTE_STATEMENT, or EVALUATE_STATEMENT
+            timeout: Timeout for command execution
 
-                except socket.timeout:
-                    break
+        Returns:
+            Dictionary with execution result
+        """
+        return self.execute_many([command], exec_type=exec_type, timeout=timeout)[0]
 
-            if result_data:
-                success = result_data.get("data", {}).get("success", False)
-                result = result_data.get("data", {}).get("result", "")
-                output = result_data.get("data", {}).get("output", [])
+    def execute_many(
+        self,
+        commands: list[str],
+        exec_type: Optional[str] = None,
+        timeout: float = 30.0,
+    ) -> list[dict[str, Any]]:
+        """
+        Execute several Python commands in UE5, pipelined on the command connection.
 
-                logger.info(f"Command executed: {'Success' if success else 'Failed'}")
+        Args:
+            commands: Python code strings or file paths, executed in order
+            exec_type: ExecTypes.EXECUTE_FILE, EXECUTE_STATEMENT, or EVALUATE_STATEMENT
+            timeout: Timeout for each command's execution
 
-                return {
-                    "success": success,
-                    "result": result,
-                    "output": output,
-                }
-            else:
-                return {"success": False, "error": "No response from UE5", "output": []}
+        Returns:
+            One result dictionary per command, in the same order
+        """
+        results: list[dict[str, Any]] = []
+        try:
+            request_ids = [self.submit(command, exec_type) for command in commands]
+            for request_id in request_ids:
+                results.append(self.collect(request_id, timeout=timeout))
+            return results
 
         except (ConnectionResetError, BrokenPipeError, ConnectionAbortedError) as e:
             logger.error(f"Connection lost during command execution: {e}")
-            return {"success": False, "error": str(e), "crashed": True, "output": []}
+            self._reset_command_channel()
+            error = {"success": False, "error": str(e), "crashed": True, "output": []}
         except OSError as e:
+            self._reset_command_channel()
             if "connection" in str(e).lower() or "broken pipe" in str(e).lower():
                 logger.error(f"Connection lost during command execution: {e}")
-                return {"success": False, "error": str(e), "crashed": True, "output": []}
+                error = {"success": False, "error": str(e), "crashed": True, "output": []}
             else:
                 logger.error(f"Command execution failed: {e}")
-                return {"success": False, "error": str(e), "crashed": False, "output": []}
+                error = {"success": False, "error": str(e), "crashed": False, "output": []}
         except Exception as e:
             logger.error(f"Command execution failed: {e}")
-            return {"success": False, "error": str(e), "crashed": False, "output": []}
+            self._reset_command_channel()
+            error = {"success": False, "error": str(e), "crashed": False, "output": []}
+
+        return results + [dict(error) for _ in range(len(commands) - len(results))]
 
     def close_connection(self) -> None:
         """Close connection to UE5."""
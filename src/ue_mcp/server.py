@@ -204,6 +204,7 @@ Available tools:
 - editor_execute_script: Execute a Python script file in the editor
 - editor_configure: Check and fix project configuration
 - editor_pip_install: Install Python packages in UE5's Python environment
+- editor_execution_stats: Per-phase latency percentiles of recent executions
 - editor_start_pie: Start a Play-In-Editor (PIE) session
 - editor_stop_pie: Stop the current Play-In-Editor (PIE) session
 - editor_load_level: Load a level in the editor
@@ -7,7 +7,7 @@ from pathlib import Path
 from typing import TYPE_CHECKING, Any, Callable, Optional
 
 # Import shared constants from core module
-from ..core.constants import ENV_VAR_CALL, ENV_VAR_MODE, INJECT_TIME_MAX_AGE
+from ..core.constants import ENV_VAR_CALL, ENV_VAR_MODE, ENV_VAR_RESULT, INJECT_TIME_MAX_AGE
 
 if TYPE_CHECKING:
     from fastmcp import Context
@@ -20,7 +20,8 @@ logger = logging.getLogger(__name__)
 def parse_json_result(exec_result: dict[str, Any]) -> dict[str, Any]:
     """Parse JSON result from script output.
 
-    Extracts the last valid JSON object from output.
+    Uses the out-of-band result (exec_result["script_result"]) when the script
+    wrote a result file. Otherwise extracts the last valid JSON object from output.
     Handles both string output (with log prefixes) and list output formats.
     This is the standard way to parse results from all standalone scripts.
 
@@ -36,6 +37,9 @@ def parse_json_result(exec_result: dict[str, Any]) -> dict[str, Any]:
             "error": exec_result.get("error", "Execution failed"),
         }
 
+    if "script_result" in exec_result:
+        return exec_result["script_result"]
+
     output = exec_result.get("output", [])
     if not output:
         return {"success": False, "error": "No output from script"}
@@ -71,7 +75,7 @@ def parse_json_result(exec_result: dict[str, Any]) -> dict[str, Any]:
     return {"success": False, "error": "No valid JSON found in output"}
 
 
-def query_project_assets(execution: "ExecutionManager") -> dict[str, Any]:
+async def query_project_assets(execution: "ExecutionManager") -> dict[str, Any]:
     """Query Blueprint and World (Level) assets in the project.
 
     Args:
@@ -89,7 +93,7 @@ def query_project_assets(execution: "ExecutionManager") -> dict[str, Any]:
             return {"success": False, "error": "Asset query script not found"}
 
         # Query Blueprint and World assets
-        exec_result = execution._execute_script_with_params(
+        exec_result = await execution._execute_script_with_params(
             str(script_path),
             {"types": "Blueprint,World", "base_path": "/Game", "limit": 100},
             timeout=30.0,
@@ -148,8 +152,62 @@ def compute_script_checksum(script_path: str) -> str:
     return hashlib.md5(script_path.encode()).hexdigest()[:8]
 
 
+def build_output_capture_code(output_file: str) -> str:
+    """Build code that tees the editor's stdout/stderr into a file.
+
+    The file is flushed on every write, so it can be tailed while the script runs
+    (see core/output_stream.py). The original streams are restored by the cleanup
+    code run after the script, or at exit.
+
+    Args:
+        output_file: Path of the file receiving stdout/stderr
+
+    Returns:
+        Python code string to execute before EXECUTE_FILE
+    """
+    # Escape backslashes for Windows paths (don't use raw string prefix)
+    escaped_output_file = output_file.replace("\\", "\\\\")
+    lines = [
+        "import sys",
+        "import builtins",
+        "import atexit",
+        # Store original streams
+        "builtins.__ue_mcp_orig_stdout__ = sys.stdout",
+        "builtins.__ue_mcp_orig_stderr__ = sys.stderr",
+        # Open output file for writing
+        f"builtins.__ue_mcp_output_file__ = open('{escaped_output_file}', 'w', encoding='utf-8')",
+        # Create a TeeWriter that writes to both the file and original stream
+        "class _UeMcpTeeWriter:",
+        "    def __init__(self, file, original):",
+        "        self.file = file",
+        "        self.original = original",
+        "    def write(self, data):",
+        "        self.file.write(data)",
+        "        self.file.flush()",
+        "        self.original.write(data)",
+        "    def flush(self):",
+        "        self.file.flush()",
+        "        self.original.flush()",
+        "sys.stdout = _UeMcpTeeWriter(builtins.__ue_mcp_output_file__, builtins.__ue_mcp_orig_stdout__)",
+        "sys.stderr = _UeMcpTeeWriter(builtins.__ue_mcp_output_file__, builtins.__ue_mcp_orig_stderr__)",
+        # Register cleanup function to restore streams and close file
+        "def _ue_mcp_cleanup():",
+        "    if hasattr(builtins, '__ue_mcp_orig_stdout__'):",
+        "        sys.stdout = builtins.__ue_mcp_orig_stdout__",
+        "    if hasattr(builtins, '__ue_mcp_orig_stderr__'):",
+        "        sys.stderr = builtins.__ue_mcp_orig_stderr__",
+        "    if hasattr(builtins, '__ue_mcp_output_file__'):",
+        "        builtins.__ue_mcp_output_file__.close()",
+        "atexit.register(_ue_mcp_cleanup)",
+    ]
+    return "\n".join(lines)
+
+
 def build_env_injection_code(
-    script_path: str, params: dict[str, Any], output_file: str | None = None
+    script_path: str,
+    params: dict[str, Any],
+    output_file: str | None = None,
+    result_file: str | None = None,
 ) -> str:
     """Build code to inject parameters via environment variables.
 
@@ -163,11 +221,14 @@ def build_env_injection_code(
     - json_params: JSON-encoded parameters
 
     If output_file is provided, sets up stdout/stderr capture to that file using TeeWriter.
+    If result_file is provided, sets UE_MCP_RESULT so output_result() writes the script
+    result there instead of printing it.
 
     Args:
         script_path: Absolute path to the script file
         params: Parameter dictionary (None values are filtered out)
         output_file: Optional path to file for capturing stdout/stderr output
+        result_file: Optional path of the out-of-band result file
 
     Returns:
         Python code string to execute before EXECUTE_FILE
@@ -198,45 +259,12 @@ def build_env_injection_code(
         # Set call info: "<checksum>:<timestamp>:<json_params>"
         f"os.environ[{repr(ENV_VAR_CALL)}] = f'{checksum}:{{time.time()}}:{escaped_params_json}'",
     ]
+    if result_file:
+        lines.append(f"os.environ[{repr(ENV_VAR_RESULT)}] = {repr(result_file)}")
 
     # Add output capture setup if output_file is provided
     if output_file:
-        # Escape backslashes for Windows paths (don't use raw string prefix)
-        escaped_output_file = output_file.replace("\\", "\\\\")
-        lines.extend(
-            [
-                "import builtins",
-                "import atexit",
-                # Store original streams
-                "builtins.__ue_mcp_orig_stdout__ = sys.stdout",
-                "builtins.__ue_mcp_orig_stderr__ = sys.stderr",
-                # Open output file for writing
-                f"builtins.__ue_mcp_output_file__ = open('{escaped_output_file}', 'w', encoding='utf-8')",
-                # Create a TeeWriter that writes to both the file and original stream
-                "class _UeMcpTeeWriter:",
-                "    def __init__(self, file, original):",
-                "        self.file = file",
-                "        self.original = original",
-                "    def write(self, data):",
-                "        self.file.write(data)",
-                "        self.file.flush()",
-                "        self.original.write(data)",
-                "    def flush(self):",
-                "        self.file.flush()",
-                "        self.original.flush()",
-                "sys.stdout = _UeMcpTeeWriter(builtins.__ue_mcp_output_file__, builtins.__ue_mcp_orig_stdout__)",
-                "sys.stderr = _UeMcpTeeWriter(builtins.__ue_mcp_output_file__, builtins.__ue_mcp_orig_stderr__)",
-                # Register cleanup function to restore streams and close file
-                "def _ue_mcp_cleanup():",
-                "    if hasattr(builtins, '__ue_mcp_orig_stdout__'):",
-                "        sys.stdout = builtins.__ue_mcp_orig_stdout__",
-                "    if hasattr(builtins, '__ue_mcp_orig_stderr__'):",
-                "        sys.stderr = builtins.__ue_mcp_orig_stderr__",
-                "    if hasattr(builtins, '__ue_mcp_output_file__'):",
-                "        builtins.__ue_mcp_output_file__.close()",
-                "atexit.register(_ue_mcp_cleanup)",
-            ]
-        )
+        lines.append(build_output_capture_code(output_file))
 
     return "\n".join(lines)
 
@@ -252,12 +280,13 @@ async def run_pie_task(
     output_key: str,
     output_value: str,
     result_processor: Optional[Callable[[dict[str, Any]], dict[str, Any]]] = None,
+    needs_rendering: bool = True,
 ) -> dict[str, Any]:
     """Execute a PIE task with common logic for capture and trace tools.
 
     This function encapsulates the shared pattern between editor_capture_pie
     and editor_trace_actors_in_pie tools:
-    - Auto-launch editor if not running
+    - Auto-launch editor if not running (headless if the task renders nothing)
     - Generate unique task_id
     - Execute script via ExecutionManager
     - Monitor completion via watch_pie_capture_complete
@@ -274,6 +303,8 @@ async def run_pie_task(
         output_key: Key name for output file/directory in error response
         output_value: Value for output file/directory in error response
         result_processor: Optional function to process the final result dict
+        needs_rendering: False for tasks that only need transforms and script output;
+            an auto-launched editor then runs headless (-nullrhi)
 
     Returns:
         Result dict from the PIE task execution
@@ -287,7 +318,7 @@ async def run_pie_task(
         await ctx.log(message, level=level)
 
     # Ensure editor is ready (may auto-launch)
-    ensure_result = await execution._ensure_editor_ready(notify)
+    ensure_result = await execution._ensure_editor_ready(notify, needs_rendering=needs_rendering)
     if ensure_result is not None:
         return ensure_result
 
@@ -299,7 +330,7 @@ async def run_pie_task(
 
     # Start task (returns immediately, runs via tick callbacks)
     script_path = get_capture_scripts_dir() / f"{script_name}.py"
-    result = execution._execute_script_with_params(
+    result = await execution._execute_script_with_params(
         str(script_path),
         params=params_with_id,
         timeout=30.0,  # Short timeout since script returns immediately
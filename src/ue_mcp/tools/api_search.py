@@ -1,5 +1,6 @@
 """UE5 Python API search tool."""
 
+import logging
 from typing import TYPE_CHECKING, Annotated, Any
 
 from pydantic import Field
@@ -9,14 +10,76 @@ if TYPE_CHECKING:
 
     from ..state import ServerState
 
+logger = logging.getLogger(__name__)
+
+# Building the index reflects the whole unreal module (tens of seconds on large projects)
+BUILD_INDEX_TIMEOUT = 600.0
+
 
 def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
     """Register API search tools."""
 
+    from ..core.api_index import (
+        INDEX_MODES,
+        ApiIndex,
+        ApiIndexError,
+        api_index_dir,
+        load_api_index,
+    )
     from ..core.paths import get_scripts_dir
 
     from ._helpers import parse_json_result
 
+    script_path = get_scripts_dir() / "api_search.py"
+
+    async def _load_api_index() -> "ApiIndex | None":
+        """
+        Get the API index for the running editor, building it on first use.
+
+        The index key is asked from the editor once per editor session. Index files
+        are shared across sessions, so the build only runs when the API surface
+        (engine version, plugins, reflected project code) changed.
+
+        Returns:
+            ApiIndex, or None if it could not be obtained (queries fall back to the editor)
+        """
+        execution = state.get_execution_subsystem()
+        ctx = state.get_context()
+
+        key = ctx.editor.api_index_key if ctx.editor else None
+        if key is None:
+            result = parse_json_result(
+                await execution.execute_script(
+                    str(script_path), params={"mode": "index_key"}, timeout=30.0
+                )
+            )
+            key = result.get("key")
+            if not key:
+                logger.warning(f"Failed to get API index key: {result.get('error')}")
+                return None
+            if ctx.editor:
+                ctx.editor.api_index_key = key
+
+        index_path = api_index_dir(ctx.project_root) / f"{key}.json"
+        if not index_path.exists():
+            logger.info(f"Building API index {index_path}")
+            result = parse_json_result(
+                await execution.execute_script(
+                    str(script_path),
+                    params={"mode": "build_index", "index_path": str(index_path)},
+                    timeout=BUILD_INDEX_TIMEOUT,
+                )
+            )
+            if not result.get("success"):
+                logger.warning(f"Failed to build API index: {result.get('error')}")
+                return None
+
+        try:
+            return load_api_index(index_path)
+        except ApiIndexError as e:
+            logger.warning(str(e))
+            return None
+
     @mcp.tool(name="python_api_search")
     async def python_api_search(
         mode: Annotated[
@@ -56,6 +119,10 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
 
         This tool introspects the live 'unreal' module in the running editor,
         providing accurate API information for the current UE5 version.
+        The module is reflected once into a persistent index
+        (Saved/UEMCP/ApiIndex) that answers all modes except member_info
+        without running code in the editor; the index is rebuilt automatically
+        when the engine version, enabled plugins or reflected code change.
 
         If the editor is not running, it will be automatically launched.
 
@@ -65,7 +132,8 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
                 - "list_functions": List functions/methods (supports multiple formats, see below)
                 - "class_info": Get class details with all members (requires query)
                 - "member_info": Get specific member details (requires query)
-                - "search": Fuzzy search across all names (requires query)
+                - "search": Ranked fuzzy search over names, signatures and
+                  docstrings (requires query)
             query: Depends on mode:
                 - list_classes: Optional wildcard pattern (e.g., "*Actor*", "Static*")
                 - list_functions: Multiple formats supported:
@@ -75,7 +143,9 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
                     - "*.*pattern*": Search methods across all classes (e.g., "*.*spawn*")
                 - class_info: Class name (e.g., "Actor")
                 - member_info: Member path (e.g., "Actor.get_actor_location")
-                - search: Search term (e.g., "spawn")
+                - search: Search term; words, camelCase/snake_case names, hump
+                  initials and typos all match (e.g., "spawn actor", "spawnActor",
+                  "sma" for StaticMeshActor, "spwan")
             include_inherited: For class_info: include inherited members (default: True)
             include_private: Include private members starting with underscore (default: False)
             limit: Maximum number of results to return (default: 100)
@@ -120,6 +190,9 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
 
             # Search for spawn-related APIs
             python_api_search(mode="search", query="spawn")
+
+            # Search by hump initials (StaticMeshComponent)
+            python_api_search(mode="search", query="smc")
         """
         execution = state.get_execution_subsystem()
 
@@ -144,8 +217,18 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
                 "error": f"query parameter required for mode '{mode}'",
             }
 
+        if mode in INDEX_MODES:
+            index = await _load_api_index()
+            if index is not None:
+                return index.query(
+                    mode,
+                    query=query,
+                    include_inherited=include_inherited,
+                    include_private=include_private,
+                    limit=limit,
+                )
+
         # Execute api_search script
-        script_path = get_scripts_dir() / "api_search.py"
         params = {
             "mode": mode,
             "query": query,
@@ -1,7 +1,7 @@
 """Screenshot capture and actor tracing tools."""
 
 from pathlib import Path
-from typing import TYPE_CHECKING, Annotated, Any, Optional
+from typing import TYPE_CHECKING, Annotated, Any, Literal, Optional
 
 from fastmcp import Context
 from pydantic import Field
@@ -183,6 +183,23 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
                 description="Whether to capture multiple angles per actor",
             ),
         ],
+        output_format: Annotated[
+            Literal["json", "columnar"],
+            Field(
+                default="json",
+                description="Sample output format: 'json' (per-sample transform.json files) "
+                "or 'columnar' (single trace.uetrace file, read with editor_read_trace)",
+            ),
+        ],
+        fixed_step_seconds: Annotated[
+            Optional[float],
+            Field(
+                default=None,
+                description="Fixed simulation step in seconds (e.g. 0.016667 for 60 Hz). "
+                "PIE then runs as fast as the machine allows and timestamps are simulation "
+                "time. Default: real time",
+            ),
+        ],
     ) -> dict[str, Any]:
         """
         Trace actor transforms during Play-In-Editor (PIE) session.
@@ -208,6 +225,18 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
             │       └── ...
             └── ...
 
+        With output_format="columnar", transform.json files are not written; all samples
+        go to output_dir/trace.uetrace instead. Use editor_read_trace to slice it by actor
+        and tick range.
+
+        Without screenshots, an editor auto-launched for the trace runs headless
+        (-nullrhi), so no GPU is needed.
+
+        With fixed_step_seconds, every PIE frame advances the simulation by exactly
+        that step without waiting for real time (requires the ExtraPythonAPIs plugin).
+        duration_seconds, interval_seconds and timestamps are then simulation time,
+        and the trace usually finishes several times faster than real time.
+
         Args:
             output_dir: Output directory for trace data (required)
             level: Path to the level to load (required)
@@ -220,6 +249,8 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
             resolution_width: Screenshot width in pixels (default: 800)
             resolution_height: Screenshot height in pixels (default: 600)
             multi_angle: Whether to capture multiple angles per actor (default: True)
+            output_format: "json" or "columnar" (default: "json")
+            fixed_step_seconds: Fixed simulation step in seconds (default: None, real time)
 
         Returns:
             Result containing:
@@ -230,13 +261,16 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
             - sample_count: Number of samples collected
             - actor_count: Number of actors successfully tracked
             - actors_not_found: List of actor names that weren't found
+            - trace_file: Path to trace.uetrace (columnar format only)
+            - clock: "fixed_step" or "realtime"
+            - wall_time: Real seconds the trace took
         """
         execution = state.get_execution_subsystem()
         context = state.get_context()
 
         def process_trace_result(trace_result: dict[str, Any]) -> dict[str, Any]:
             """Process trace result and extract relevant fields."""
-            return {
+            processed = {
                 "success": trace_result.get("success", False),
                 "output_dir": trace_result.get("output_dir", output_dir),
                 "duration": trace_result.get("duration", 0),
@@ -245,6 +279,10 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
                 "actor_count": trace_result.get("actor_count", 0),
                 "actors_not_found": trace_result.get("actors_not_found", []),
             }
+            for key in ("trace_file", "clock", "wall_time"):
+                if trace_result.get(key) is not None:
+                    processed[key] = trace_result[key]
+            return processed
 
         return await run_pie_task(
             ctx=ctx,
@@ -263,6 +301,8 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
                 "resolution_width": resolution_width,
                 "resolution_height": resolution_height,
                 "multi_angle": multi_angle,
+                "output_format": output_format,
+                "fixed_step": fixed_step_seconds,
             },
             duration_seconds=duration_seconds,
             task_description="PIE actor tracing"
@@ -270,8 +310,81 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
             output_key="output_dir",
             output_value=output_dir,
             result_processor=process_trace_result,
+            needs_rendering=capture_screenshots,
         )
 
+    @mcp.tool(name="editor_read_trace")
+    async def read_trace(
+        trace_file: Annotated[
+            str,
+            Field(
+                description="Path to a trace.uetrace file, or the trace output_dir containing it"
+            ),
+        ],
+        actor_names: Annotated[
+            Optional[list[str]],
+            Field(
+                default=None,
+                description="Actors to return, by object path or unique label "
+                "(default: all actors)",
+            ),
+        ],
+        tick_start: Annotated[
+            Optional[int],
+            Field(default=None, description="First tick to include (inclusive)"),
+        ],
+        tick_end: Annotated[
+            Optional[int],
+            Field(default=None, description="Last tick to include (inclusive)"),
+        ],
+        columns: Annotated[
+            Optional[list[str]],
+            Field(
+                default=None,
+                description="Columns to return (default: all). Available: tick, timestamp, "
+                "location_x/y/z, rotation_pitch/yaw/roll, velocity_x/y/z",
+            ),
+        ],
+        max_samples: Annotated[
+            int,
+            Field(default=1000, ge=0, description="Maximum samples returned per actor"),
+        ],
+    ) -> dict[str, Any]:
+        """
+        Read a slice of a columnar actor trace written by editor_trace_actors_in_pie
+        with output_format="columnar".
+
+        Runs on the server only (no editor round trip). The trace file is memory-mapped
+        and only the requested actors, tick range and columns are decoded.
+
+        Returns:
+            Result containing:
+            - success: Whether the trace was read
+            - trace_file: Resolved trace file path
+            - metadata: Trace metadata (level, interval, sampling backend)
+            - actors: Per-actor object path (name), label, sample count and tick
+              range for the whole trace
+            - columns: Available column names
+            - samples: {actor object path: {count, truncated, <column>: [values]}}
+            - error: Error message (if failed)
+        """
+        from ..core.trace_file import TraceFileError
+        from ..core.trace_file import read_trace as read_trace_file
+
+        try:
+            result = read_trace_file(
+                trace_file,
+                actor_names=actor_names,
+                tick_start=tick_start,
+                tick_end=tick_end,
+                columns=columns,
+                max_samples=max_samples,
+            )
+        except TraceFileError as e:
+            return {"success": False, "error": str(e)}
+
+        return {"success": True, **result}
+
     @mcp.tool(name="editor_pie_execute_in_tick")
     async def pie_execute_in_tick(
         ctx: Context,
@@ -290,7 +403,8 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
         Execute Python code snippets at specific ticks during PIE session.
 
         Automatically starts PIE, executes code snippets at specified ticks,
-        then stops PIE and returns execution results.
+        then stops PIE and returns execution results. An editor auto-launched
+        for this runs headless (-nullrhi): snippets cannot rely on rendering.
 
         Args:
             level: Path to the level to load (required)
@@ -307,8 +421,9 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
             - total_ticks: Total ticks configured
             - executed_ticks: Actual ticks executed
             - execution_count: Number of code executions performed
-            - executions: List of execution results (snippet_index, tick, success, output)
+            - executions: List of execution results (snippet_index, tick, success, output, exec_ms)
             - errors: List of any errors encountered
+            - snippet_timings: Per-snippet compile_ms and exec count/total/avg/max ms
         """
         execution = state.get_execution_subsystem()
         context = state.get_context()
@@ -322,6 +437,7 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
                 "execution_count": exec_result.get("execution_count", 0),
                 "executions": exec_result.get("executions", []),
                 "errors": exec_result.get("errors", []),
+                "snippet_timings": exec_result.get("snippet_timings", []),
             }
 
         # Estimate duration based on ticks (assume ~60 FPS, add buffer)
@@ -342,6 +458,7 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
             output_key="total_ticks",
             output_value=str(total_ticks),
             result_processor=process_executor_result,
+            needs_rendering=False,
         )
 
     @mcp.tool(name="editor_capture_window")
@@ -442,7 +559,7 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
         execution = state.get_execution_subsystem()
 
         # Ensure editor is ready (may auto-launch)
-        ensure_result = await execution._ensure_editor_ready()
+        ensure_result = await execution._ensure_editor_ready(needs_rendering=True)
         if ensure_result is not None:
             return ensure_result
 
@@ -463,7 +580,7 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
             params["output_dir"] = output_dir
 
         script_path = get_capture_scripts_dir() / "capture_window.py"
-        result = execution._execute_script_with_params(
+        result = await execution._execute_script_with_params(
             str(script_path),
             params=params,
             timeout=120.0,
@@ -582,6 +699,11 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
         if level:
             params["level"] = level
 
+        # Screenshots need a rendering editor (relaunches a headless one)
+        ensure_result = await execution._ensure_editor_ready(needs_rendering=True)
+        if ensure_result is not None:
+            return ensure_result
+
         # Execute the take_screenshots.py script
         script_path = get_scripts_dir() / "take_screenshots.py"
 
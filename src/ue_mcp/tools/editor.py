@@ -54,6 +54,14 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
                 description="Whether to pass -unattended flag to suppress crash dialogs",
             ),
         ],
+        headless: Annotated[
+            bool,
+            Field(
+                default=False,
+                description="Launch with rendering disabled (-nullrhi, unattended) for "
+                "tasks that need no screenshots, e.g. on machines without a GPU",
+            ),
+        ],
     ) -> dict[str, Any]:
         """
         Launch Unreal Editor for the bound project.
@@ -69,6 +77,8 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
             wait: Whether to wait for the editor to connect before returning (default: True)
             wait_timeout: Maximum time in seconds to wait for editor connection (default: 120)
             unattended: Whether to pass -unattended flag to suppress crash dialogs (default: False)
+            headless: Launch with rendering disabled (default: False). Screenshot tools
+                      report an error instead of rendering; relaunch without headless.
 
         Returns:
             Launch result with status information.
@@ -96,6 +106,7 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
                 additional_paths=all_paths if all_paths else None,
                 wait_timeout=wait_timeout,
                 unattended=unattended,
+                headless=headless,
             )
         else:
             result = await lifecycle.launch_async(
@@ -103,11 +114,12 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
                 additional_paths=all_paths if all_paths else None,
                 wait_timeout=wait_timeout,
                 unattended=unattended,
+                headless=headless,
             )
 
         # Query project assets if launch was successful
         if result.get("success"):
-            assets_result = query_project_assets(execution)
+            assets_result = await query_project_assets(execution)
             if assets_result.get("success"):
                 result["project_assets"] = assets_result.get("assets", {})
             else:
@@ -3,6 +3,7 @@
 from pathlib import Path
 from typing import TYPE_CHECKING, Annotated, Any
 
+from fastmcp import Context
 from pydantic import Field
 
 if TYPE_CHECKING:
@@ -20,6 +21,13 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
         timeout: Annotated[
             float, Field(default=30.0, description="Execution timeout in seconds")
         ],
+        include_timings: Annotated[
+            bool,
+            Field(
+                default=False,
+                description="Include a per-phase latency breakdown (milliseconds) in the result",
+            ),
+        ] = False,
     ) -> dict[str, Any]:
         """
         Execute Python code in the managed Unreal Editor.
@@ -32,6 +40,7 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
         Args:
             code: Python code to execute
             timeout: Execution timeout in seconds (default: 30)
+            include_timings: Include the per-phase latency breakdown (default: False)
 
         Returns:
             Execution result containing:
@@ -39,15 +48,17 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
             - result: Return value (if any)
             - output: Console output from the code
             - error: Error message (if failed)
+            - timings: {"total_ms", "phases_ms"} (if include_timings)
 
         Example:
             execute_code("import unreal; print(unreal.EditorAssetLibrary.list_assets('/Game/'))")
         """
         execution = state.get_execution_subsystem()
-        return await execution.execute_code(code, timeout=timeout)
+        return await execution.execute_code(code, timeout=timeout, timings=include_timings)
 
     @mcp.tool(name="editor_execute_script")
     async def execute_script(
+        ctx: Context,
         script_path: Annotated[
             str, Field(description="Path to the Python script file to execute")
         ],
@@ -82,6 +93,13 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
                 description="Maximum time in seconds to wait for latent commands to complete",
             ),
         ] = 60.0,
+        include_timings: Annotated[
+            bool,
+            Field(
+                default=False,
+                description="Include a per-phase latency breakdown (milliseconds) in the result",
+            ),
+        ] = False,
     ) -> dict[str, Any]:
         """
         Execute a Python script file in the managed Unreal Editor.
@@ -93,6 +111,9 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
         For scripts using @unreal.AutomationScheduler.add_latent_command (async execution),
         the tool will wait for all latent commands to complete before returning output.
 
+        The script's stdout/stderr is streamed to the client as log notifications
+        while it runs; the returned output keeps at most the last 256 KB.
+
         Scripts must call bootstrap_from_env() at the start of main() to
         read parameters from env vars and set up sys.argv for argparse.
 
@@ -105,6 +126,7 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
             kwargs: Dictionary of keyword arguments accessible via __SCRIPT_ARGS__ global variable
             wait_for_latent: Whether to wait for async latent commands to complete (default: True)
             latent_timeout: Max time to wait for latent commands in seconds (default: 60)
+            include_timings: Include the per-phase latency breakdown (default: False)
 
         Returns:
             Execution result containing:
@@ -113,6 +135,7 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
             - output: Console output from the script
             - error: Error message (if failed)
             - latent_warning: Warning if latent commands did not complete in time
+            - timings: {"total_ms", "phases_ms"} (if include_timings)
 
         Example:
             execute_script("/path/to/my_script.py")
@@ -147,6 +170,11 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
             if kwargs:
                 params.update(kwargs)
 
+        # Create notification callback using ctx.log
+        async def notify(level: str, message: str) -> None:
+            """Send notification to client via MCP log message."""
+            await ctx.log(message, level=level)
+
         execution = state.get_execution_subsystem()
         return await execution.execute_script(
             str(path),
@@ -154,8 +182,44 @@ def register_tools(mcp: "FastMCP", state: "ServerState") -> None:
             params=params,
             wait_for_latent=wait_for_latent,
             latent_timeout=latent_timeout,
+            notify=notify,
+            timings=include_timings,
         )
 
+    @mcp.tool(name="editor_execution_stats")
+    def execution_stats(
+        reset: Annotated[
+            bool,
+            Field(default=False, description="Clear the collected samples after reading them"),
+        ] = False,
+    ) -> dict[str, Any]:
+        """
+        Get per-phase latency percentiles of recent code and script executions.
+
+        Every editor_execute_code / editor_execute_script call records how long
+        each phase took (syntax check, inspection, editor-side API check, import
+        probe, tracking captures, execution, change diff, UI refresh). This
+        returns p50/p90/p99/max over a rolling window of recent calls.
+
+        Args:
+            reset: Clear the collected samples after reading them (default: False)
+
+        Returns:
+            Statistics containing:
+            - success: Always True
+            - operations: {"execute_code" | "execute_script": {
+                  "calls": total calls recorded,
+                  "window": calls kept for the percentiles,
+                  "phases_ms": {phase: {"count", "p50", "p90", "p99", "max"}}}}
+              The "total" phase is the whole call.
+        """
+        execution = state.get_execution_subsystem()
+        stats = execution.latency_stats
+        result = {"success": True, "operations": stats.summary()}
+        if reset:
+            stats.reset()
+        return result
+
     @mcp.tool(name="editor_pip_install")
     async def pip_install_packages(
         packages: Annotated[
@@ -6,16 +6,22 @@ Change tracking for actors and assets in UE5 projects.
 
 from .actor_snapshot import (
     compare_level_actor_snapshots,
-    create_level_actor_snapshot,
+    load_packed_snapshot,
+    parse_packed_actor_snapshot,
 )
 from .asset_tracker import (
     compare_snapshots,
-    create_snapshot,
     extract_game_paths,
     extract_level_paths,
-    get_current_level_path,
     get_dirty_asset_paths,
-    get_snapshot_script_path,
+)
+from .execution_tracking import (
+    TrackedExecution,
+    TrackingChanges,
+    build_tracked_code,
+    capture_post_execution,
+    capture_pre_execution,
+    compute_changes,
 )
 from .log_watcher import (
     CompletionWatcher,
@@ -24,16 +30,21 @@ from .log_watcher import (
 
 __all__ = [
     # Actor snapshot
-    "create_level_actor_snapshot",
     "compare_level_actor_snapshots",
+    "load_packed_snapshot",
+    "parse_packed_actor_snapshot",
     # Asset tracker
     "extract_game_paths",
     "extract_level_paths",
-    "get_snapshot_script_path",
-    "get_current_level_path",
     "get_dirty_asset_paths",
-    "create_snapshot",
     "compare_snapshots",
+    # Bundled execution tracking
+    "TrackedExecution",
+    "TrackingChanges",
+    "build_tracked_code",
+    "capture_pre_execution",
+    "capture_post_execution",
+    "compute_changes",
     # Log watcher
     "CompletionWatcher",
     "watch_pie_capture_complete",
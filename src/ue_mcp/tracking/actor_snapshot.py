@@ -4,154 +4,82 @@ Actor-based level change tracking for UE-MCP.
 Works with OFPA mode by tracking actors directly instead of file timestamps.
 """
 
-import json
 import logging
+from pathlib import Path
 from typing import Any
 
-from ..core.constants import MARKER_ACTOR_SNAPSHOT_RESULT
-
 logger = logging.getLogger(__name__)
 
+# Path, label, class + 9 transform values per line of an ExLevelSnapshotLibrary buffer
+_PACKED_FIELD_COUNT = 12
+
 
-def create_level_actor_snapshot(manager, level_paths: list[str] | None = None) -> dict[str, Any] | None:
+def load_packed_snapshot(summary: dict[str, Any]) -> dict[str, Any] | None:
     """
-    Create a snapshot of all actors in the specified levels.
+    Read the packed file written by ExLevelSnapshotLibrary into the snapshot format.
 
     Args:
-        manager: ExecutionManager instance
-        level_paths: Optional list of level asset paths to snapshot (e.g., ["/Game/Maps/TestLevel"]).
-                    If None or empty, snapshots the currently loaded level.
+        summary: Native snapshot summary from editor_capture.execution_tracking
+            ({"packed_file", "asset_path", "actor_count", "current_level"})
 
     Returns:
-        Snapshot dictionary with actor data for all levels, or None if failed.
-        Format: {
-            "levels": {
-                "/Game/Maps/TestLevel": {
-                    "level_path": "/Game/Maps/TestLevel.TestLevel:PersistentLevel",
-                    "actor_count": 10,
-                    "actors": {...}
-                },
-                ...
-            },
-            "current_level": "/Game/Maps/CurrentLevel.CurrentLevel:PersistentLevel"
-        }
+        {"levels": {asset_path: {...}}, "current_level"}, or None if the file is
+        missing or does not hold actor_count actors
     """
-    import json as json_module
-
-    # Build the list of level paths to pass to the script
-    level_paths_json = json_module.dumps(level_paths or [])
+    try:
+        text = Path(summary["packed_file"]).read_text(encoding="utf-8")
+    except OSError as e:
+        logger.warning(f"Failed to read packed actor snapshot: {e}")
+        return None
 
-    code = f"""import json
-import unreal
+    actors = parse_packed_actor_snapshot(text)
+    if len(actors) != summary.get("actor_count", len(actors)):
+        logger.warning(
+            f"Packed actor snapshot has {len(actors)} actors, "
+            f"expected {summary.get('actor_count')}"
+        )
+        return None
 
-level_paths_to_check = {level_paths_json}
+    current_level = summary.get("current_level", "Unknown")
+    return {
+        "levels": {
+            summary.get("asset_path", current_level): {
+                "level_path": current_level,
+                "actor_count": len(actors),
+                "actors": actors,
+            }
+        },
+        "current_level": current_level,
+    }
 
-# Initialize variables for cleanup in finally block
-editor_sub = None
-actor_sub = None
-world = None
-current_level = None
-all_actors = None
 
-try:
-    editor_sub = unreal.get_editor_subsystem(unreal.UnrealEditorSubsystem)
-    actor_sub = unreal.get_editor_subsystem(unreal.EditorActorSubsystem)
-    world = editor_sub.get_editor_world()
+def parse_packed_actor_snapshot(text: str) -> dict[str, dict[str, Any]]:
+    """
+    Parse the packed buffer produced by ExLevelSnapshotLibrary.
 
-    if not world:
-        print("ACTOR_SNAPSHOT_RESULT:" + json.dumps({{"error": "No world loaded"}}))
-    else:
-        current_level = world.get_outer()
-        current_level_path = current_level.get_path_name() if current_level else "Unknown"
-
-        levels_data = {{}}
-
-        # Always snapshot the current level
-        all_actors = actor_sub.get_all_level_actors()
-        actors_data = {{}}
-        for actor in all_actors:
-            try:
-                path_name = actor.get_path_name()
-                loc = actor.get_actor_location()
-                rot = actor.get_actor_rotation()
-                scale = actor.get_actor_scale3d()
-                actors_data[path_name] = {{
-                    "label": actor.get_actor_label(),
-                    "class": actor.get_class().get_name(),
-                    "location": [loc.x, loc.y, loc.z],
-                    "rotation": [rot.pitch, rot.yaw, rot.roll],
-                    "scale": [scale.x, scale.y, scale.z],
-                }}
-            except Exception:
-                pass
-
-        # Extract asset path from full level path (remove .LevelName:PersistentLevel suffix)
-        current_asset_path = current_level_path.split(".")[0] if "." in current_level_path else current_level_path
-        levels_data[current_asset_path] = {{
-            "level_path": current_level_path,
-            "actor_count": len(actors_data),
-            "actors": actors_data,
-        }}
-
-        # Note: Streaming level snapshot not supported - UE5 Python API doesn't expose
-        # Level.get_level_actors() or World.get_streaming_levels() for sub-level access.
-        # Only the current persistent level is snapshotted.
-
-        result = {{
-            "levels": levels_data,
-            "current_level": current_level_path,
-        }}
-        print("ACTOR_SNAPSHOT_RESULT:" + json.dumps(result))
-except Exception as e:
-    print("ACTOR_SNAPSHOT_RESULT:" + json.dumps({{"error": str(e)}}))
-finally:
-    # Clean up references to prevent World memory leaks
-    # Use explicit cleanup since del locals()[x] doesn't work reliably
-    all_actors = None
-    world = None
-    current_level = None
-    editor_sub = None
-    actor_sub = None
-"""
+    Each line is: path, label, class, then location xyz, rotation pitch/yaw/roll and
+    scale xyz, separated by tabs. Malformed lines are skipped.
 
-    result = manager._execute_code_impl(code, timeout=30.0)
-    if not result.get("success"):
-        logger.debug(f"Failed to create actor snapshot: {result.get('error')}")
-        return None
-    output = result.get("output", [])
-    output_str = ""
-    if isinstance(output, list):
-        for line in output:
-            if isinstance(line, dict):
-                output_str += str(line.get("output", ""))
-            else:
-                output_str += str(line)
-    else:
-        output_str = str(output)
-    if MARKER_ACTOR_SNAPSHOT_RESULT in output_str:
-        json_str = output_str.split(MARKER_ACTOR_SNAPSHOT_RESULT, 1)[1].strip()
+    Returns:
+        {actor_path: {"label", "class", "location", "rotation", "scale"}}
+    """
+    actors: dict[str, dict[str, Any]] = {}
+    for line in text.split("\n"):
+        fields = line.split("\t")
+        if len(fields) != _PACKED_FIELD_COUNT:
+            continue
         try:
-            brace_count = 0
-            end_idx = 0
-            for i, char in enumerate(json_str):
-                if char == "{":
-                    brace_count += 1
-                elif char == "}":
-                    brace_count -= 1
-                    if brace_count == 0:
-                        end_idx = i + 1
-                        break
-            json_str = json_str[:end_idx]
-            snapshot = json.loads(json_str)
-            if "error" in snapshot:
-                logger.debug(f"Actor snapshot error: {snapshot['error']}")
-                return None
-            return snapshot
-        except json.JSONDecodeError as e:
-            logger.warning(f"Failed to parse actor snapshot JSON: {e}")
-            return None
-    logger.debug("No ACTOR_SNAPSHOT_RESULT found in output")
-    return None
+            values = [float(v) for v in fields[3:]]
+        except ValueError:
+            continue
+        actors[fields[0]] = {
+            "label": fields[1],
+            "class": fields[2],
+            "location": values[0:3],
+            "rotation": values[3:6],
+            "scale": values[6:9],
+        }
+    return actors
 
 
 def compare_level_actor_snapshots(
@@ -0,0 +1,197 @@
+"""
+Bundled pre/post execution tracking for UE-MCP.
+
+Asset and actor change tracking used to cost a remote call each for the current
+level, the asset cursor or snapshot, the actor cursor or snapshot, and the same
+again after execution, plus one for dirty packages. The editor-side
+editor_capture.execution_tracking module captures all of them together, and
+build_tracked_code() wraps user code between its pre and post captures, so a
+tracked execute_code is a single request. Scripts, which run as files, use
+capture_pre_execution() and capture_post_execution() around the script instead.
+
+Both ways return a pre/post state pair, turned into changes by compute_changes().
+"""
+
+import json
+import logging
+import tempfile
+import uuid
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Any
+
+from ..core.result_file import new_result_file_path, take_result_file
+from .actor_snapshot import compare_level_actor_snapshots, load_packed_snapshot
+from .asset_tracker import compare_snapshots
+
+logger = logging.getLogger(__name__)
+
+_TRACKER_MODULE = "editor_capture.execution_tracking"
+
+
+@dataclass
+class TrackedExecution:
+    """Temporary files of one tracked execution."""
+
+    result_file: str = field(default_factory=lambda: new_result_file_path("ue_mcp_tracking"))
+    packed_files: tuple[str, str] = field(
+        default_factory=lambda: tuple(
+            str(Path(tempfile.gettempdir()) / f"ue_mcp_actor_snapshot_{uuid.uuid4().hex[:8]}.tsv")
+            for _ in range(2)
+        )
+    )
+
+    def take(self) -> Any:
+        """Read the result file written by the editor; None if there is none."""
+        return take_result_file(self.result_file)
+
+    def cleanup(self) -> None:
+        """Remove the result and packed snapshot files."""
+        Path(self.result_file).unlink(missing_ok=True)
+        for packed_file in self.packed_files:
+            Path(packed_file).unlink(missing_ok=True)
+
+
+@dataclass
+class TrackingChanges:
+    """Changes reported by a tracked execution."""
+
+    asset_changes: list[str] = field(default_factory=list)
+    actor_changes: dict[str, list[str]] = field(default_factory=dict)
+    dirty_assets: list[str] = field(default_factory=list)
+    refreshed: bool = False
+
+
+def build_tracked_code(
+    code: str,
+    game_paths: list[str],
+    project_dir: str,
+    tracked: TrackedExecution,
+    prelude: str = "",
+) -> str:
+    """
+    Wrap user code so pre-tracking, the code and post-tracking run in one request.
+
+    The user code keeps its own line numbers (it is compiled separately in the
+    editor). If it raises, no tracking result is written.
+
+    Args:
+        code: User code
+        game_paths: Asset directories referenced by the code
+        project_dir: Project directory
+        tracked: Temporary files for this execution
+        prelude: Code to run before the user code (bundled module unloading)
+
+    Returns:
+        Code to execute in the editor
+    """
+    options = {
+        "result_file": tracked.result_file,
+        "game_paths": game_paths,
+        "project_dir": project_dir,
+        "packed_files": list(tracked.packed_files),
+    }
+    return (
+        f"import {_TRACKER_MODULE} as _ue_mcp_tracking\n"
+        f"_ue_mcp_tracking.run_tracked({code!r}, {options!r}, globals(), prelude={prelude!r})\n"
+    )
+
+
+async def capture_pre_execution(
+    manager, game_paths: list[str], project_dir: str, tracked: TrackedExecution
+) -> dict[str, Any] | None:
+    """
+    Capture the pre-execution tracking state in one request (for scripts).
+
+    Returns:
+        Pre-execution state, or None if it could not be captured
+    """
+    code = f"""from {_TRACKER_MODULE} import capture_pre_execution
+from editor_capture.result_file import write_result_file
+
+write_result_file({tracked.result_file!r}, capture_pre_execution(
+    {game_paths!r}, {project_dir!r}, {tracked.packed_files[0]!r}
+))
+"""
+    return await _run_capture(manager, code, tracked)
+
+
+async def capture_post_execution(
+    manager, pre: dict[str, Any], project_dir: str, tracked: TrackedExecution
+) -> dict[str, Any] | None:
+    """
+    Capture the post-execution tracking state matching pre in one request (for scripts).
+
+    Snapshots stay on the server; only the cursors and paths are sent back.
+
+    Returns:
+        Post-execution state, or None if it could not be captured
+    """
+    pre_keys = {k: pre[k] for k in ("game_paths", "asset_cursor", "actor_cursor") if k in pre}
+    for key in ("asset_snapshot", "actor_snapshot"):
+        if key in pre:
+            pre_keys[key] = True
+    code = f"""import json
+from {_TRACKER_MODULE} import capture_post_execution
+from editor_capture.result_file import write_result_file
+
+write_result_file({tracked.result_file!r}, capture_post_execution(
+    json.loads({json.dumps(pre_keys)!r}), {project_dir!r}, {tracked.packed_files[1]!r}
+))
+"""
+    return await _run_capture(manager, code, tracked)
+
+
+async def _run_capture(manager, code: str, tracked: TrackedExecution) -> dict[str, Any] | None:
+    result = await manager._execute_code_impl(code, timeout=30.0)
+    state = tracked.take()
+    if not result.get("success") or state is None:
+        logger.debug(f"Tracking capture failed: {result.get('error')}")
+        return None
+    return state
+
+
+def _actor_snapshot(snapshot: Any) -> dict[str, Any] | None:
+    """Normalize an editor actor snapshot (packed summary or full) to snapshot format."""
+    if not isinstance(snapshot, dict) or "error" in snapshot:
+        if isinstance(snapshot, dict):
+            logger.debug(f"Actor snapshot error: {snapshot['error']}")
+        return None
+    if "packed_file" in snapshot:
+        return load_packed_snapshot(snapshot)
+    return snapshot
+
+
+def compute_changes(pre: dict[str, Any], post: dict[str, Any]) -> TrackingChanges:
+    """
+    Turn a pre/post tracking state pair into changes.
+
+    Journal results are used as they are; snapshot pairs are compared with
+    compare_snapshots() and compare_level_actor_snapshots().
+    """
+    changes = TrackingChanges(
+        dirty_assets=list(post.get("dirty_assets", [])),
+        refreshed=bool(post.get("refreshed")),
+    )
+    for error in pre.get("errors", []) + post.get("errors", []):
+        logger.warning(f"Execution tracking: {error}")
+
+    if "asset_changes" in post:
+        changes.asset_changes = sorted(post["asset_changes"])
+    elif "asset_snapshot" in pre and "asset_snapshot" in post:
+        changes.asset_changes = compare_snapshots(pre["asset_snapshot"], post["asset_snapshot"])
+
+    if "actor_changes" in post:
+        journal = post["actor_changes"]
+        changes.actor_changes = journal.get("levels", {})
+        if not journal.get("complete", True):
+            logger.warning(
+                "Actor journal evicted entries since the cursor; "
+                "changed actor lists may be incomplete"
+            )
+    elif "actor_snapshot" in pre and "actor_snapshot" in post:
+        before = _actor_snapshot(pre["actor_snapshot"])
+        after = _actor_snapshot(post["actor_snapshot"])
+        if before and after:
+            changes.actor_changes = compare_level_actor_snapshots(before, after)
+    return changes
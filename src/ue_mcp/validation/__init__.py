@@ -4,6 +4,7 @@ UE-MCP Validation Module
 Code inspection and validation before remote execution.
 """
 
+from .api_path_cache import ApiPathCache
 from .code_inspector import (
     BaseChecker,
     BlockingCallChecker,
@@ -13,8 +14,11 @@ from .code_inspector import (
     InspectionResult,
     IssueSeverity,
     UnrealAPIChecker,
+    UnrealAPIReference,
+    collect_unreal_api_references,
     get_inspector,
     inspect_code,
+    validate_unreal_api_paths,
 )
 
 __all__ = [
@@ -27,6 +31,11 @@ __all__ = [
     "BlockingCallChecker",
     "DeprecatedAPIChecker",
     "UnrealAPIChecker",
+    # Unreal API validation
+    "UnrealAPIReference",
+    "collect_unreal_api_references",
+    "validate_unreal_api_paths",
+    "ApiPathCache",
     # Inspector
     "CodeInspector",
     "get_inspector",
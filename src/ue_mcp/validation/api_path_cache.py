@@ -0,0 +1,41 @@
+"""
+Server-side cache of unreal API paths known to exist, per engine build.
+
+The editor resolves API paths for UnrealAPIChecker (validate_unreal_api_paths) and
+reports its engine build. Paths it confirmed are remembered here, so code that only
+uses known APIs skips the editor round trip entirely.
+"""
+
+from typing import Dict, Iterable, List, Set
+
+
+class ApiPathCache:
+    """Valid dotted API paths keyed by engine build string."""
+
+    def __init__(self) -> None:
+        self._valid: Dict[str, Set[str]] = {}
+
+    def unknown(self, engine_build: str | None, paths: Iterable[str]) -> List[str]:
+        """
+        Return the paths not yet confirmed for an engine build, in input order.
+
+        Args:
+            engine_build: Engine build of the target editor (None = not known yet)
+            paths: Dotted API paths
+
+        Returns:
+            Unique paths that still need editor validation
+        """
+        known = self._valid.get(engine_build, set()) if engine_build else set()
+        return [p for p in dict.fromkeys(paths) if p not in known]
+
+    def add_valid(self, engine_build: str, paths: Iterable[str]) -> None:
+        """Remember paths the editor confirmed for an engine build."""
+        self._valid.setdefault(engine_build, set()).update(paths)
+
+    def clear(self) -> None:
+        """Forget all builds."""
+        self._valid.clear()
+
+    def __len__(self) -> int:
+        return sum(len(paths) for paths in self._valid.values())
@@ -438,6 +438,50 @@ class DeprecatedAPIChecker(BaseChecker):
         return None
 
 
+@dataclass(frozen=True)
+class UnrealAPIReference:
+    """One reference to an unreal API in inspected code."""
+
+    path: tuple[str, ...]  # Attribute chain below the unreal module, e.g. ("EditorAssetLibrary", "list_assets")
+    line_number: int
+    from_import: bool = False  # True for `from unreal import X`
+
+    @property
+    def dotted(self) -> str:
+        """The path without the module prefix, e.g. "EditorAssetLibrary.list_assets"."""
+        return ".".join(self.path)
+
+
+# API paths (dotted) that resolved in this process. The unreal module of a running
+# editor only ever gains attributes, so valid paths never need to be resolved again.
+_valid_api_paths: Set[str] = set()
+
+
+def resolve_unreal_api_path(path: tuple[str, ...], unreal_module) -> Optional[str]:
+    """
+    Resolve an API path against the unreal module, using the per-process cache.
+
+    Args:
+        path: Attribute chain below the unreal module
+        unreal_module: The imported unreal module
+
+    Returns:
+        The first attribute that does not exist, or None if the whole path is valid
+    """
+    dotted = ".".join(path)
+    if dotted in _valid_api_paths:
+        return None
+
+    current = unreal_module
+    for index, attr in enumerate(path):
+        if not hasattr(current, attr):
+            return attr
+        current = getattr(current, attr)
+        # Cache every valid prefix so sibling paths resolve from the cache too
+        _valid_api_paths.add(".".join(path[: index + 1]))
+    return None
+
+
 class UnrealAPIChecker(BaseChecker):
     """
     Detects calls to unreal module APIs and validates their existence.
@@ -447,8 +491,10 @@ class UnrealAPIChecker(BaseChecker):
     - Chained API calls: unreal.SomeClass.some_method
     - From imports: from unreal import Something
 
-    Note: This checker requires the unreal module to be available.
-    If unreal is not importable, the checker will be skipped.
+    Collecting references (collect_references) does not need the unreal module, so
+    the server can extract them and have the editor resolve only the paths (see
+    validate_unreal_api_paths). check() does both in-process and is skipped if
+    unreal is not importable.
     """
 
     @property
@@ -461,21 +507,38 @@ class UnrealAPIChecker(BaseChecker):
 
     def check(self, tree: ast.AST, code: str) -> List[InspectionIssue]:
         """Check for invalid unreal API calls."""
-        issues: List[InspectionIssue] = []
-
         # Try to import unreal module
         try:
             import unreal
         except ImportError:
             # unreal module not available, skip this check
             logger.debug("unreal module not available, skipping UnrealAPIChecker")
-            return issues
+            return []
+
+        references = self.collect_references(tree)
+        invalid = {}
+        for reference in references:
+            if reference.dotted not in invalid:
+                invalid_attr = resolve_unreal_api_path(reference.path, unreal)
+                if invalid_attr is not None:
+                    invalid[reference.dotted] = invalid_attr
+        return self.build_issues(references, invalid)
+
+    def collect_references(self, tree: ast.AST) -> List[UnrealAPIReference]:
+        """
+        Collect every unreal API reference in the code, in AST walk order.
+
+        Args:
+            tree: Parsed code
+
+        Returns:
+            References from `from unreal import X` statements and `unreal.X.y`
+            attribute chains (decorators are skipped)
+        """
+        references: List[UnrealAPIReference] = []
 
-        # Track unreal module aliases and direct imports
-        # unreal_aliases: names that refer to the unreal module (e.g., "unreal" or "u")
-        # direct_imports: names imported from unreal (e.g., from unreal import EditorAssetLibrary)
+        # Track unreal module aliases (e.g., "unreal" or "u")
         unreal_aliases: Set[str] = set()
-        direct_imports: Dict[str, str] = {}  # alias -> original_name
 
         # Collect decorator nodes - these should be skipped during validation
         # because decorators may reference APIs that aren't accessible via hasattr()
@@ -500,57 +563,64 @@ class UnrealAPIChecker(BaseChecker):
             elif isinstance(node, ast.ImportFrom):
                 if node.module == "unreal":
                     for alias in node.names:
-                        # from unreal import Something / from unreal import Something as S
-                        imported_name = alias.asname if alias.asname else alias.name
-                        direct_imports[imported_name] = alias.name
-
-                        # Validate that the imported name exists
-                        if not hasattr(unreal, alias.name):
-                            issues.append(
-                                InspectionIssue(
-                                    severity=IssueSeverity.ERROR,
-                                    checker=self.name,
-                                    message=f"Cannot import '{alias.name}' from unreal module (does not exist)",
-                                    line_number=node.lineno,
-                                    suggestion="Check the API name spelling or refer to UE5 Python API documentation",
-                                )
-                            )
-
-        # Second pass: find unreal API attribute accesses and validate them
+                        references.append(
+                            UnrealAPIReference((alias.name,), node.lineno, from_import=True)
+                        )
+
+        # Second pass: find unreal API attribute accesses
         for node in ast.walk(tree):
             if isinstance(node, ast.Attribute):
                 # Skip decorator nodes - they may reference APIs not accessible via hasattr()
                 if id(node) in decorator_nodes:
                     continue
 
-                # Extract the API path if this is an unreal API call
                 api_path = self._extract_api_path(node, unreal_aliases)
                 if api_path:
-                    # Validate the API path
-                    valid, invalid_attr, _ = self._validate_api_path(api_path, unreal)
-                    if not valid:
-                        # Build the full path string for error message
-                        full_path = "unreal." + ".".join(api_path)
-                        # Find where it breaks
-                        valid_path = "unreal." + ".".join(api_path[: api_path.index(invalid_attr)])
-
-                        issues.append(
-                            InspectionIssue(
-                                severity=IssueSeverity.ERROR,
-                                checker=self.name,
-                                message=f"API '{full_path}' does not exist ('{invalid_attr}' not found in {valid_path})",
-                                line_number=node.lineno,
-                                suggestion="Check the API name spelling or refer to UE5 Python API documentation",
-                            )
-                        )
+                    references.append(UnrealAPIReference(tuple(api_path), node.lineno))
+
+        return references
+
+    def build_issues(
+        self, references: List[UnrealAPIReference], invalid: Dict[str, str]
+    ) -> List[InspectionIssue]:
+        """
+        Build issues for references whose path failed to resolve.
+
+        Args:
+            references: References from collect_references()
+            invalid: {dotted path: first attribute that does not exist}
 
-            # Also check direct use of imported names
-            elif isinstance(node, ast.Name):
-                if node.id in direct_imports:
-                    # The name itself is valid (we checked it during import),
-                    # but we could add additional checks here if needed
-                    pass
+        Returns:
+            One ERROR issue per invalid reference
+        """
+        issues: List[InspectionIssue] = []
+        for reference in references:
+            invalid_attr = invalid.get(reference.dotted)
+            if invalid_attr is None:
+                continue
 
+            if reference.from_import:
+                message = f"Cannot import '{invalid_attr}' from unreal module (does not exist)"
+            else:
+                # Build the full path string for error message
+                full_path = "unreal." + reference.dotted
+                # Find where it breaks
+                valid_path = "unreal." + ".".join(
+                    reference.path[: reference.path.index(invalid_attr)]
+                )
+                message = (
+                    f"API '{full_path}' does not exist ('{invalid_attr}' not found in {valid_path})"
+                )
+
+            issues.append(
+                InspectionIssue(
+                    severity=IssueSeverity.ERROR,
+                    checker=self.name,
+                    message=message,
+                    line_number=reference.line_number,
+                    suggestion="Check the API name spelling or refer to UE5 Python API documentation",
+                )
+            )
         return issues
 
     def _extract_api_path(
@@ -584,28 +654,6 @@ class UnrealAPIChecker(BaseChecker):
 
         return None
 
-    def _validate_api_path(self, path: List[str], unreal_module) -> tuple[bool, Optional[str], Any]:
-        """
-        Validate that an API path exists in the unreal module.
-
-        Args:
-            path: List of attribute names, e.g., ['EditorAssetLibrary', 'list_assets']
-            unreal_module: The imported unreal module
-
-        Returns:
-            Tuple of (valid, invalid_attr, last_valid_obj):
-            - valid: True if the entire path exists
-            - invalid_attr: The first attribute that doesn't exist (None if all valid)
-            - last_valid_obj: The last valid object in the path
-        """
-        current = unreal_module
-        for attr in path:
-            if not hasattr(current, attr):
-                return False, attr, current
-            current = getattr(current, attr)
-
-        return True, None, current
-
 
 class CodeInspector:
     """
@@ -709,3 +757,45 @@ def inspect_code(code: str) -> InspectionResult:
             print(result.format_error())
     """
     return get_inspector().inspect(code)
+
+
+def collect_unreal_api_references(code: str) -> List[UnrealAPIReference]:
+    """
+    Collect unreal API references without needing the unreal module.
+
+    Args:
+        code: Python source code
+
+    Returns:
+        References in AST walk order (empty if the code does not parse)
+    """
+    try:
+        tree = ast.parse(code)
+    except SyntaxError:
+        return []
+    return UnrealAPIChecker().collect_references(tree)
+
+
+def validate_unreal_api_paths(paths: List[str]) -> Dict[str, Any]:
+    """
+    Editor-side entry point for server-driven API validation.
+
+    The server sends only the dotted API paths it extracted from the code (see
+    collect_unreal_api_references), so this module stays imported in the editor and
+    resolved paths are answered from the per-process cache.
+
+    Args:
+        paths: Dotted paths below the unreal module, e.g. ["EditorAssetLibrary.list_assets"]
+
+    Returns:
+        {"engine_build": engine version string,
+         "invalid": {dotted path: first attribute that does not exist}}
+    """
+    import unreal
+
+    invalid = {}
+    for dotted in paths:
+        invalid_attr = resolve_unreal_api_path(tuple(dotted.split(".")), unreal)
+        if invalid_attr is not None:
+            invalid[dotted] = invalid_attr
+    return {"engine_build": unreal.SystemLibrary.get_engine_version(), "invalid": invalid}
@@ -0,0 +1,414 @@
+"""
+Remote execution benchmarks against FakeUENode.
+
+Measures the server-side hot path without a UE5 editor:
+
+- discovery: find_unreal_instance() + open_connection() wall time
+- command_latency: round trip of a trivial EXECUTE_STATEMENT
+- payload_scaling: round trip for growing command and output sizes
+- concurrent_calls: many tool calls awaiting one connection at once, and how
+  responsive the event loop stays while they wait
+- tracking_overhead: ExecutionManager checked execution (bundled tracking,
+  journal and actor-snapshot modes) against a plain execution
+
+All measurements go through AsyncRemoteExecutionClient, the server's transport.
+
+The editor side is the fake node, so the numbers cover protocol, socket and
+server-side costs only; command execution itself is near-free.
+
+Results can be written as JSON and compared against a previous run; a metric
+slower than baseline * (1 + tolerance) fails the comparison.
+
+Usage:
+    python -m tests.benchmark_remote_execution
+    python -m tests.benchmark_remote_execution --json bench.json
+    python -m tests.benchmark_remote_execution --baseline bench.json --tolerance 0.5
+"""
+
+import argparse
+import asyncio
+import json
+import statistics
+import sys
+import tempfile
+import time
+from contextlib import asynccontextmanager
+from pathlib import Path
+from types import SimpleNamespace
+from typing import Any, AsyncIterator, Awaitable, Callable
+
+from tests.fake_ue_node import FakeUENode, make_stub_unreal
+from ue_mcp.async_remote_client import AsyncRemoteExecutionClient
+from ue_mcp.core.endpoint_cache import EndpointCache
+from ue_mcp.core.import_cache import ImportCache
+from ue_mcp.core.port_allocator import find_available_port
+from ue_mcp.core.timings import PhaseTimer, percentile
+from ue_mcp.editor.context import EditorContext
+from ue_mcp.editor.execution_manager import ExecutionManager
+
+# Away from the default editor port (6766) and the allocator range (6767-6866)
+BENCH_PORT_RANGE = (16766, 16865)
+
+PROJECT_NAME = "BenchProject"
+PAYLOAD_SIZES = (1_024, 16_384, 262_144, 1_048_576)
+SNAPSHOT_ACTORS = 1_000
+CONCURRENT_CALLS = 32
+# Simulated editor time per command in the concurrency benchmark
+CONCURRENT_COMMAND_DELAY = 0.002
+
+
+def _summarize(samples: list[float]) -> dict[str, float]:
+    """Milliseconds summary of samples in seconds."""
+    values = sorted(samples)
+    return {
+        "count": len(values),
+        "mean_ms": round(statistics.fmean(values) * 1000.0, 3),
+        "p50_ms": round(percentile(values, 50) * 1000.0, 3),
+        "p90_ms": round(percentile(values, 90) * 1000.0, 3),
+        "p99_ms": round(percentile(values, 99) * 1000.0, 3),
+    }
+
+
+async def _timed(fn: Callable[[], Awaitable[Any]], iterations: int) -> list[float]:
+    samples = []
+    for _ in range(iterations):
+        start = time.perf_counter()
+        await fn()
+        samples.append(time.perf_counter() - start)
+    return samples
+
+
+def _check(result: dict[str, Any]) -> None:
+    if not result.get("success"):
+        raise RuntimeError(f"Benchmark command failed: {result}")
+
+
+async def connect(node: FakeUENode, discovery_timeout: float) -> AsyncRemoteExecutionClient:
+    """Discover the node and open the command connection."""
+    client = AsyncRemoteExecutionClient(
+        multicast_group=node.multicast_group, project_name=node.project_name
+    )
+    if not await client.find_unreal_instance(timeout=discovery_timeout):
+        client.close_connection()
+        raise RuntimeError("Fake node not discovered (is loopback multicast available?)")
+    if not await client.open_connection():
+        client.close_connection()
+        raise RuntimeError("Could not open the command connection to the fake node")
+    return client
+
+
+@asynccontextmanager
+async def connected(
+    node: FakeUENode, discovery_timeout: float
+) -> AsyncIterator[AsyncRemoteExecutionClient]:
+    """connect(), closing the connection on exit."""
+    client = await connect(node, discovery_timeout)
+    try:
+        yield client
+    finally:
+        client.close_connection()
+
+
+# =============================================================================
+# Benchmarks
+# =============================================================================
+
+
+async def bench_discovery(node: FakeUENode, iterations: int, discovery_timeout: float) -> dict:
+    """Wall time of discovery plus connection setup."""
+    discovery, connection = [], []
+    for _ in range(iterations):
+        client = AsyncRemoteExecutionClient(
+            multicast_group=node.multicast_group, project_name=node.project_name
+        )
+        start = time.perf_counter()
+        found = await client.find_unreal_instance(timeout=discovery_timeout)
+        found_at = time.perf_counter()
+        opened = found and await client.open_connection()
+        opened_at = time.perf_counter()
+        client.close_connection()
+        if not opened:
+            raise RuntimeError("Fake node not discovered or connection failed")
+        discovery.append(found_at - start)
+        connection.append(opened_at - found_at)
+    return {
+        "discovery_timeout_s": discovery_timeout,
+        "discovery": _summarize(discovery),
+        "open_connection": _summarize(connection),
+    }
+
+
+async def _execute_checked(client: AsyncRemoteExecutionClient, command: str) -> None:
+    statement = client.ExecTypes.EXECUTE_STATEMENT
+    _check(await client.execute(command, exec_type=statement))
+
+
+async def bench_command_latency(client: AsyncRemoteExecutionClient, iterations: int) -> dict:
+    """Round trip of a trivial statement."""
+    samples = await _timed(lambda: _execute_checked(client, "x = 1"), iterations)
+    return _summarize(samples)
+
+
+async def bench_payload_scaling(client: AsyncRemoteExecutionClient, iterations: int) -> dict:
+    """Round trip for growing command payloads and command output."""
+    results: dict[str, Any] = {"command": {}, "output": {}}
+    for size in PAYLOAD_SIZES:
+        command = f"_payload = {'x' * size!r}"
+        samples = await _timed(lambda: _execute_checked(client, command), iterations)
+        summary = _summarize(samples)
+        summary["mb_per_s"] = round(size / 1_048_576 / (summary["p50_ms"] / 1000.0), 2)
+        results["command"][str(size)] = summary
+
+        command = f"print('y' * {size})"
+        samples = await _timed(lambda: _execute_checked(client, command), iterations)
+        summary = _summarize(samples)
+        summary["mb_per_s"] = round(size / 1_048_576 / (summary["p50_ms"] / 1000.0), 2)
+        results["output"][str(size)] = summary
+    return results
+
+
+async def bench_concurrent_calls(
+    client: AsyncRemoteExecutionClient, node: FakeUENode, iterations: int
+) -> dict:
+    """
+    CONCURRENT_CALLS executions awaiting the connection at once.
+
+    Each command takes CONCURRENT_COMMAND_DELAY in the editor, which runs them
+    one at a time, so a batch is bounded by CONCURRENT_CALLS * delay. While the
+    batch waits, a ticker measures how late the event loop wakes it up.
+    """
+    statement = client.ExecTypes.EXECUTE_STATEMENT
+    lateness: list[float] = []
+
+    async def ticker(done: asyncio.Event) -> None:
+        while not done.is_set():
+            start = time.perf_counter()
+            await asyncio.sleep(0.001)
+            lateness.append(time.perf_counter() - start - 0.001)
+
+    async def batch() -> None:
+        done = asyncio.Event()
+        tick = asyncio.create_task(ticker(done))
+        try:
+            calls = [f"print({i})" for i in range(CONCURRENT_CALLS)]
+            results = await asyncio.gather(
+                *(client.execute(call, exec_type=statement) for call in calls)
+            )
+        finally:
+            done.set()
+            await tick
+        for i, result in enumerate(results):
+            _check(result)
+            if result["output"][0]["output"] != str(i):
+                raise RuntimeError(f"Result {i} matched to the wrong command: {result}")
+
+    original_delay = node.command_delay
+    node.command_delay = CONCURRENT_COMMAND_DELAY
+    try:
+        batches = await _timed(batch, max(1, iterations // 10))
+    finally:
+        node.command_delay = original_delay
+    return {
+        "calls": CONCURRENT_CALLS,
+        "command_delay_ms": CONCURRENT_COMMAND_DELAY * 1000.0,
+        "batch": _summarize(batches),
+        "loop_lag": _summarize(lateness),
+    }
+
+
+def _execution_manager(client: AsyncRemoteExecutionClient, node: FakeUENode) -> ExecutionManager:
+    """ExecutionManager bound to the fake node's connection."""
+    editor = SimpleNamespace(
+        status="ready",
+        remote_client=client,
+        node_id=node.node_id,
+        process=SimpleNamespace(pid=node.pid),
+        multicast_port=node.multicast_group[1],
+        import_cache=ImportCache(),
+    )
+    context = EditorContext(
+        project_path=Path(tempfile.gettempdir()) / f"{node.project_name}.uproject",
+        project_root=Path(tempfile.gettempdir()),
+        project_name=node.project_name,
+        endpoint_cache=EndpointCache(None),
+    )
+    context.editor = editor
+    manager = ExecutionManager(context)
+
+    # The editor-side API inspector needs the real unreal module; not benchmarked here
+    async def skip_api_check(code: str) -> None:
+        return None
+
+    manager._check_unreal_api = skip_api_check
+    return manager
+
+
+async def bench_tracking_overhead(
+    client: AsyncRemoteExecutionClient, node: FakeUENode, iterations: int
+) -> dict:
+    """Checked execution (with bundled tracking) against a plain execution."""
+    manager = _execution_manager(client, node)
+    code = "import math\nvalue = math.sqrt(2)\n"
+
+    async def plain():
+        _check(await manager._execute_code_impl(code))
+
+    results: dict[str, Any] = {"plain": _summarize(await _timed(plain, iterations))}
+
+    modes = {
+        "journals": make_stub_unreal(journals=True),
+        f"snapshots_{SNAPSHOT_ACTORS}_actors": make_stub_unreal(
+            journals=False, actor_count=SNAPSHOT_ACTORS
+        ),
+    }
+    original = node.unreal_module
+    try:
+        for name, unreal in modes.items():
+            node.set_unreal_module(unreal)
+            phases: dict[str, list[float]] = {}
+
+            async def checked():
+                timer = PhaseTimer()
+                _check(await manager._execute_with_checks_impl(code, timer=timer))
+                for phase, seconds in timer.phases.items():
+                    phases.setdefault(phase, []).append(seconds)
+
+            summary = _summarize(await _timed(checked, iterations))
+            summary["phases_p50_ms"] = {
+                phase: round(percentile(sorted(s), 50) * 1000.0, 3) for phase, s in phases.items()
+            }
+            results[name] = summary
+    finally:
+        node.set_unreal_module(original)
+    return results
+
+
+def run_benchmarks(
+    iterations: int = 50,
+    discovery_iterations: int = 3,
+    discovery_timeout: float = 1.0,
+    port: int | None = None,
+) -> dict[str, Any]:
+    """
+    Run all benchmarks against a fresh fake node.
+
+    Args:
+        iterations: Samples per latency / payload / tracking measurement
+        discovery_iterations: Samples of the discovery measurement
+        discovery_timeout: Timeout passed to find_unreal_instance()
+        port: Multicast port (default: a free port in BENCH_PORT_RANGE)
+
+    Returns:
+        Results by benchmark name
+    """
+    port = port or find_available_port(*BENCH_PORT_RANGE)
+    with FakeUENode(project_name=PROJECT_NAME, multicast_group=("239.0.0.1", port)) as node:
+        return asyncio.run(
+            _run_benchmarks(node, iterations, discovery_iterations, discovery_timeout)
+        )
+
+
+async def _run_benchmarks(
+    node: FakeUENode, iterations: int, discovery_iterations: int, discovery_timeout: float
+) -> dict[str, Any]:
+    results: dict[str, Any] = {
+        "python": sys.version.split()[0],
+        "platform": sys.platform,
+        "iterations": iterations,
+        "discovery": await bench_discovery(node, discovery_iterations, discovery_timeout),
+    }
+    async with connected(node, discovery_timeout) as client:
+        results["command_latency"] = await bench_command_latency(client, iterations)
+        results["payload_scaling"] = await bench_payload_scaling(client, iterations)
+        client.max_in_flight = CONCURRENT_CALLS
+        results["concurrent_calls"] = await bench_concurrent_calls(client, node, iterations)
+        client.max_in_flight = client.DEFAULT_MAX_IN_FLIGHT
+        results["tracking_overhead"] = await bench_tracking_overhead(client, node, iterations)
+    return results
+
+
+# =============================================================================
+# Baseline comparison
+# =============================================================================
+
+
+def flatten_metrics(results: dict[str, Any], prefix: str = "") -> dict[str, float]:
+    """Comparable metrics (p50/p90 milliseconds, lower is better) by dotted name."""
+    metrics: dict[str, float] = {}
+    for key, value in results.items():
+        name = f"{prefix}{key}"
+        if isinstance(value, dict):
+            metrics.update(flatten_metrics(value, f"{name}."))
+        elif key in ("p50_ms", "p90_ms") and isinstance(value, (int, float)):
+            metrics[name] = float(value)
+    return metrics
+
+
+def compare_to_baseline(
+    results: dict[str, Any], baseline: dict[str, Any], tolerance: float
+) -> list[str]:
+    """
+    Metrics that regressed beyond tolerance.
+
+    Args:
+        results: Current results
+        baseline: Results of an earlier run
+        tolerance: Allowed relative slowdown (0.5 = 50% slower)
+
+    Returns:
+        One line per regression
+    """
+    current = flatten_metrics(results)
+    regressions = []
+    for name, before in flatten_metrics(baseline).items():
+        after = current.get(name)
+        if after is None or before <= 0:
+            continue
+        # Sub-millisecond metrics jitter by more than their value; allow 1 ms of noise
+        if after > before * (1.0 + tolerance) and after - before > 1.0:
+            regressions.append(f"{name}: {before:.3f} ms -> {after:.3f} ms")
+    return regressions
+
+
+def _print_results(results: dict[str, Any]) -> None:
+    for name, value in flatten_metrics(results).items():
+        print(f"  {name:<70} {value:>10.3f} ms")
+
+
+def main(argv: list[str] | None = None) -> int:
+    parser = argparse.ArgumentParser(description="Remote execution benchmarks (FakeUENode)")
+    parser.add_argument("--iterations", type=int, default=50)
+    parser.add_argument("--discovery-iterations", type=int, default=3)
+    parser.add_argument("--discovery-timeout", type=float, default=1.0)
+    parser.add_argument("--port", type=int, default=None)
+    parser.add_argument("--json", dest="json_path", help="Write results to this file")
+    parser.add_argument("--baseline", help="Compare against results written by --json")
+    parser.add_argument("--tolerance", type=float, default=0.5)
+    args = parser.parse_args(argv)
+
+    results = run_benchmarks(
+        iterations=args.iterations,
+        discovery_iterations=args.discovery_iterations,
+        discovery_timeout=args.discovery_timeout,
+        port=args.port,
+    )
+    print(f"Remote execution benchmarks (Python {results['python']}, {results['platform']})")
+    _print_results(results)
+
+    if args.json_path:
+        Path(args.json_path).write_text(json.dumps(results, indent=2), encoding="utf-8")
+
+    if args.baseline:
+        baseline = json.loads(Path(args.baseline).read_text(encoding="utf-8"))
+        regressions = compare_to_baseline(results, baseline, args.tolerance)
+        if regressions:
+            print(f"\n{len(regressions)} regression(s) over {args.tolerance:.0%} tolerance:")
+            for line in regressions:
+                print(f"  {line}")
+            return 1
+        print("\nNo regressions against baseline")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
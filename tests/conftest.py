@@ -5,12 +5,14 @@ This module provides fixtures for:
 - mcp-pytest plugin integration for MCP server testing
 - Copying EmptyProjectTemplate to temp directories for test isolation
 - Mocking socket and subprocess for unit tests
+- An ExecutionManager wired to a fake editor with canned responses
 """
 
 import os
 import re
 import shutil
 from pathlib import Path
+from types import SimpleNamespace
 from typing import Any
 from unittest.mock import MagicMock, patch
 
@@ -591,6 +593,65 @@ def mock_remote_client():
         yield mock_cls, mock_client
 
 
+_READY_EDITOR = object()
+
+
+@pytest.fixture
+def fake_execution_manager():
+    """
+    Factory for an ExecutionManager wired to a fake editor.
+
+    The returned factory takes:
+        responses: Canned editor response - a dict returned for every request, or a
+            callable(code) -> dict. Default: success with no output.
+        editor: Editor stand-in (default: a ready editor with an empty ImportCache);
+            None for no editor
+        skip_checks: Stub out the editor API check and the editor-ready step
+        launch_manager: Callable(ctx) -> launch manager passed to set_launch_manager
+
+    Code sent to the editor is recorded in manager.requests; the editor context is
+    manager._ctx.
+    """
+    from ue_mcp.core.import_cache import ImportCache
+    from ue_mcp.editor.execution_manager import ExecutionManager
+
+    def make(responses=None, editor=_READY_EDITOR, skip_checks=False, launch_manager=None):
+        if editor is _READY_EDITOR:
+            editor = SimpleNamespace(status="ready", engine_build=None, import_cache=ImportCache())
+        ctx = SimpleNamespace(editor=editor, project_root="/project")
+        manager = ExecutionManager(ctx)
+        manager.requests = []
+
+        async def execute(code, timeout=10.0):
+            manager.requests.append(code)
+            if responses is None:
+                return {"success": True, "output": []}
+            return responses(code) if callable(responses) else responses
+
+        async def python_path():
+            return None
+
+        manager._execute_code_impl = execute
+        manager._get_python_path = python_path
+
+        if skip_checks:
+
+            async def check(code):
+                return None
+
+            async def ready(notify=None):
+                return None
+
+            manager._check_unreal_api = check
+            manager._ensure_editor_ready = ready
+
+        if launch_manager is not None:
+            manager.set_launch_manager(launch_manager(ctx))
+        return manager
+
+    return make
+
+
 # =============================================================================
 # Pytest Hooks for Conditional Logging and Log File Path Display
 # =============================================================================
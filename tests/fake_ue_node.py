@@ -0,0 +1,528 @@
+"""
+Stand-in for a UE5 editor's Python remote execution node.
+
+Speaks the same protocol as the editor's PythonScriptPlugin remote execution:
+
+- answers multicast "ping" with "pong" (node_id, project_name, engine_version, ...)
+- on "open_connection" addressed to it, connects to the client's command port
+- reads concatenated JSON "command" messages from that connection one at a time
+  (like the editor, which parses one message per tick) and answers each with a
+  "command_result" message
+- drops the command connection on "close_connection"
+
+Commands run in this process, in one persistent namespace, with a stub unreal
+module installed in sys.modules (see make_stub_unreal()). The editor-side
+site-packages directory is put on sys.path, with editor_capture registered as a
+bare package (its __init__ needs Windows and more of unreal), so tracking and
+result-file code can run unchanged.
+
+Used by the remote execution tests and benchmarks; no UE5 editor required.
+
+Usage:
+    with FakeUENode(multicast_group=("239.0.0.1", 16766)) as node:
+        client = AsyncRemoteExecutionClient(multicast_group=node.multicast_group)
+        await client.find_unreal_instance(timeout=1.0)
+        await client.open_connection()
+        await client.execute("print('hello')", exec_type=client.ExecTypes.EXECUTE_STATEMENT)
+"""
+
+import json
+import os
+import shlex
+import socket
+import sys
+import threading
+import time
+import traceback
+import types
+import uuid
+from pathlib import Path
+from typing import Any, Optional
+
+from ue_mcp.remote_client import JsonStreamDecoder
+
+PROTOCOL_MAGIC = "ue_py"
+PROTOCOL_VERSION = 1
+
+SITE_PACKAGES_DIR = Path(__file__).parent.parent / "src" / "ue_mcp" / "extra" / "site-packages"
+
+# Packages registered without running their __init__
+BARE_PACKAGES = ("editor_capture",)
+
+
+# =============================================================================
+# Stub unreal module
+# =============================================================================
+
+
+class _Vector:
+    def __init__(self, x=0.0, y=0.0, z=0.0):
+        self.x, self.y, self.z = x, y, z
+
+
+class _Rotator:
+    def __init__(self, pitch=0.0, yaw=0.0, roll=0.0):
+        self.pitch, self.yaw, self.roll = pitch, yaw, roll
+
+
+class _Named:
+    def __init__(self, name: str):
+        self._name = name
+
+    def get_name(self) -> str:
+        return self._name
+
+    def get_path_name(self) -> str:
+        return self._name
+
+
+class _Actor:
+    def __init__(self, level_path: str, index: int):
+        self._path = f"{level_path}.StaticMeshActor_{index}"
+        self._label = f"Actor_{index}"
+        self.location = _Vector(float(index), 0.0, 0.0)
+
+    def get_path_name(self) -> str:
+        return self._path
+
+    def get_actor_label(self) -> str:
+        return self._label
+
+    def get_class(self) -> _Named:
+        return _Named("StaticMeshActor")
+
+    def get_folder_path(self) -> str:
+        return ""
+
+    def get_actor_location(self) -> _Vector:
+        return self.location
+
+    def get_actor_rotation(self) -> _Rotator:
+        return _Rotator()
+
+    def get_actor_scale3d(self) -> _Vector:
+        return _Vector(1.0, 1.0, 1.0)
+
+
+def _emit(kind: str, message: Any) -> None:
+    """Write a log line with an output type, like unreal.log_warning/log_error."""
+    emit = getattr(sys.stdout, "emit", None)
+    if emit is not None:
+        emit(kind, str(message))
+    else:
+        print(message)
+
+
+def make_stub_unreal(
+    level_path: str = "/Game/Maps/Fake",
+    actor_count: int = 0,
+    journals: bool = True,
+    engine_version: str = "5.4.0-0+++UE5+Release-5.4",
+) -> types.ModuleType:
+    """
+    Build a stub unreal module.
+
+    Covers what the UE-MCP editor-side helpers touch: logging, editor subsystems,
+    the current level and its actors, asset listing, dirty packages, the Slate
+    refresh and (optionally) the ExtraPythonAPIs change journals. Attributes not
+    defined here do not exist, so hasattr() feature checks behave like an editor
+    without the corresponding plugin.
+
+    Args:
+        level_path: Asset path of the loaded level
+        actor_count: Number of StaticMeshActors in the level
+        journals: Provide ExAssetChangeJournalLibrary / ExActorChangeJournalLibrary
+        engine_version: Value of SystemLibrary.get_engine_version()
+
+    Returns:
+        Module to install as sys.modules["unreal"]
+    """
+    unreal = types.ModuleType("unreal")
+    level_name = level_path.rsplit("/", 1)[-1]
+    level = _Named(f"{level_path}.{level_name}")
+    world = types.SimpleNamespace(get_outer=lambda: level)
+    actors = [_Actor(f"{level_path}.{level_name}:PersistentLevel", i) for i in range(actor_count)]
+
+    class UnrealEditorSubsystem:
+        def get_editor_world(self):
+            return world
+
+    class EditorActorSubsystem:
+        def get_all_level_actors(self):
+            return list(actors)
+
+    subsystems = {
+        UnrealEditorSubsystem: UnrealEditorSubsystem(),
+        EditorActorSubsystem: EditorActorSubsystem(),
+    }
+
+    unreal.Vector = _Vector
+    unreal.Rotator = _Rotator
+    unreal.UnrealEditorSubsystem = UnrealEditorSubsystem
+    unreal.EditorActorSubsystem = EditorActorSubsystem
+    unreal.get_editor_subsystem = lambda cls: subsystems.get(cls)
+    unreal.log = lambda message: _emit("Info", message)
+    unreal.log_warning = lambda message: _emit("Warning", message)
+    unreal.log_error = lambda message: _emit("Error", message)
+    unreal.SystemLibrary = types.SimpleNamespace(get_engine_version=lambda: engine_version)
+    unreal.EditorAssetLibrary = types.SimpleNamespace(
+        list_assets=lambda path, recursive=True, include_folder=False: [],
+        find_asset_data=lambda path: None,
+    )
+    unreal.EditorLoadingAndSavingUtils = types.SimpleNamespace(
+        get_dirty_content_packages=lambda: [],
+        get_dirty_map_packages=lambda: [],
+    )
+    unreal.ExSlateTabLibrary = types.SimpleNamespace(refresh_slate_view=lambda: None)
+
+    if journals:
+        unreal.ExAssetChangeJournalLibrary = types.SimpleNamespace(
+            get_current_sequence=lambda: 0,
+            get_asset_changes_since=lambda cursor, paths, include_modified: (True, [], []),
+        )
+        unreal.ExActorChangeJournalLibrary = types.SimpleNamespace(
+            get_current_sequence=lambda: 0,
+            get_actor_changes_since=lambda cursor: (True, [], []),
+        )
+    return unreal
+
+
+# =============================================================================
+# Output capture
+# =============================================================================
+
+
+class _OutputCapture:
+    """sys.stdout/sys.stderr replacement collecting editor-style output entries."""
+
+    def __init__(self, entries: list[dict[str, str]], kind: str):
+        self._entries = entries
+        self._kind = kind
+
+    def write(self, text: str) -> int:
+        # print() writes the text and the newline separately
+        if text.strip():
+            self.emit(self._kind, text.rstrip("\n"))
+        return len(text)
+
+    def emit(self, kind: str, text: str) -> None:
+        self._entries.append({"type": kind, "output": text})
+
+    def flush(self) -> None:
+        pass
+
+
+# =============================================================================
+# Fake node
+# =============================================================================
+
+
+class FakeUENode:
+    """A UE5 remote execution node running commands in this process."""
+
+    EXECUTE_FILE = "ExecuteFile"
+    EXECUTE_STATEMENT = "ExecuteStatement"
+    EVALUATE_STATEMENT = "EvaluateStatement"
+
+    def __init__(
+        self,
+        project_name: str = "FakeProject",
+        multicast_group: tuple[str, int] = ("239.0.0.1", 6766),
+        multicast_bind_address: str = "0.0.0.0",
+        unreal_module: Optional[types.ModuleType] = None,
+        engine_version: str = "5.4.0",
+        command_delay: float = 0.0,
+    ):
+        """
+        Args:
+            project_name: Reported in pongs (clients filter on it)
+            multicast_group: Multicast group (ip, port) to answer on
+            multicast_bind_address: Address to bind the multicast socket
+            unreal_module: Module installed as unreal (default: make_stub_unreal())
+            engine_version: Reported in pongs
+            command_delay: Extra seconds spent on each command (simulated editor tick)
+        """
+        self.project_name = project_name
+        self.multicast_group = multicast_group
+        self.multicast_bind_address = multicast_bind_address
+        self.unreal_module = unreal_module or make_stub_unreal()
+        self.engine_version = engine_version
+        self.command_delay = command_delay
+        self.node_id = f"fake-{uuid.uuid4().hex[:12]}"
+        self.pid = os.getpid()
+
+        self.commands: list[dict[str, Any]] = []
+        self.namespace: dict[str, Any] = {"__name__": "__main__"}
+
+        # The editor's sys.stdout/sys.stderr persist across commands, so a stream
+        # installed by one command (e.g. the output capture TeeWriter) stays in place
+        self._stdout = _OutputCapture([], "Info")
+        self._stderr = _OutputCapture([], "Error")
+        self._streams: tuple[Any, Any] = (self._stdout, self._stderr)
+
+        self._mcast_sock: Optional[socket.socket] = None
+        self._cmd_conn: Optional[socket.socket] = None
+        self._stopping = threading.Event()
+        self._threads: list[threading.Thread] = []
+        self._saved_modules: dict[str, Any] = {}
+        self._saved_path: Optional[list[str]] = None
+
+    # -------------------------------------------------------------------------
+    # Lifecycle
+    # -------------------------------------------------------------------------
+
+    def start(self) -> "FakeUENode":
+        """Install the editor modules and start answering on the multicast group."""
+        self._install_modules()
+        sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+        sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        if hasattr(socket, "SO_REUSEPORT"):
+            sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEPORT, 1)
+        sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_TTL, 0)
+        sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_LOOP, 1)
+        sock.bind((self.multicast_bind_address, self.multicast_group[1]))
+        membership = socket.inet_aton(self.multicast_group[0])
+        sock.setsockopt(
+            socket.IPPROTO_IP,
+            socket.IP_ADD_MEMBERSHIP,
+            membership + socket.inet_aton(self.multicast_bind_address),
+        )
+        sock.settimeout(0.05)
+        self._mcast_sock = sock
+        self._spawn(self._serve_multicast)
+        return self
+
+    def stop(self) -> None:
+        """Stop all threads, close sockets and restore sys.modules / sys.path."""
+        self._stopping.set()
+        self._close_command_connection()
+        for thread in self._threads:
+            thread.join(timeout=2.0)
+        self._threads.clear()
+        if self._mcast_sock is not None:
+            self._mcast_sock.close()
+            self._mcast_sock = None
+        self._restore_modules()
+
+    def __enter__(self) -> "FakeUENode":
+        return self.start()
+
+    def __exit__(self, *exc_info) -> None:
+        self.stop()
+
+    def _spawn(self, target, *args) -> None:
+        thread = threading.Thread(target=target, args=args, daemon=True)
+        self._threads.append(thread)
+        thread.start()
+
+    def _install_modules(self) -> None:
+        names = ["unreal", *BARE_PACKAGES]
+        self._saved_modules = {name: sys.modules.get(name) for name in names}
+        self._saved_path = list(sys.path)
+        sys.modules["unreal"] = self.unreal_module
+        for name in BARE_PACKAGES:
+            package = types.ModuleType(name)
+            package.__path__ = [str(SITE_PACKAGES_DIR / name)]
+            sys.modules[name] = package
+        sys.path.insert(0, str(SITE_PACKAGES_DIR))
+
+    def set_unreal_module(self, unreal_module: types.ModuleType) -> None:
+        """Replace the stub unreal module (editor modules re-import it on next use)."""
+        self.unreal_module = unreal_module
+        if self._saved_path is not None:
+            sys.modules["unreal"] = unreal_module
+            self._forget_editor_modules()
+
+    def _forget_editor_modules(self) -> None:
+        for name in list(sys.modules):
+            if any(name.startswith(f"{package}.") for package in BARE_PACKAGES):
+                del sys.modules[name]
+
+    def _restore_modules(self) -> None:
+        if self._saved_path is None:
+            return
+        self._forget_editor_modules()
+        for name, module in self._saved_modules.items():
+            if module is None:
+                sys.modules.pop(name, None)
+            else:
+                sys.modules[name] = module
+        sys.path[:] = self._saved_path
+        self._saved_path = None
+
+    # -------------------------------------------------------------------------
+    # Multicast (discovery and connection control)
+    # -------------------------------------------------------------------------
+
+    def _message(self, message_type: str, dest: Optional[str] = None, data=None) -> dict:
+        message = {
+            "version": PROTOCOL_VERSION,
+            "magic": PROTOCOL_MAGIC,
+            "type": message_type,
+            "source": self.node_id,
+        }
+        if dest is not None:
+            message["dest"] = dest
+        if data is not None:
+            message["data"] = data
+        return message
+
+    def _serve_multicast(self) -> None:
+        while not self._stopping.is_set():
+            try:
+                data, _ = self._mcast_sock.recvfrom(65536)
+                message = json.loads(data.decode("utf-8"))
+            except socket.timeout:
+                continue
+            except (OSError, ValueError):
+                if self._stopping.is_set():
+                    return
+                continue
+
+            if message.get("magic") != PROTOCOL_MAGIC or message.get("source") == self.node_id:
+                continue
+            message_type = message.get("type")
+            if message_type == "ping":
+                self._send_multicast(self._message("pong", message.get("source"), self._pong_data()))
+            elif message.get("dest") != self.node_id:
+                continue
+            elif message_type == "open_connection":
+                data = message.get("data", {})
+                self._spawn(self._open_command_connection, data["command_ip"], data["command_port"])
+            elif message_type == "close_connection":
+                self._close_command_connection()
+
+    def _pong_data(self) -> dict[str, Any]:
+        return {
+            "user": "fake",
+            "machine": socket.gethostname(),
+            "engine_version": self.engine_version,
+            "engine_root": "/fake/engine",
+            "project_root": f"/fake/{self.project_name}",
+            "project_name": self.project_name,
+            "node_id": self.node_id,
+        }
+
+    def _send_multicast(self, message: dict) -> None:
+        try:
+            self._mcast_sock.sendto(json.dumps(message).encode(), self.multicast_group)
+        except OSError:
+            pass
+
+    # -------------------------------------------------------------------------
+    # Command connection
+    # -------------------------------------------------------------------------
+
+    def _open_command_connection(self, ip: str, port: int) -> None:
+        self._close_command_connection()
+        # The client sends open_connection before it listens; retry like a slow editor tick
+        deadline = time.monotonic() + 2.0
+        while not self._stopping.is_set():
+            try:
+                conn = socket.create_connection((ip, port), timeout=0.5)
+                break
+            except OSError:
+                if time.monotonic() > deadline:
+                    return
+                time.sleep(0.005)
+        else:
+            return
+        conn.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        conn.settimeout(0.05)
+        self._cmd_conn = conn
+        self._serve_commands(conn)
+
+    def _close_command_connection(self) -> None:
+        conn, self._cmd_conn = self._cmd_conn, None
+        if conn is not None:
+            try:
+                conn.shutdown(socket.SHUT_RDWR)
+            except OSError:
+                pass
+            try:
+                conn.close()
+            except OSError:
+                pass
+
+    def drop_command_connection(self) -> None:
+        """Close the command connection without a close_connection message (a crash)."""
+        self._close_command_connection()
+
+    def _serve_commands(self, conn: socket.socket) -> None:
+        decoder = JsonStreamDecoder()
+        while not self._stopping.is_set() and self._cmd_conn is conn:
+            try:
+                data = conn.recv(2_097_152)
+            except socket.timeout:
+                continue
+            except OSError:
+                return
+            if not data:
+                return
+            for message in decoder.feed(data):
+                if message.get("type") != "command":
+                    continue
+                result = self.run_command(message.get("data", {}))
+                reply = self._message("command_result", message.get("source"), result)
+                try:
+                    conn.sendall(json.dumps(reply).encode())
+                except OSError:
+                    return
+
+    # -------------------------------------------------------------------------
+    # Command execution
+    # -------------------------------------------------------------------------
+
+    def run_command(self, data: dict[str, Any]) -> dict[str, Any]:
+        """
+        Run one command like the editor's PythonScriptPlugin.
+
+        Args:
+            data: Command message data ({"command", "exec_mode", "unattended"})
+
+        Returns:
+            command_result data ({"success", "command", "result", "output"})
+        """
+        command = data.get("command", "")
+        exec_mode = data.get("exec_mode", self.EXECUTE_FILE)
+        self.commands.append(data)
+        if self.command_delay:
+            time.sleep(self.command_delay)
+
+        output: list[dict[str, str]] = []
+        saved = sys.stdout, sys.stderr, sys.argv
+        self._stdout._entries = output
+        self._stderr._entries = output
+        sys.stdout, sys.stderr = self._streams
+        success, result = True, "None"
+        try:
+            if exec_mode == self.EVALUATE_STATEMENT:
+                result = repr(eval(command, self.namespace))
+            elif exec_mode == self.EXECUTE_STATEMENT:
+                exec(compile(command, "<string>", "exec"), self.namespace)
+            else:
+                self._execute_file(command)
+        except BaseException:
+            success = False
+            result = traceback.format_exc()
+            output.append({"type": "Error", "output": result.rstrip("\n")})
+        finally:
+            self._streams = sys.stdout, sys.stderr
+            sys.stdout, sys.stderr, sys.argv = saved
+
+        return {"success": success, "command": command, "result": result, "output": output}
+
+    def _execute_file(self, command: str) -> None:
+        """ExecuteFile: a script path with optional arguments, or literal code."""
+        try:
+            argv = shlex.split(command, posix=os.name != "nt")
+        except ValueError:
+            argv = []
+        if argv and argv[0].endswith(".py") and os.path.isfile(argv[0]):
+            path = argv[0]
+            sys.argv = argv
+            source = Path(path).read_text(encoding="utf-8")
+            namespace = {"__name__": "__main__", "__file__": path}
+            exec(compile(source, path, "exec"), namespace)
+        else:
+            exec(compile(command, "<string>", "exec"), self.namespace)
@@ -0,0 +1,86 @@
+"""
+Unit tests for level actor snapshots.
+
+Covers parsing of the packed buffer written by ExLevelSnapshotLibrary and reading
+it back into the snapshot format. No UE5 editor required.
+
+Usage:
+    pytest tests/test_actor_snapshot.py -v
+"""
+
+from pathlib import Path
+
+from ue_mcp.tracking.actor_snapshot import (
+    compare_level_actor_snapshots,
+    load_packed_snapshot,
+    parse_packed_actor_snapshot,
+)
+
+LEVEL_PATH = "/Game/Maps/Test.Test"
+CUBE_PATH = "/Game/Maps/Test.Test:PersistentLevel.Cube_0"
+LIGHT_PATH = "/Game/Maps/Test.Test:PersistentLevel.PointLight_0"
+
+PACKED = (
+    f"{CUBE_PATH}\tCube\tStaticMeshActor\t1.0000\t2.0000\t3.0000\t0.0000\t90.0000\t0.0000"
+    "\t1.0000\t1.0000\t2.0000\n"
+    f"{LIGHT_PATH}\tMy Light\tPointLight\t0.0000\t0.0000\t500.0000\t0.0000\t0.0000\t0.0000"
+    "\t1.0000\t1.0000\t1.0000\n"
+)
+
+
+class TestParsePackedSnapshot:
+    """Packed buffer parsing."""
+
+    def test_parse(self):
+        actors = parse_packed_actor_snapshot(PACKED)
+        assert list(actors) == [CUBE_PATH, LIGHT_PATH]
+        assert actors[CUBE_PATH] == {
+            "label": "Cube",
+            "class": "StaticMeshActor",
+            "location": [1.0, 2.0, 3.0],
+            "rotation": [0.0, 90.0, 0.0],
+            "scale": [1.0, 1.0, 2.0],
+        }
+        assert actors[LIGHT_PATH]["label"] == "My Light"
+
+    def test_malformed_lines_are_skipped(self):
+        text = PACKED + "truncated\tline\n" + f"{CUBE_PATH}_1\tX\tActor" + "\tnan?" * 9 + "\n"
+        assert list(parse_packed_actor_snapshot(text)) == [CUBE_PATH, LIGHT_PATH]
+
+    def test_empty(self):
+        assert parse_packed_actor_snapshot("") == {}
+
+
+class TestLoadPackedSnapshot:
+    """Server side of the native snapshot path."""
+
+    def _summary(self, tmp_path, packed, actor_count=None):
+        packed_file = tmp_path / "snapshot.tsv"
+        packed_file.write_text(packed, encoding="utf-8")
+        return {
+            "packed_file": str(packed_file),
+            "asset_path": "/Game/Maps/Test",
+            "actor_count": packed.count("\n") if actor_count is None else actor_count,
+            "current_level": LEVEL_PATH,
+        }
+
+    def test_native_snapshot(self, tmp_path):
+        snapshot = load_packed_snapshot(self._summary(tmp_path, PACKED))
+
+        assert snapshot["current_level"] == LEVEL_PATH
+        level = snapshot["levels"]["/Game/Maps/Test"]
+        assert level["actor_count"] == 2
+        assert level["actors"][CUBE_PATH]["scale"] == [1.0, 1.0, 2.0]
+
+    def test_count_mismatch_fails(self, tmp_path):
+        assert load_packed_snapshot(self._summary(tmp_path, PACKED, actor_count=3)) is None
+
+    def test_missing_file_fails(self, tmp_path):
+        summary = self._summary(tmp_path, PACKED)
+        Path(summary["packed_file"]).unlink()
+        assert load_packed_snapshot(summary) is None
+
+    def test_snapshots_compare(self, tmp_path):
+        before = load_packed_snapshot(self._summary(tmp_path, PACKED))
+        after = load_packed_snapshot(self._summary(tmp_path, PACKED.replace("500.0000", "600.0000")))
+        assert compare_level_actor_snapshots(before, after) == {"/Game/Maps/Test": [LIGHT_PATH]}
@@ -0,0 +1,221 @@
+"""
+Unit tests for the persistent Python API index (ue_mcp.core.api_index).
+
+Uses a small hand-written index in the format written by
+extra/scripts/api_search.py (mode "build_index"). No UE5 editor required.
+
+Usage:
+    pytest tests/test_api_index.py -v
+"""
+
+import json
+
+import pytest
+
+from ue_mcp.core.api_index import (
+    API_INDEX_VERSION,
+    ApiIndex,
+    ApiIndexError,
+    api_index_dir,
+    load_api_index,
+)
+from ue_mcp.core.api_search_engine import MAX_SCORED, ApiSearchEngine, edit_distance, split_words
+
+INDEX_DATA = {
+    "version": API_INDEX_VERSION,
+    "key": "0123456789abcdef",
+    "engine_build": "5.4.0-0+UE5",
+    "created": 0.0,
+    "classes": [
+        ["Object", "Base object.\nMore text.", []],
+        ["Actor", "Actor placed in a level.", ["Object"]],
+        ["StaticMeshActor", "Actor holding a static mesh.", ["Actor", "Object"]],
+        ["EditorLevelLibrary", "Level editing utilities.", ["Object"]],
+    ],
+    "functions": [
+        ["log", "def log(arg)", "Log a message."],
+        ["load_asset", "def load_asset(name)", "Load an asset."],
+    ],
+    "members": [
+        ["Object", "get_name", "method", "def get_name(self)", "Object name.", None, None],
+        ["Actor", "get_actor_location", "method", "def get_actor_location(self)", "", None, None],
+        ["Actor", "hidden", "property", "hidden: bool (read-write)", "Hidden.", "bool", "read-write"],
+        ["Actor", "_internal", "method", "def _internal(self)", "", None, None],
+        ["StaticMeshActor", "get_name", "method", "def get_name(self)", "Overridden.", None, None],
+        ["StaticMeshActor", "static_mesh_component", "property", "", "", "StaticMeshComponent", "read-only"],
+        ["EditorLevelLibrary", "spawn_actor_from_class", "method", "def spawn_actor_from_class(cls)", "", None, None],
+        ["EditorLevelLibrary", "get_selected_level_actors", "method", "def get_selected_level_actors()", "Return the actors selected in the level editor.", None, None],
+    ],
+}
+
+
+@pytest.fixture
+def index():
+    return ApiIndex(INDEX_DATA)
+
+
+class TestApiIndexLoading:
+    """Index file handling."""
+
+    def test_load_and_cache(self, tmp_path):
+        path = tmp_path / "0123456789abcdef.json"
+        path.write_text(json.dumps(INDEX_DATA))
+        index = load_api_index(path)
+        assert index.key == "0123456789abcdef"
+        assert load_api_index(path) is index
+
+    def test_rejects_other_version(self, tmp_path):
+        path = tmp_path / "old.json"
+        path.write_text(json.dumps({**INDEX_DATA, "version": API_INDEX_VERSION + 1}))
+        with pytest.raises(ApiIndexError, match="version"):
+            ApiIndex.load(path)
+
+    def test_missing_and_corrupt(self, tmp_path):
+        with pytest.raises(ApiIndexError, match="not found"):
+            ApiIndex.load(tmp_path / "missing.json")
+        path = tmp_path / "corrupt.json"
+        path.write_text('{"version": 1, "classes": [')
+        with pytest.raises(ApiIndexError):
+            ApiIndex.load(path)
+
+    def test_index_dir(self, tmp_path):
+        assert api_index_dir(tmp_path) == tmp_path / "Saved" / "UEMCP" / "ApiIndex"
+
+
+class TestApiIndexQueries:
+    """Query results match the editor-side api_search modes."""
+
+    def test_list_classes_pattern(self, index):
+        result = index.query("list_classes", query="*Actor*", limit=1)
+        assert result["count"] == 2
+        assert result["truncated"] is True
+        assert result["results"] == [
+            {"name": "Actor", "type": "class", "docstring": "Actor placed in a level."}
+        ]
+        assert result["index_key"] == "0123456789abcdef"
+
+    def test_list_module_functions(self, index):
+        result = index.query("list_functions", query="*load*")
+        assert [r["name"] for r in result["results"]] == ["load_asset"]
+        assert result["scope"] == "module"
+
+    def test_list_class_methods_includes_inherited(self, index):
+        result = index.query("list_functions", query="StaticMeshActor.*")
+        assert [r["name"] for r in result["results"]] == [
+            "StaticMeshActor.get_actor_location",
+            "StaticMeshActor.get_name",
+        ]
+        assert result["results"][1]["docstring"] == "Overridden."
+
+    def test_list_methods_across_classes_lists_definitions_once(self, index):
+        result = index.query("list_functions", query="*.get_*")
+        assert [r["name"] for r in result["results"]] == [
+            "Actor.get_actor_location",
+            "EditorLevelLibrary.get_selected_level_actors",
+            "Object.get_name",
+            "StaticMeshActor.get_name",
+        ]
+
+    def test_unknown_class(self, index):
+        assert index.query("list_functions", query="Nope.*")["success"] is False
+        assert index.query("class_info", query="Nope")["success"] is False
+
+    def test_class_info(self, index):
+        result = index.query("class_info", query="StaticMeshActor")
+        assert result["base_classes"] == ["Actor", "Object"]
+        assert [m["name"] for m in result["methods"]] == ["get_actor_location", "get_name"]
+        assert [p["name"] for p in result["properties"]] == ["hidden", "static_mesh_component"]
+        assert result["inherited_from"] == {"get_actor_location": "Actor", "hidden": "Actor"}
+
+        private = index.query("class_info", query="Actor", include_private=True)
+        assert "_internal" in [m["name"] for m in private["methods"]]
+        assert "inherited_from" not in index.query(
+            "class_info", query="Actor", include_inherited=False
+        )
+
+    def test_search_ranking(self, index):
+        result = index.query("search", query="actor")
+        names = [r["name"] for r in result["results"]]
+        # Exact class first, then prefix, then word matches and substrings
+        assert names[0] == "Actor"
+        assert names.index("Actor.get_actor_location") > names.index("StaticMeshActor")
+        assert "EditorLevelLibrary.spawn_actor_from_class" in names
+        assert "Actor._internal" not in names
+
+    def test_search_covers_every_class(self, index):
+        # The editor-side search stopped after 50 classes; the index sees all members
+        result = index.query("search", query="spawn")
+        assert [r["name"] for r in result["results"]] == [
+            "EditorLevelLibrary.spawn_actor_from_class"
+        ]
+
+
+class TestApiSearchEngine:
+    """Ranked fuzzy search."""
+
+    @staticmethod
+    def names(index, query, **kwargs):
+        return [r["name"] for r in index.query("search", query=query, **kwargs)["results"]]
+
+    def test_split_words(self):
+        assert split_words("StaticMeshActor") == ["static", "mesh", "actor"]
+        assert split_words("get_actor_location") == ["get", "actor", "location"]
+        assert split_words("UMGSequencePlayer") == ["umg", "sequence", "player"]
+
+    def test_edit_distance(self):
+        assert edit_distance("spawn", "spawn", 1) == 0
+        assert edit_distance("spwan", "spawn", 1) == 1
+        assert edit_distance("actr", "actor", 1) == 1
+        assert edit_distance("actor", "camera", 1) == 2
+
+    def test_query_styles_find_snake_case_member(self, index):
+        for query in ("spawn actor", "spawnActor", "spawn_act", "SpawnActorFromClass"):
+            assert self.names(index, query)[0] == "EditorLevelLibrary.spawn_actor_from_class"
+
+    def test_hump_match(self, index):
+        assert self.names(index, "sma")[0] == "StaticMeshActor"
+        assert self.names(index, "gal")[0] == "Actor.get_actor_location"
+
+    def test_typos(self, index):
+        assert self.names(index, "spwan_actr")[0] == "EditorLevelLibrary.spawn_actor_from_class"
+        assert self.names(index, "StaticMeshActr")[0] == "StaticMeshActor"
+
+    def test_docstring_match(self, index):
+        assert self.names(index, "selected") == ["EditorLevelLibrary.get_selected_level_actors"]
+        assert "EditorLevelLibrary.get_selected_level_actors" in self.names(index, "editor")
+
+    def test_results_carry_score_and_signature(self, index):
+        result = index.query("search", query="get_actor_location")
+        top = result["results"][0]
+        assert top["name"] == "Actor.get_actor_location"
+        assert top["signature"] == "def get_actor_location(self)"
+        assert top["parent_class"] == "Actor"
+        scores = [r["score"] for r in result["results"]]
+        assert scores == sorted(scores, reverse=True)
+
+    def test_private_and_empty_queries(self, index):
+        assert "Actor._internal" in self.names(index, "internal", include_private=True)
+        assert self.names(index, "internal") == []
+        assert self.names(index, "  ") == []
+
+    def test_private_documents_do_not_crowd_out_public_ones(self):
+        # Short private names sort first in every postings list
+        documents = [(f"_spawn{i}", "function", None, "", "") for i in range(MAX_SCORED + 50)]
+        documents.append(("spawn_actor_from_class", "function", None, "", ""))
+        engine = ApiSearchEngine(documents)
+
+        result = engine.search("spawn")
+        assert [r["name"] for r in result["results"]] == ["spawn_actor_from_class"]
+        assert result["returned"] == 1
+        assert result["truncated"] is False
+        assert engine.search("spawn", include_private=True)["truncated"] is True
+
+    def test_search_reports_returned_and_truncated(self, index):
+        result = index.query("search", query="actor", limit=1)
+        assert result["returned"] == len(result["results"]) == 1
+        assert result["truncated"] is True
+        assert "count" not in result
+
+        result = index.query("search", query="selected")
+        assert result["returned"] == 1
+        assert result["truncated"] is False
@@ -419,7 +419,7 @@ class TestApiSearchSearch:
 
         assert data.get("success") is True
         assert "results" in data
-        assert data["count"] > 0
+        assert data["returned"] > 0
         # Results should contain 'spawn' in name
         for item in data["results"]:
             assert "spawn" in item["name"].lower()
@@ -435,7 +435,7 @@ class TestApiSearchSearch:
         data = parse_tool_result(result)
 
         assert data.get("success") is True
-        assert data["count"] > 0
+        assert data["returned"] > 0
 
 
 @pytest.mark.integration
@@ -2,8 +2,15 @@
 Unit tests for code_inspector module.
 """
 
+import asyncio
+import json
+import sys
+from types import SimpleNamespace
+
 import pytest
 
+from ue_mcp.core.constants import MARKER_API_VALIDATION_RESULT
+from ue_mcp.validation.api_path_cache import ApiPathCache
 from ue_mcp.validation.code_inspector import (
     BaseChecker,
     BlockingCallChecker,
@@ -13,7 +20,10 @@ from ue_mcp.validation.code_inspector import (
     InspectionResult,
     IssueSeverity,
     UnrealAPIChecker,
+    collect_unreal_api_references,
     inspect_code,
+    resolve_unreal_api_path,
+    validate_unreal_api_paths,
 )
 
 
@@ -625,3 +635,110 @@ def test_func():
             if i.checker == "UnrealAPIChecker" and "NonExistentAPI" in i.message
         ]
         assert len(unreal_errors) >= 1
+
+
+def _fake_unreal():
+    """Minimal stand-in for the unreal module."""
+    return SimpleNamespace(
+        EditorAssetLibrary=SimpleNamespace(list_assets=lambda *a: []),
+        SystemLibrary=SimpleNamespace(get_engine_version=lambda: "5.4.0-12345+++UE5"),
+    )
+
+
+class TestUnrealAPIValidation:
+    """Server-side reference collection, editor-side path resolution and the path cache."""
+
+    CODE = """
+import unreal
+from unreal import EditorAssetLibrary, Missing
+
+@unreal.ufunction()
+def f():
+    unreal.EditorAssetLibrary.list_assets("/Game")
+    unreal.EditorAssetLibrary.nope()
+    unreal.EditorAssetLibrary.nope()
+"""
+
+    def test_collect_references_without_unreal(self):
+        refs = collect_unreal_api_references(self.CODE)
+        dotted = [r.dotted for r in refs]
+        # Decorators are skipped; every occurrence is kept for per-line issues
+        assert "ufunction" not in dotted
+        assert dotted.count("EditorAssetLibrary.nope") == 2
+        assert {"EditorAssetLibrary", "Missing", "EditorAssetLibrary.list_assets"} <= set(dotted)
+        assert [r.from_import for r in refs if r.dotted == "Missing"] == [True]
+        assert collect_unreal_api_references("def broken(") == []
+
+    def test_build_issues_matches_checker_messages(self):
+        refs = collect_unreal_api_references(self.CODE)
+        issues = UnrealAPIChecker().build_issues(
+            refs, {"Missing": "Missing", "EditorAssetLibrary.nope": "nope"}
+        )
+        messages = [i.message for i in issues]
+        assert "Cannot import 'Missing' from unreal module (does not exist)" in messages
+        assert messages.count(
+            "API 'unreal.EditorAssetLibrary.nope' does not exist "
+            "('nope' not found in unreal.EditorAssetLibrary)"
+        ) == 2
+        assert all(i.severity == IssueSeverity.ERROR for i in issues)
+
+    def test_resolve_caches_valid_paths(self):
+        unreal = _fake_unreal()
+        assert resolve_unreal_api_path(("EditorAssetLibrary", "list_assets"), unreal) is None
+        assert resolve_unreal_api_path(("EditorAssetLibrary", "gone"), unreal) == "gone"
+        # Valid paths (and their prefixes) no longer touch the module
+        assert resolve_unreal_api_path(("EditorAssetLibrary", "list_assets"), None) is None
+        assert resolve_unreal_api_path(("EditorAssetLibrary",), None) is None
+
+    def test_validate_unreal_api_paths(self, monkeypatch):
+        monkeypatch.setitem(sys.modules, "unreal", _fake_unreal())
+        result = validate_unreal_api_paths(["EditorAssetLibrary", "Nope.x"])
+        assert result == {"engine_build": "5.4.0-12345+++UE5", "invalid": {"Nope.x": "Nope"}}
+
+    def test_api_path_cache(self):
+        cache = ApiPathCache()
+        assert cache.unknown(None, ["A", "B", "A"]) == ["A", "B"]
+        cache.add_valid("5.4", ["A"])
+        assert cache.unknown("5.4", ["A", "B"]) == ["B"]
+        assert cache.unknown("5.5", ["A"]) == ["A"]
+        # Unknown build: nothing is trusted
+        assert cache.unknown(None, ["A"]) == ["A"]
+
+
+class TestExecutionManagerApiCheck:
+    """ExecutionManager._check_unreal_api against a fake editor."""
+
+    def _response(self, invalid):
+        payload = {"engine_build": "5.4", "invalid": invalid}
+        line = MARKER_API_VALIDATION_RESULT + json.dumps(payload)
+        return {"success": True, "output": [{"type": "Info", "output": line}]}
+
+    def test_valid_paths_are_cached_per_build(self, fake_execution_manager):
+        manager = fake_execution_manager(self._response({}))
+        editor = manager._ctx.editor
+        code = "import unreal\nunreal.EditorAssetLibrary.list_assets('/Game')\n"
+
+        assert asyncio.run(manager._check_unreal_api(code)) is None
+        assert editor.engine_build == "5.4"
+        # Only the API paths are sent, not the user code
+        assert "EditorAssetLibrary.list_assets" in manager.requests[0]
+        assert "/Game" not in manager.requests[0]
+
+        assert asyncio.run(manager._check_unreal_api(code)) is None
+        assert len(manager.requests) == 1
+
+    def test_invalid_paths_fail(self, fake_execution_manager):
+        manager = fake_execution_manager(self._response({"Nope": "Nope"}))
+        error = asyncio.run(manager._check_unreal_api("import unreal\nunreal.Nope()\n"))
+        assert error["success"] is False
+        assert "unreal.Nope" in error["error"]
+        assert error["inspection_issues"][0]["line_number"] == 2
+        # Invalid paths are not cached
+        asyncio.run(manager._check_unreal_api("import unreal\nunreal.Nope()\n"))
+        assert len(manager.requests) == 2
+
+    def test_code_without_unreal_skips_editor(self, fake_execution_manager):
+        manager = fake_execution_manager(self._response({}))
+        assert asyncio.run(manager._check_unreal_api("print('hi')")) is None
+        assert manager.requests == []
+
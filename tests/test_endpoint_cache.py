@@ -0,0 +1,66 @@
+"""
+Unit tests for the per-PID editor endpoint cache (ue_mcp.core.endpoint_cache).
+
+No UE5 editor required.
+
+Usage:
+    pytest tests/test_endpoint_cache.py -v
+"""
+
+from ue_mcp.core import endpoint_cache
+from ue_mcp.core.endpoint_cache import EditorEndpoint, EndpointCache
+
+
+def _endpoint(pid: int, node_id: str = "node", updated_at: float = 0.0) -> EditorEndpoint:
+    return EditorEndpoint(
+        pid=pid,
+        node_id=node_id,
+        multicast_group=("239.0.0.1", 6767),
+        project_name="Project",
+        updated_at=updated_at,
+    )
+
+
+class TestEndpointCache:
+    """Endpoints by editor PID."""
+
+    def test_put_get_forget(self):
+        cache = EndpointCache(None)
+        assert cache.get(100) is None
+        cache.put(_endpoint(100, "a"))
+        cache.put(_endpoint(100, "b"))
+        assert cache.get(100).node_id == "b"
+        assert cache.get(100).updated_at > 0
+        cache.forget(100)
+        assert cache.get(100) is None
+
+    def test_persisted_across_instances(self, tmp_path):
+        path = tmp_path / "endpoints.json"
+        EndpointCache(path).put(_endpoint(100, "a"))
+
+        other = EndpointCache(path)
+        assert other.get(100) == EditorEndpoint(
+            pid=100,
+            node_id="a",
+            multicast_group=("239.0.0.1", 6767),
+            project_name="Project",
+            updated_at=other.get(100).updated_at,
+        )
+        other.forget(100)
+        assert EndpointCache(path).get(100) is None
+
+    def test_oldest_entries_are_dropped(self, monkeypatch):
+        monkeypatch.setattr(endpoint_cache, "MAX_ENTRIES", 2)
+        cache = EndpointCache(None)
+        for pid in (1, 2, 3):
+            cache.put(_endpoint(pid, updated_at=float(pid)))
+        assert len(cache) == 2
+        assert cache.get(1) is None
+
+    def test_unreadable_file_is_ignored(self, tmp_path):
+        path = tmp_path / "endpoints.json"
+        path.write_text("{not json", encoding="utf-8")
+        cache = EndpointCache(path)
+        assert cache.get(100) is None
+        cache.put(_endpoint(100))
+        assert EndpointCache(path).get(100).node_id == "node"
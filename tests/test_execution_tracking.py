@@ -0,0 +1,293 @@
+"""
+Unit tests for bundled pre/post execution tracking.
+
+Covers the server side (ue_mcp.tracking.execution_tracking) and runs the
+editor-side editor_capture.execution_tracking module against a stub unreal
+module. No UE5 editor required.
+
+Usage:
+    pytest tests/test_execution_tracking.py -v
+"""
+
+import asyncio
+import importlib.util
+import sys
+import types
+from pathlib import Path
+from types import SimpleNamespace
+
+import pytest
+
+from ue_mcp.tracking.execution_tracking import (
+    TrackedExecution,
+    build_tracked_code,
+    capture_post_execution,
+    capture_pre_execution,
+    compute_changes,
+)
+
+EDITOR_CAPTURE_DIR = (
+    Path(__file__).parent.parent / "src" / "ue_mcp" / "extra" / "site-packages" / "editor_capture"
+)
+
+LEVEL_PATH = "/Game/Maps/Test.Test:PersistentLevel"
+CUBE_PATH = "/Game/Maps/Test.Test:PersistentLevel.Cube_0"
+
+
+def _fake_unreal(dirty=()):
+    """Stub unreal module with change journals, a level and dirty packages."""
+    calls = []
+
+    class AssetJournal:
+        @staticmethod
+        def get_current_sequence():
+            return 10
+
+        @staticmethod
+        def get_asset_changes_since(cursor, paths, include_modified):
+            calls.append(("assets", cursor, list(paths)))
+            return True, [], ["/Game/Maps/New", "/Game/Maps/Changed"]
+
+    class ActorJournal:
+        @staticmethod
+        def get_current_sequence():
+            return 20
+
+        @staticmethod
+        def get_actor_changes_since(cursor):
+            calls.append(("actors", cursor))
+            change = SimpleNamespace(level_path="/Game/Maps/Test", actor_path=CUBE_PATH)
+            return True, [change, change], ["/Game/Maps/Test"]
+
+    level = SimpleNamespace(get_path_name=lambda: LEVEL_PATH)
+    world = SimpleNamespace(get_outer=lambda: level)
+    editor_sub = SimpleNamespace(get_editor_world=lambda: world)
+    packages = [SimpleNamespace(get_path_name=lambda p=p: p) for p in dirty]
+
+    return types.SimpleNamespace(
+        calls=calls,
+        UnrealEditorSubsystem="UnrealEditorSubsystem",
+        get_editor_subsystem=lambda cls: editor_sub,
+        ExAssetChangeJournalLibrary=AssetJournal,
+        ExActorChangeJournalLibrary=ActorJournal,
+        EditorLoadingAndSavingUtils=SimpleNamespace(
+            get_dirty_content_packages=lambda: packages,
+            get_dirty_map_packages=lambda: [],
+        ),
+        ExSlateTabLibrary=SimpleNamespace(
+            refresh_slate_view=lambda: calls.append(("refresh",))
+        ),
+    )
+
+
+@pytest.fixture
+def editor_tracking(monkeypatch):
+    """Load editor_capture.execution_tracking against a stub unreal module."""
+
+    def load(unreal):
+        monkeypatch.setitem(sys.modules, "unreal", unreal)
+        # Bare package, so the package __init__ (which needs more of unreal) is skipped
+        package = types.ModuleType("editor_capture_stub")
+        package.__path__ = [str(EDITOR_CAPTURE_DIR)]
+        monkeypatch.setitem(sys.modules, "editor_capture_stub", package)
+        for name in ("result_file", "asset_snapshot", "execution_tracking"):
+            spec = importlib.util.spec_from_file_location(
+                f"editor_capture_stub.{name}", EDITOR_CAPTURE_DIR / f"{name}.py"
+            )
+            module = importlib.util.module_from_spec(spec)
+            monkeypatch.setitem(sys.modules, spec.name, module)
+            spec.loader.exec_module(module)
+        return module
+
+    return load
+
+
+class TestComputeChanges:
+    """Pre/post state pairs to changes."""
+
+    def test_journal_state(self):
+        pre = {"errors": [], "game_paths": ["/Game/Maps/"], "asset_cursor": 1, "actor_cursor": 2}
+        post = {
+            "errors": [],
+            "asset_changes": ["/Game/Maps/B", "/Game/Maps/A"],
+            "actor_changes": {"complete": True, "levels": {"/Game/Maps/Test": [CUBE_PATH]}},
+            "dirty_assets": ["/Game/Maps/Test"],
+            "refreshed": True,
+        }
+        changes = compute_changes(pre, post)
+        assert changes.asset_changes == ["/Game/Maps/A", "/Game/Maps/B"]
+        assert changes.actor_changes == {"/Game/Maps/Test": [CUBE_PATH]}
+        assert changes.dirty_assets == ["/Game/Maps/Test"]
+        assert changes.refreshed is True
+
+    def test_snapshot_state(self):
+        actor = {
+            "label": "Cube",
+            "class": "StaticMeshActor",
+            "location": [0.0, 0.0, 0.0],
+            "rotation": [0.0, 0.0, 0.0],
+            "scale": [1.0, 1.0, 1.0],
+        }
+        level = {"level_path": LEVEL_PATH, "actor_count": 1, "actors": {CUBE_PATH: actor}}
+        moved = {**level, "actors": {CUBE_PATH: {**actor, "location": [0.0, 0.0, 100.0]}}}
+        pre = {
+            "errors": [],
+            "asset_snapshot": {"assets": {"/Game/Maps/Test": {"timestamp": 1.0}}},
+            "actor_snapshot": {"levels": {"/Game/Maps/Test": level}, "current_level": LEVEL_PATH},
+        }
+        post = {
+            "errors": [],
+            "asset_snapshot": {"assets": {"/Game/Maps/Test": {"timestamp": 2.0}}},
+            "actor_snapshot": {"levels": {"/Game/Maps/Test": moved}, "current_level": LEVEL_PATH},
+            "dirty_assets": [],
+            "refreshed": False,
+        }
+        changes = compute_changes(pre, post)
+        assert changes.asset_changes == ["/Game/Maps/Test"]
+        assert changes.actor_changes == {"/Game/Maps/Test": [CUBE_PATH]}
+        assert changes.refreshed is False
+
+    def test_failed_actor_snapshot_is_ignored(self):
+        pre = {"errors": ["actors: boom"], "actor_snapshot": {"error": "No world loaded"}}
+        post = {"errors": [], "actor_snapshot": {"error": "No world loaded"}, "dirty_assets": []}
+        assert compute_changes(pre, post).actor_changes == {}
+
+
+class TestBuildTrackedCode:
+    """Code sent for a tracked execute_code."""
+
+    def test_wraps_code_in_one_request(self):
+        tracked = TrackedExecution()
+        code = 'print("a\\nb")\nx = 1\n'
+        wrapped = build_tracked_code(
+            code, ["/Game/Maps/"], "C:/Project", tracked, prelude="import sys"
+        )
+        assert wrapped.startswith("import editor_capture.execution_tracking as _ue_mcp_tracking\n")
+        assert repr(code) in wrapped
+        assert repr(tracked.result_file) in wrapped
+        assert "prelude='import sys'" in wrapped
+        compile(wrapped, "<string>", "exec")
+
+
+class TestEditorTracking:
+    """editor_capture.execution_tracking against a stub unreal module."""
+
+    def test_run_tracked(self, editor_tracking, tmp_path):
+        unreal = _fake_unreal(dirty=["/Game/Maps/Test"])
+        tracking = editor_tracking(unreal)
+        tracked = TrackedExecution(result_file=str(tmp_path / "result.json"))
+        namespace = {}
+        tracking.run_tracked(
+            "y = x + 1",
+            {
+                "result_file": tracked.result_file,
+                "game_paths": ["/Game/Props/"],
+                "project_dir": str(tmp_path),
+                "packed_files": list(tracked.packed_files),
+            },
+            namespace,
+            prelude="x = 1",
+        )
+        assert namespace["y"] == 2
+
+        states = tracked.take()
+        assert states["pre"]["game_paths"] == ["/Game/Props/", "/Game/Maps/"]
+        assert states["pre"]["asset_cursor"] == 10
+        assert states["pre"]["actor_cursor"] == 20
+        assert set(states["timings"]) == {"pre_capture", "post_capture"}
+        changes = compute_changes(states["pre"], states["post"])
+        assert changes.asset_changes == ["/Game/Maps/Changed", "/Game/Maps/New"]
+        assert changes.actor_changes == {"/Game/Maps/Test": [CUBE_PATH]}
+        assert changes.dirty_assets == ["/Game/Maps/Test"]
+        assert changes.refreshed is True
+        assert unreal.calls == [
+            ("assets", 10, ["/Game/Props/", "/Game/Maps/"]),
+            ("actors", 20),
+            ("refresh",),
+        ]
+
+    def test_run_tracked_expression_keeps_value(self, editor_tracking, tmp_path):
+        tracking = editor_tracking(_fake_unreal())
+        tracked = TrackedExecution(result_file=str(tmp_path / "result.json"))
+        options = {"result_file": tracked.result_file, "game_paths": [], "project_dir": str(tmp_path)}
+        assert tracking.run_tracked("x + 1", options, {"x": 41}) == 42
+        assert tracked.take()["value"] == "42"
+
+        # Statements have no value
+        namespace = {}
+        assert tracking.run_tracked("y = 1", options, namespace) is None
+        assert namespace["y"] == 1
+        assert "value" not in tracked.take()
+
+    def test_python_snapshot_filters_ignore_case(self, editor_tracking):
+        """The Python fallback matches filters like the native FString comparisons."""
+
+        def actor(name, class_name, folder):
+            vector = SimpleNamespace(x=0.0, y=0.0, z=0.0)
+            return SimpleNamespace(
+                get_class=lambda: SimpleNamespace(get_name=lambda: class_name),
+                get_folder_path=lambda: folder,
+                get_actor_location=lambda: vector,
+                get_actor_rotation=lambda: SimpleNamespace(pitch=0.0, yaw=0.0, roll=0.0),
+                get_actor_scale3d=lambda: vector,
+                get_path_name=lambda: f"{LEVEL_PATH}.{name}",
+                get_actor_label=lambda: name,
+            )
+
+        unreal = _fake_unreal()
+        actors = [
+            actor("Crate", "StaticMeshActor", "Props/Boxes"),
+            actor("Lamp", "StaticMeshActor", "props"),
+            actor("Sun", "DirectionalLight", "Props"),
+            actor("Rock", "StaticMeshActor", "PropsExtra"),
+        ]
+        level = SimpleNamespace(get_path_name=lambda: LEVEL_PATH)
+        subsystem = SimpleNamespace(
+            get_editor_world=lambda: SimpleNamespace(get_outer=lambda: level),
+            get_all_level_actors=lambda: actors,
+        )
+        unreal.EditorActorSubsystem = "EditorActorSubsystem"
+        unreal.get_editor_subsystem = lambda cls: subsystem
+        tracking = editor_tracking(unreal)
+
+        snapshot = tracking.snapshot_level_actors(None, ["staticmeshactor"], "PROPS/")
+        found = snapshot["levels"]["/Game/Maps/Test"]["actors"]
+        assert sorted(a["label"] for a in found.values()) == ["Crate", "Lamp"]
+
+    def test_run_tracked_error_writes_no_result(self, editor_tracking, tmp_path):
+        tracking = editor_tracking(_fake_unreal())
+        result_file = str(tmp_path / "result.json")
+        options = {"result_file": result_file, "game_paths": [], "project_dir": str(tmp_path)}
+        with pytest.raises(ZeroDivisionError):
+            tracking.run_tracked("1 / 0", options, {})
+        assert not Path(result_file).exists()
+
+    def test_script_capture_round_trips(self, editor_tracking, tmp_path):
+        """Pre and post captures for scripts run the editor module's functions."""
+        unreal = _fake_unreal()
+        tracking = editor_tracking(unreal)
+
+        class Manager:
+            requests = []
+
+            async def _execute_code_impl(self, code, timeout=30.0):
+                self.requests.append(code)
+                code = code.replace("editor_capture.result_file", "editor_capture_stub.result_file")
+                code = code.replace(
+                    "editor_capture.execution_tracking", "editor_capture_stub.execution_tracking"
+                )
+                exec(code, {})
+                return {"success": True, "output": []}
+
+        manager = Manager()
+        tracked = TrackedExecution()
+        try:
+            pre = asyncio.run(capture_pre_execution(manager, [], str(tmp_path), tracked))
+            post = asyncio.run(capture_post_execution(manager, pre, str(tmp_path), tracked))
+        finally:
+            tracked.cleanup()
+        assert len(manager.requests) == 2
+        assert compute_changes(pre, post).actor_changes == {"/Game/Maps/Test": [CUBE_PATH]}
+        # Nothing dirty, but the journals reported changes: the editor refreshed
+        assert post["refreshed"] is True
+        assert tracking.get_asset_journal_cursor() == 10
@@ -0,0 +1,377 @@
+"""
+Tests for the remote execution clients and ExecutionManager against FakeUENode.
+
+Exercises discovery, the command connection and checked execution (with bundled
+tracking) over real sockets, against the in-process fake remote execution node:
+AsyncRemoteExecutionClient (the server's transport) in full, RemoteExecutionClient
+for discovery. Requires loopback multicast; no UE5 editor required.
+
+Usage:
+    pytest tests/test_fake_ue_node.py -v
+"""
+
+import asyncio
+import time
+
+import pytest
+
+from tests.benchmark_remote_execution import (
+    BENCH_PORT_RANGE,
+    _execution_manager,
+    compare_to_baseline,
+    connected,
+    run_benchmarks,
+)
+from tests.fake_ue_node import FakeUENode, make_stub_unreal
+from ue_mcp.async_remote_client import AsyncRemoteExecutionClient
+from ue_mcp.core.port_allocator import find_available_port
+from ue_mcp.remote_client import RemoteExecutionClient
+from ue_mcp.tools._helpers import parse_json_result
+
+
+@pytest.fixture
+def node():
+    port = find_available_port(*BENCH_PORT_RANGE)
+    fake = FakeUENode(project_name="FakeProject", multicast_group=("239.0.0.1", port))
+    fake.start()
+    yield fake
+    fake.stop()
+
+
+class TestDiscovery:
+    """Multicast ping / open_connection."""
+
+    def test_finds_node_by_project(self, node):
+        remote = RemoteExecutionClient(
+            multicast_group=node.multicast_group, project_name="FakeProject"
+        )
+        try:
+            assert remote.find_unreal_instance(timeout=0.3)
+            assert remote.get_node_id() == node.node_id
+        finally:
+            remote.close_connection()
+
+        other = RemoteExecutionClient(multicast_group=node.multicast_group, project_name="Other")
+        try:
+            assert not other.find_unreal_instance(timeout=0.3)
+        finally:
+            other.close_connection()
+
+    def test_verify_pid(self, node):
+        remote = RemoteExecutionClient(
+            multicast_group=node.multicast_group, expected_pid=node.pid
+        )
+        try:
+            assert remote.find_and_verify_instance(timeout=0.3)
+            assert remote.is_connected()
+        finally:
+            remote.close_connection()
+
+    async def test_async_finds_node_by_project(self, node):
+        remote = AsyncRemoteExecutionClient(
+            multicast_group=node.multicast_group, project_name="FakeProject"
+        )
+        try:
+            assert await remote.find_unreal_instance(timeout=0.3)
+            assert remote.get_node_id() == node.node_id
+        finally:
+            remote.close_connection()
+
+        other = AsyncRemoteExecutionClient(
+            multicast_group=node.multicast_group, project_name="Other"
+        )
+        try:
+            assert not await other.find_unreal_instance(timeout=0.3)
+        finally:
+            other.close_connection()
+
+    async def test_async_verify_pid(self, node):
+        remote = AsyncRemoteExecutionClient(
+            multicast_group=node.multicast_group, expected_pid=node.pid
+        )
+        try:
+            assert await remote.find_and_verify_instance(timeout=0.3)
+            assert remote.is_connected()
+        finally:
+            remote.close_connection()
+
+        wrong = AsyncRemoteExecutionClient(
+            multicast_group=node.multicast_group, expected_pid=node.pid + 1
+        )
+        try:
+            assert not await wrong.find_and_verify_instance(timeout=0.3)
+            assert not wrong.is_connected()
+        finally:
+            wrong.close_connection()
+
+
+class TestReconnect:
+    """Early-exit discovery and direct reconnects."""
+
+    def test_discovery_returns_when_expected_node_answers(self, node):
+        remote = RemoteExecutionClient(
+            multicast_group=node.multicast_group, expected_node_id=node.node_id
+        )
+        start = time.perf_counter()
+        try:
+            assert remote.find_unreal_instance(timeout=5.0)
+        finally:
+            remote.close_connection()
+        assert time.perf_counter() - start < 1.0
+
+    async def test_async_discovery_returns_when_expected_node_answers(self, node):
+        remote = AsyncRemoteExecutionClient(
+            multicast_group=node.multicast_group,
+            expected_node_id=node.node_id,
+            expected_pid=node.pid,
+        )
+        start = time.perf_counter()
+        try:
+            assert await remote.find_and_verify_instance(timeout=5.0)
+        finally:
+            remote.close_connection()
+        assert time.perf_counter() - start < 1.0
+
+    async def test_direct_reconnect(self, node):
+        remote = AsyncRemoteExecutionClient(
+            multicast_group=node.multicast_group, expected_pid=node.pid
+        )
+        try:
+            assert await remote.reconnect(node.node_id)
+            result = await remote.execute("print('direct')")
+            assert result["output"] == [{"type": "Info", "output": "direct"}]
+        finally:
+            remote.close_connection()
+
+        unknown = AsyncRemoteExecutionClient(multicast_group=node.multicast_group)
+        try:
+            assert not await unknown.reconnect("no-such-node")
+            assert unknown.get_node_id() is None
+        finally:
+            unknown.close_connection()
+
+    async def test_manager_reconnects_after_drop_without_discovery(self, node):
+        async with connected(node, discovery_timeout=0.3) as client:
+            manager = _execution_manager(client, node)
+            manager._ctx.remember_endpoint()
+            assert (await manager._execute_code_impl("x = 1"))["success"]
+            node.drop_command_connection()
+            await asyncio.sleep(0.05)
+            assert not client.is_connected()
+
+            start = time.perf_counter()
+            try:
+                result = await manager._execute_code_impl("print('back')")
+                elapsed = time.perf_counter() - start
+            finally:
+                manager._ctx.editor.remote_client.close_connection()
+        assert result["output"] == [{"type": "Info", "output": "back"}]
+        assert manager._ctx.editor.remote_client is not client
+        assert elapsed < 0.5
+
+
+class TestCommands:
+    """Command execution modes and results."""
+
+    async def test_statement_output_and_namespace(self, node):
+        async with connected(node, discovery_timeout=0.3) as client:
+            statement = client.ExecTypes.EXECUTE_STATEMENT
+            result = await client.execute("value = 41\nprint('hello')", exec_type=statement)
+            assert result["success"] is True
+            assert result["output"] == [{"type": "Info", "output": "hello"}]
+
+            evaluate = client.ExecTypes.EVALUATE_STATEMENT
+            result = await client.execute("value + 1", exec_type=evaluate)
+            assert result["result"] == "42"
+
+    async def test_stub_unreal_logging(self, node):
+        code = "import unreal\nunreal.log_warning('careful')\nunreal.log_error('broken')"
+        async with connected(node, discovery_timeout=0.3) as client:
+            result = await client.execute(code, exec_type=client.ExecTypes.EXECUTE_STATEMENT)
+        assert result["output"] == [
+            {"type": "Warning", "output": "careful"},
+            {"type": "Error", "output": "broken"},
+        ]
+
+    async def test_error(self, node):
+        async with connected(node, discovery_timeout=0.3) as client:
+            result = await client.execute("1 / 0", exec_type=client.ExecTypes.EXECUTE_STATEMENT)
+        assert result["success"] is False
+        assert "ZeroDivisionError" in result["result"]
+        assert result["output"][-1]["type"] == "Error"
+
+    async def test_execute_file_with_args(self, node, tmp_path):
+        script = tmp_path / "script.py"
+        script.write_text("import sys\nprint(','.join(sys.argv[1:]))\n", encoding="utf-8")
+        async with connected(node, discovery_timeout=0.3) as client:
+            result = await client.execute(f'"{script}" --level /Game/Maps/Test')
+        assert result["success"] is True
+        assert result["output"] == [{"type": "Info", "output": "--level,/Game/Maps/Test"}]
+
+    async def test_pipelined_commands_run_in_order(self, node):
+        async with connected(node, discovery_timeout=0.3) as client:
+            client.max_in_flight = 4
+            commands = [f"print({i})" for i in range(10)]
+            results = await client.execute_many(
+                commands, exec_type=client.ExecTypes.EXECUTE_STATEMENT
+            )
+        assert [r["output"][0]["output"] for r in results] == [str(i) for i in range(10)]
+
+
+class TestConcurrency:
+    """Many callers awaiting one connection."""
+
+    async def test_concurrent_calls_get_their_own_results(self, node):
+        async with connected(node, discovery_timeout=0.3) as client:
+            client.max_in_flight = 4
+            statement = client.ExecTypes.EXECUTE_STATEMENT
+            results = await asyncio.gather(
+                *(client.execute(f"print({i})", exec_type=statement) for i in range(20))
+            )
+        assert [r["output"][0]["output"] for r in results] == [str(i) for i in range(20)]
+
+    async def test_waiting_does_not_block_the_event_loop(self, node):
+        node.command_delay = 0.3
+        ticks = 0
+
+        async def ticker():
+            nonlocal ticks
+            while True:
+                await asyncio.sleep(0.01)
+                ticks += 1
+
+        async with connected(node, discovery_timeout=0.3) as client:
+            tick = asyncio.create_task(ticker())
+            try:
+                result = await client.execute("x = 1")
+            finally:
+                tick.cancel()
+        assert result["success"] is True
+        assert ticks >= 10
+
+    async def test_timeout_does_not_shift_later_results(self, node):
+        async with connected(node, discovery_timeout=0.3) as client:
+            statement = client.ExecTypes.EXECUTE_STATEMENT
+            node.command_delay = 0.2
+            late = await client.execute("print('late')", exec_type=statement, timeout=0.05)
+            node.command_delay = 0.0
+            result = await client.execute("print('next')", exec_type=statement)
+        assert late["error"] == "No response from UE5"
+        assert result["output"] == [{"type": "Info", "output": "next"}]
+
+    async def test_connection_loss_fails_pending_calls(self, node):
+        async with connected(node, discovery_timeout=0.3) as client:
+            node.command_delay = 0.2
+            statement = client.ExecTypes.EXECUTE_STATEMENT
+            pending = asyncio.gather(
+                *(client.execute(f"print({i})", exec_type=statement) for i in range(3))
+            )
+            await asyncio.sleep(0.05)
+            start = time.perf_counter()
+            node.drop_command_connection()
+            results = await pending
+            assert time.perf_counter() - start < 5.0
+            assert all(r.get("crashed") for r in results)
+            assert not client.is_connected()
+
+
+class TestExecutionManager:
+    """Checked execution over the fake node."""
+
+    async def test_tracked_execute_code_is_one_request(self, node):
+        async with connected(node, discovery_timeout=0.3) as client:
+            manager = _execution_manager(client, node)
+            before = len(node.commands)
+            result = await manager._execute_with_checks_impl("x = 1")
+        assert result["success"] is True
+        # No imports to probe: the tracked execution is a single request
+        assert len(node.commands) - before == 1
+
+    async def test_tracked_expression_returns_its_value(self, node):
+        async with connected(node, discovery_timeout=0.3) as client:
+            manager = _execution_manager(client, node)
+            result = await manager._execute_with_checks_impl("6 * 7")
+        assert result["success"] is True
+        assert result["result"] == "42"
+        assert {"type": "Info", "output": "42"} in result["output"]
+
+    async def test_snapshot_mode_detects_moved_actor(self, node):
+        node.set_unreal_module(make_stub_unreal(journals=False, actor_count=3))
+        code = (
+            "import unreal\n"
+            "actor = unreal.get_editor_subsystem(unreal.EditorActorSubsystem)"
+            ".get_all_level_actors()[1]\n"
+            "actor.location.z = 100.0\n"
+        )
+        async with connected(node, discovery_timeout=0.3) as client:
+            manager = _execution_manager(client, node)
+            result = await manager._execute_with_checks_impl(code)
+        assert result["success"] is True
+        assert result["asset_changes"] == ["/Game/Maps/Fake"]
+
+    async def test_script_output_is_streamed_while_running(self, node, tmp_path):
+        script = tmp_path / "script.py"
+        script.write_text(
+            "import time\nprint('step 0')\ntime.sleep(0.6)\nprint('step 1')\n",
+            encoding="utf-8",
+        )
+        received: list[tuple[float, str]] = []
+
+        async def notify(level: str, message: str) -> None:
+            received.append((time.perf_counter(), message))
+
+        async with connected(node, discovery_timeout=0.3) as client:
+            manager = _execution_manager(client, node)
+            result = await manager._execute_script_impl(
+                str(script), wait_for_latent=False, notify=notify
+            )
+        assert result["success"] is True
+        assert result["output"] == "[INFO] step 0\n[INFO] step 1"
+        assert [message for _, message in received] == ["step 0", "step 1"]
+        # The first line arrived while the script was still sleeping
+        assert received[1][0] - received[0][0] > 0.3
+
+
+    async def test_concurrent_scripts_keep_their_own_params(self, node, tmp_path):
+        script = tmp_path / "script.py"
+        script.write_text(
+            "import json, os, time\n"
+            "params = json.loads(os.environ['UE_MCP_CALL'].split(':', 2)[2])\n"
+            "time.sleep(0.2)\n"
+            "print(json.dumps(params))\n",
+            encoding="utf-8",
+        )
+        async with connected(node, discovery_timeout=0.3) as client:
+            manager = _execution_manager(client, node)
+            results = await asyncio.gather(
+                *(
+                    manager.execute_script(str(script), params={"n": n}, wait_for_latent=False)
+                    for n in range(2)
+                )
+            )
+        for n, result in enumerate(results):
+            assert result["success"] is True
+            assert parse_json_result(result) == {"n": n}
+
+
+class TestBenchmarks:
+    """Benchmark harness smoke test and baseline comparison."""
+
+    def test_run_benchmarks(self):
+        results = run_benchmarks(iterations=2, discovery_iterations=1, discovery_timeout=0.2)
+        assert results["command_latency"]["count"] == 2
+        assert results["concurrent_calls"]["batch"]["count"] == 1
+        assert set(results["tracking_overhead"]) == {
+            "plain",
+            "journals",
+            "snapshots_1000_actors",
+        }
+        assert "execution" in results["tracking_overhead"]["journals"]["phases_p50_ms"]
+        assert compare_to_baseline(results, results, tolerance=0.0) == []
+
+    def test_compare_to_baseline(self):
+        baseline = {"command_latency": {"p50_ms": 2.0, "p90_ms": 3.0}}
+        current = {"command_latency": {"p50_ms": 4.0, "p90_ms": 3.5}}
+        assert compare_to_baseline(current, baseline, tolerance=0.5) == [
+            "command_latency.p50_ms: 2.000 ms -> 4.000 ms"
+        ]
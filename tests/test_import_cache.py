@@ -0,0 +1,101 @@
+"""
+Unit tests for the import probe cache.
+
+Covers ue_mcp.core.import_cache and ExecutionManager._probe_imports against a fake
+editor. No UE5 editor required.
+
+Usage:
+    pytest tests/test_import_cache.py -v
+"""
+
+import asyncio
+
+from ue_mcp.core.import_cache import ImportCache, top_level_modules
+from ue_mcp.editor import execution_manager
+
+
+class TestImportCache:
+    """Known-good import statements."""
+
+    def test_top_level_modules(self):
+        assert top_level_modules("import os.path, json") == {"os", "json"}
+        assert top_level_modules("from PIL import Image") == {"PIL"}
+        assert top_level_modules("from . import sibling") == set()
+
+    def test_unknown_until_added(self):
+        cache = ImportCache()
+        statements = ["import os", "from PIL import Image"]
+        assert cache.unknown(statements) == statements
+        cache.add_good(statements)
+        assert cache.unknown(statements) == []
+        assert cache.unknown(["import numpy", "import os"]) == ["import numpy"]
+        assert len(cache) == 2
+
+    def test_invalidate_modules(self):
+        cache = ImportCache()
+        cache.add_good(["import os, editor_capture", "import json"])
+        cache.invalidate({"editor_capture"})
+        assert cache.unknown(["import os, editor_capture", "import json"]) == [
+            "import os, editor_capture"
+        ]
+        cache.invalidate()
+        assert cache.unknown(["import json"]) == ["import json"]
+
+    def test_relative_imports_are_never_cached(self):
+        cache = ImportCache()
+        cache.add_good(["from . import sibling"])
+        assert cache.unknown(["from . import sibling"]) == ["from . import sibling"]
+
+
+class TestExecutionManagerImportProbe:
+    """ExecutionManager._probe_imports against a fake editor."""
+
+    def _failing_once(self, failures):
+        """Editor response raising ModuleNotFoundError for each module in failures once."""
+
+        def respond(code):
+            for module in list(failures):
+                if module in code:
+                    failures.remove(module)
+                    error = f"ModuleNotFoundError: No module named '{module}'"
+                    return {"success": False, "error": error, "output": []}
+            return {"success": True, "output": []}
+
+        return respond
+
+    def test_known_imports_skip_probe(self, fake_execution_manager):
+        manager = fake_execution_manager()
+        assert asyncio.run(manager._probe_imports(["import os", "import json"], 3)) == []
+        assert len(manager.requests) == 1
+
+        assert asyncio.run(manager._probe_imports(["import json"], 3)) == []
+        assert len(manager.requests) == 1
+        # Only the new statement is probed
+        asyncio.run(manager._probe_imports(["import os", "import re"], 3))
+        assert manager.requests[-1] == "import re"
+
+    def test_install_invalidates_and_caches_after_retry(self, monkeypatch, fake_execution_manager):
+        installs = []
+        monkeypatch.setattr(
+            execution_manager,
+            "pip_install",
+            lambda packages, python_path=None: installs.append(packages) or {"success": True},
+        )
+        manager = fake_execution_manager(self._failing_once(["yaml"]))
+        editor = manager._ctx.editor
+        editor.import_cache.add_good(["import os"])
+
+        assert asyncio.run(manager._probe_imports(["import yaml"], 3)) == ["PyYAML"]
+        assert installs == [["PyYAML"]]
+        assert len(manager.requests) == 2
+        # pip_install cleared the session cache; the retried statement is now known
+        assert editor.import_cache.unknown(["import os", "import yaml"]) == ["import os"]
+
+    def test_failed_code_import_forgets_module(self, fake_execution_manager):
+        manager = fake_execution_manager()
+        editor = manager._ctx.editor
+        editor.import_cache.add_good(["import yaml"])
+        manager._forget_failed_import(
+            {"success": False, "error": "ModuleNotFoundError: No module named 'yaml'"}
+        )
+        assert editor.import_cache.unknown(["import yaml"]) == ["import yaml"]
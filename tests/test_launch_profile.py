@@ -0,0 +1,232 @@
+"""
+Unit tests for the headless (-nullrhi) launch profile.
+
+Covers the editor command line built by LaunchManager and the profile
+ExecutionManager picks when auto-launching for a task. No UE5 editor required.
+
+Usage:
+    pytest tests/test_launch_profile.py -v
+"""
+
+import asyncio
+import importlib.util
+import re
+from pathlib import Path
+from types import SimpleNamespace
+
+from ue_mcp.editor.launch_manager import HEADLESS_LAUNCH_ARGS, LaunchManager
+
+# Editor-side result file writer, loaded directly (the editor_capture package needs unreal)
+WRITER_PATH = (
+    Path(__file__).parent.parent
+    / "src"
+    / "ue_mcp"
+    / "extra"
+    / "site-packages"
+    / "editor_capture"
+    / "result_file.py"
+)
+_spec = importlib.util.spec_from_file_location("editor_result_file", WRITER_PATH)
+editor_result_file = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(editor_result_file)
+
+
+def _dirty_packages(paths):
+    """Editor response to the dirty package query, reporting paths as unsaved."""
+
+    def respond(code):
+        match = re.search(r"^result_file = (.+)$", code, re.MULTILINE)
+        if match:
+            editor_result_file.write_result_file(eval(match.group(1)), paths)
+        return {"success": True, "output": []}
+
+    return respond
+
+
+def _command_line(**kwargs):
+    return LaunchManager.build_command_line(
+        Path("UnrealEditor"), Path("Game.uproject"), Path("Saved/Logs/ue.log"), 6800, **kwargs
+    )
+
+
+class TestCommandLine:
+    """Editor arguments of each launch profile."""
+
+    def test_default_renders(self):
+        args = _command_line()
+        assert "-nullrhi" not in args
+        assert "-unattended" not in args
+        assert any(arg.endswith("RemoteExecutionMulticastGroupEndpoint=239.0.0.1:6800") for arg in args)
+
+    def test_unattended(self):
+        args = _command_line(unattended=True)
+        assert "-unattended" in args
+        assert "-nullrhi" not in args
+
+    def test_headless(self):
+        args = _command_line(headless=True, unattended=True)
+        assert args[-len(HEADLESS_LAUNCH_ARGS):] == HEADLESS_LAUNCH_ARGS
+        assert args.count("-unattended") == 1
+
+    def test_choose_headless(self):
+        assert LaunchManager.choose_headless(False) is True
+        assert LaunchManager.choose_headless(True) is False
+        assert LaunchManager.choose_headless(None) is False
+
+
+class FakeLaunchManager:
+    """Records launches and marks the editor ready with the requested profile."""
+
+    choose_headless = staticmethod(LaunchManager.choose_headless)
+
+    def __init__(self, ctx):
+        self._ctx = ctx
+        self.launches = []
+        self.relaunches = []
+
+    async def launch(self, notify=None, wait_timeout=120.0, headless=False, **kwargs):
+        self.launches.append(headless)
+        self._ctx.editor = SimpleNamespace(status="ready", headless=headless, log_file_path=None)
+        return {"success": True}
+
+    async def relaunch(self, notify, headless, wait_timeout=120.0):
+        self.relaunches.append(headless)
+        self._ctx.editor = SimpleNamespace(
+            status="ready", headless=headless, auto_launched=True, log_file_path=None
+        )
+        return {"success": True}
+
+
+class TestAutoLaunchProfile:
+    """Profile picked by ExecutionManager._ensure_editor_ready."""
+
+    def _manager(self, fake_execution_manager, editor=None, dirty=()):
+        manager = fake_execution_manager(
+            _dirty_packages(list(dirty)), editor=editor, launch_manager=FakeLaunchManager
+        )
+        return manager, manager._launch_manager, manager._ctx
+
+    def test_non_visual_task_launches_headless(self, fake_execution_manager):
+        manager, launcher, ctx = self._manager(fake_execution_manager)
+        assert asyncio.run(manager._ensure_editor_ready(needs_rendering=False)) is None
+        assert launcher.launches == [True]
+        assert ctx.editor.headless
+
+    def test_visual_and_unspecified_tasks_launch_rendering(self, fake_execution_manager):
+        for needs_rendering in (True, None):
+            manager, launcher, ctx = self._manager(fake_execution_manager)
+            asyncio.run(manager._ensure_editor_ready(needs_rendering=needs_rendering))
+            assert launcher.launches == [False]
+
+    def test_headless_editor_serves_non_visual_tasks(self, fake_execution_manager):
+        editor = SimpleNamespace(status="ready", headless=True)
+        manager, launcher, _ = self._manager(fake_execution_manager, editor)
+        for needs_rendering in (False, None):
+            assert asyncio.run(manager._ensure_editor_ready(needs_rendering=needs_rendering)) is None
+        assert launcher.launches == []
+        assert launcher.relaunches == []
+
+    def test_visual_task_relaunches_auto_launched_headless_editor(self, fake_execution_manager):
+        manager, launcher, ctx = self._manager(fake_execution_manager)
+        asyncio.run(manager._ensure_editor_ready(needs_rendering=False))
+        assert ctx.editor.auto_launched
+        assert asyncio.run(manager._ensure_editor_ready(needs_rendering=True)) is None
+        assert launcher.relaunches == [False]
+        assert not ctx.editor.headless
+
+    def test_visual_task_keeps_headless_editor_with_unsaved_packages(self, fake_execution_manager):
+        manager, launcher, ctx = self._manager(fake_execution_manager, dirty=["/Game/Maps/Test"])
+        asyncio.run(manager._ensure_editor_ready(needs_rendering=False))
+        editor = ctx.editor
+
+        result = asyncio.run(manager._ensure_editor_ready(needs_rendering=True))
+        assert result["success"] is False
+        assert "/Game/Maps/Test" in result["error"]
+        assert result["dirty_packages"] == ["/Game/Maps/Test"]
+        assert launcher.relaunches == []
+        assert ctx.editor is editor
+
+    def test_visual_task_keeps_headless_editor_when_dirty_check_fails(
+        self, fake_execution_manager
+    ):
+        manager = fake_execution_manager(
+            {"success": False, "error": "timeout", "output": []},
+            editor=None,
+            launch_manager=FakeLaunchManager,
+        )
+        asyncio.run(manager._ensure_editor_ready(needs_rendering=False))
+        result = asyncio.run(manager._ensure_editor_ready(needs_rendering=True))
+        assert result["success"] is False
+        assert "could not be checked" in result["error"]
+        assert manager._launch_manager.relaunches == []
+
+    def test_visual_task_keeps_user_launched_headless_editor(self, fake_execution_manager):
+        editor = SimpleNamespace(status="ready", headless=True, auto_launched=False)
+        manager, launcher, ctx = self._manager(fake_execution_manager, editor)
+        result = asyncio.run(manager._ensure_editor_ready(needs_rendering=True))
+        assert result["success"] is False
+        assert "editor_launch" in result["error"]
+        assert launcher.relaunches == []
+        assert ctx.editor is editor
+
+    def test_rendering_editor_kept_for_non_visual_tasks(self, fake_execution_manager):
+        editor = SimpleNamespace(status="ready", headless=False)
+        manager, launcher, _ = self._manager(fake_execution_manager, editor)
+        assert asyncio.run(manager._ensure_editor_ready(needs_rendering=False)) is None
+        assert launcher.launches == []
+        assert launcher.relaunches == []
+
+
+class TestRelaunch:
+    """LaunchManager.relaunch only replaces editors the server auto-launched headless."""
+
+    def _launcher(self, editor):
+        ctx = SimpleNamespace(editor=editor, stopped=0)
+
+        def stop(health_monitor=None):
+            ctx.stopped += 1
+            ctx.editor = None
+            return {"success": True}
+
+        ctx.stop = stop
+        monitor = SimpleNamespace(stop=lambda: None)
+        launcher = LaunchManager(ctx, None, monitor, None)
+        launches = []
+
+        async def launch(notify=None, headless=False, **kwargs):
+            launches.append((headless, kwargs))
+            ctx.editor = SimpleNamespace(status="ready", headless=headless, auto_launched=False)
+            return {"success": True}
+
+        launcher.launch = launch
+        return launcher, ctx, launches
+
+    def _editor(self, auto_launched):
+        return SimpleNamespace(
+            status="ready",
+            headless=True,
+            auto_launched=auto_launched,
+            remote_client=None,
+            additional_paths=["/extra"],
+            unattended=True,
+        )
+
+    def test_relaunches_auto_launched_editor(self):
+        launcher, ctx, launches = self._launcher(self._editor(auto_launched=True))
+        result = asyncio.run(launcher.relaunch(notify=None, headless=False))
+        assert result["success"] is True
+        assert ctx.stopped == 1
+        assert launches == [
+            (False, {"additional_paths": ["/extra"], "wait_timeout": 120.0, "unattended": True})
+        ]
+        assert ctx.editor.auto_launched
+
+    def test_refuses_user_launched_editor(self):
+        editor = self._editor(auto_launched=False)
+        launcher, ctx, launches = self._launcher(editor)
+        result = asyncio.run(launcher.relaunch(notify=None, headless=False))
+        assert result["success"] is False
+        assert "editor_launch" in result["error"]
+        assert ctx.stopped == 0
+        assert launches == []
+        assert ctx.editor is editor
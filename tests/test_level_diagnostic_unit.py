@@ -312,3 +312,171 @@ class TestLightingDiagnostic:
         assert "lighting_actors_missing" in result.metadata
         assert result.metadata["lighting_actors_found"] == 2
         assert result.metadata["lighting_actors_missing"] == 2
+
+
+class TestAABBGrid:
+    """Unit tests for the AABBGrid spatial index used by overlap/floating checks."""
+
+    def _random_boxes(self, seed: int, count: int):
+        import random
+
+        rng = random.Random(seed)
+        boxes = []
+        for _ in range(count):
+            size = rng.choice([5.0, 50.0, 300.0])
+            boxes.append(
+                (
+                    (rng.uniform(0, 2000), rng.uniform(0, 2000), rng.uniform(0, 500)),
+                    (rng.uniform(1, size), rng.uniform(1, size), rng.uniform(1, size)),
+                )
+            )
+        # One huge box (e.g. landscape) that covers everything
+        boxes.append(((1000.0, 1000.0, 0.0), (5000.0, 5000.0, 10.0)))
+        return boxes
+
+    def test_query_is_superset_of_brute_force(self, mock_unreal):
+        """Every pair accepted by aabb_intersects must be returned as a grid candidate."""
+        from asset_diagnostic.utils import AABBGrid, aabb_intersects
+
+        for seed in range(5):
+            boxes = self._random_boxes(seed, 200)
+            grid = AABBGrid(boxes)
+            for i, (origin, extent) in enumerate(boxes):
+                expected = {
+                    j
+                    for j, (o2, e2) in enumerate(boxes)
+                    if j != i and aabb_intersects(origin, extent, o2, e2)
+                }
+                candidates = set(grid.query_key(i))
+                assert expected <= candidates
+
+    def test_near_touching_boxes_within_epsilon(self, mock_unreal):
+        """Boxes separated by less than epsilon across a cell boundary are still candidates."""
+        from asset_diagnostic.utils import AABBGrid
+
+        boxes = [((0.0, 0.0, 0.0), (50.0, 50.0, 50.0)), ((100.05, 0.0, 0.0), (50.0, 50.0, 50.0))]
+        grid = AABBGrid(boxes, cell_size=50.0)
+        assert grid.query_key(0) == [1]
+
+    def test_query_results_sorted_and_exclude_self(self, mock_unreal):
+        """query_key returns sorted keys without the queried box."""
+        from asset_diagnostic.utils import AABBGrid
+
+        boxes = [((0.0, 0.0, 0.0), (10.0, 10.0, 10.0))] * 4
+        grid = AABBGrid(boxes)
+        assert grid.query_key(2) == [0, 1, 3]
+
+    def test_accepts_vectors(self, mock_unreal):
+        """Boxes given as unreal.Vector-like objects are supported."""
+        from asset_diagnostic.utils import AABBGrid
+
+        Vector = mock_unreal.Vector
+        grid = AABBGrid(
+            [
+                (Vector(0, 0, 0), Vector(10, 10, 10)),
+                (Vector(15, 0, 0), Vector(10, 10, 10)),
+                (Vector(500, 0, 0), Vector(10, 10, 10)),
+            ]
+        )
+        assert grid.query_key(0) == [1]
+
+    def test_empty_grid(self, mock_unreal):
+        """An empty grid returns no candidates."""
+        from asset_diagnostic.utils import AABBGrid
+
+        grid = AABBGrid([])
+        assert grid.query((0, 0, 0), (10, 10, 10)) == []
+
+
+class TestSpatialIndexEquivalence:
+    """The grid-accelerated checks must report exactly what a full pairwise scan reports.
+
+    A grid with one huge cell degenerates to a brute-force scan, so it is used as the
+    reference implementation.
+    """
+
+    def _build_scene(self, mock_unreal, seed: int, count: int):
+        import random
+
+        MockActor = mock_unreal._MockActor
+        Vector = mock_unreal.Vector
+        rng = random.Random(seed)
+
+        actors = []
+        bounds = {}
+        for i in range(count):
+            actor = MockActor(rng.choice(["StaticMeshActor", "BP_Crate_C"]), label=f"Actor{i}")
+            actors.append(actor)
+            size = rng.choice([20.0, 60.0, 200.0])
+            bounds[actor] = (
+                Vector(rng.uniform(0, 1500), rng.uniform(0, 1500), rng.uniform(0, 600)),
+                Vector(rng.uniform(5, size), rng.uniform(5, size), rng.uniform(5, size)),
+            )
+
+        ground = MockActor("Landscape", label="Ground")
+        bounds[ground] = (Vector(750, 750, -50), Vector(1000, 1000, 50))
+        actors.append(ground)
+
+        dicts = [
+            {
+                "name": a.get_actor_label(),
+                "class": a._class_name,
+                "x": bounds[a][0].x,
+                "y": bounds[a][0].y,
+                "z": bounds[a][0].z,
+                "x_extent": bounds[a][1].x * 2,
+                "y_extent": bounds[a][1].y * 2,
+                "z_extent": bounds[a][1].z * 2,
+                "actor": a,
+            }
+            for a in actors
+        ]
+        return actors, dicts, bounds, ground
+
+    def _run_checks(self, actors, dicts, bounds, ground):
+        from asset_diagnostic.core import AssetType, DiagnosticResult
+        from asset_diagnostic.diagnostics import level as level_module
+
+        diagnostic = level_module.LevelDiagnostic()
+        result = DiagnosticResult(
+            asset_path="/Game/TestLevel", asset_type=AssetType.LEVEL, asset_name="TestLevel"
+        )
+        diagnostic._check_overlapping_actors(dicts, result)
+
+        with patch.object(level_module, "get_actor_bounds", side_effect=lambda a: bounds[a]):
+            clusters, max_depth, info_map = diagnostic._detect_floating_objects(actors, [ground])
+
+        return (
+            result.issues,
+            result.metadata,
+            [
+                (
+                    [a.get_actor_label() for a in c.actors],
+                    (c.bounds_min.x, c.bounds_min.y, c.bounds_min.z),
+                    (c.bounds_max.x, c.bounds_max.y, c.bounds_max.z),
+                )
+                for c in clusters
+            ],
+            max_depth,
+            {a.get_actor_label(): (i.is_supported, i.support_depth) for a, i in info_map.items()},
+        )
+
+    def test_identical_to_brute_force(self, mock_unreal):
+        """Overlap issues, support depths and floating clusters match the brute-force scan."""
+        from asset_diagnostic import utils
+        from asset_diagnostic.diagnostics import level as level_module
+
+        class BruteForceGrid(utils.AABBGrid):
+            def __init__(self, boxes, cell_size=None, epsilon=0.1):
+                super().__init__(boxes, cell_size=1e12, epsilon=epsilon)
+
+        for seed, count in [(1, 10), (2, 80), (3, 250)]:
+            scene = self._build_scene(mock_unreal, seed, count)
+            accelerated = self._run_checks(*scene)
+            with patch.object(level_module, "AABBGrid", BruteForceGrid):
+                reference = self._run_checks(*scene)
+
+            assert accelerated == reference
+            # Sanity: the scene actually exercises the checks
+            assert accelerated[0]
+            assert accelerated[3] >= 1
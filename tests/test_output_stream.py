@@ -0,0 +1,100 @@
+"""
+Unit tests for streaming captured script output (ue_mcp.core.output_stream).
+
+No UE5 editor required.
+
+Usage:
+    pytest tests/test_output_stream.py -v
+"""
+
+import asyncio
+
+from ue_mcp.core.output_stream import OutputStreamer
+
+
+class _Recorder:
+    """NotifyCallback collecting (level, message) pairs, optionally slow."""
+
+    def __init__(self, delay: float = 0.0):
+        self.delay = delay
+        self.messages: list[tuple[str, str]] = []
+
+    async def __call__(self, level: str, message: str) -> None:
+        if self.delay:
+            await asyncio.sleep(self.delay)
+        self.messages.append((level, message))
+
+    @property
+    def lines(self) -> list[str]:
+        return [line for _, message in self.messages for line in message.split("\n")]
+
+
+class TestOutputStreamer:
+    """Tailing, batching and backpressure."""
+
+    async def test_streams_lines_while_file_grows(self, tmp_path):
+        path = tmp_path / "output.txt"
+        path.write_text("", encoding="utf-8")
+        notify = _Recorder()
+        streamer = OutputStreamer(path, notify, poll_interval=0.01)
+        streamer.start()
+
+        with open(path, "a", encoding="utf-8") as f:
+            f.write("first\nsec")
+            f.flush()
+            await asyncio.sleep(0.1)
+            # Only complete lines are sent while the script runs
+            assert notify.lines == ["first"]
+            f.write("ond\r\nunterminated")
+        await streamer.stop()
+
+        assert notify.lines == ["first", "second", "unterminated"]
+        assert all(level == "info" for level, _ in notify.messages)
+        assert streamer.lines_sent == 3
+
+    async def test_lines_are_batched(self, tmp_path):
+        path = tmp_path / "output.txt"
+        path.write_text("".join(f"{i}\n" for i in range(120)), encoding="utf-8")
+        notify = _Recorder()
+        streamer = OutputStreamer(path, notify, max_batch_lines=50)
+        streamer.start()
+        await streamer.stop()
+
+        assert notify.lines == [str(i) for i in range(120)]
+        assert all(len(message.split("\n")) <= 50 for _, message in notify.messages)
+        assert len(notify.messages) < 120
+
+    async def test_slow_client_pauses_reading(self, tmp_path):
+        path = tmp_path / "output.txt"
+        path.write_text("x\n" * 100_000, encoding="utf-8")
+        notify = _Recorder(delay=0.05)
+        streamer = OutputStreamer(path, notify, max_buffered_lines=10, max_batch_lines=5)
+        streamer.start()
+        await asyncio.sleep(0.2)
+
+        # The unsent backlog stays in the file: reading stops at a bounded
+        # distance ahead of the client
+        assert streamer.bytes_read <= 2 * 64 * 1024
+        assert streamer._queue.qsize() <= 10
+
+        streamer.drain_timeout = 0.1
+        await streamer.stop()
+        assert streamer.lines_sent < 100_000
+
+    async def test_long_lines_are_cut(self, tmp_path):
+        path = tmp_path / "output.txt"
+        path.write_text("a" * 300_000 + "\nshort\n", encoding="utf-8")
+        notify = _Recorder()
+        streamer = OutputStreamer(path, notify, max_line_chars=100)
+        streamer.start()
+        await streamer.stop()
+
+        assert notify.lines == ["a" * 100 + " [...]", "short"]
+
+    async def test_missing_file(self, tmp_path):
+        notify = _Recorder()
+        streamer = OutputStreamer(tmp_path / "missing.txt", notify, poll_interval=0.01)
+        streamer.start()
+        await asyncio.sleep(0.03)
+        await streamer.stop()
+        assert notify.messages == []
@@ -0,0 +1,708 @@
+"""
+Unit tests for the PIE tracer, PIETickExecutor and SceneCaptureRig.
+
+Runs editor_capture.pie_tracer, pie_tick_executor and scene_capture against a
+stub unreal module: the fixed-step clock, the tick budget, the PIE lifecycle and
+async screenshot tickets. No UE5 editor required.
+
+Usage:
+    pytest tests/test_pie_tracer_unit.py -v
+"""
+
+import importlib.util
+import json
+import os
+import sys
+import types
+from pathlib import Path
+from types import SimpleNamespace
+
+import pytest
+
+EDITOR_CAPTURE_DIR = (
+    Path(__file__).parent.parent / "src" / "ue_mcp" / "extra" / "site-packages" / "editor_capture"
+)
+
+
+class _Event:
+    """PIE delegate with add_callable / remove_callable."""
+
+    def __init__(self):
+        self.callables = {}
+
+    def add_callable(self, fn):
+        handle = len(self.callables) + 1
+        self.callables[handle] = fn
+        return handle
+
+    def remove_callable(self, handle):
+        self.callables.pop(handle, None)
+
+    def broadcast(self, *args):
+        for fn in list(self.callables.values()):
+            fn(*args)
+
+
+def _fake_unreal(clock_plugin=True):
+    """Stub unreal module: logging, PIE events and world clock, tick callbacks, optional clock library."""
+    calls = []
+    pie_worlds = []
+    editor_utility = SimpleNamespace(on_begin_pie=_Event(), on_end_pie=_Event())
+    level_editor = SimpleNamespace(
+        editor_request_end_play=lambda: calls.append(("end_play",)),
+        editor_play_simulate=lambda: calls.append(("play",)),
+    )
+    subsystems = {
+        "EditorUtilitySubsystem": editor_utility,
+        "LevelEditorSubsystem": level_editor,
+    }
+    tick_callbacks = {}
+
+    def register_tick(fn):
+        tick_callbacks[len(tick_callbacks) + 1] = fn
+        return len(tick_callbacks)
+
+    unreal = types.SimpleNamespace(
+        calls=calls,
+        editor_utility=editor_utility,
+        tick_callbacks=tick_callbacks,
+        log=lambda message: None,
+        log_warning=lambda message: calls.append(("warning", message)),
+        log_error=lambda message: calls.append(("error", message)),
+        EditorUtilitySubsystem="EditorUtilitySubsystem",
+        LevelEditorSubsystem="LevelEditorSubsystem",
+        get_editor_subsystem=lambda cls: subsystems[cls],
+        pie_worlds=pie_worlds,
+        EditorLevelLibrary=SimpleNamespace(get_pie_worlds=lambda simulating: list(pie_worlds)),
+        GameplayStatics=SimpleNamespace(get_time_seconds=lambda world: world.time_seconds),
+        register_slate_post_tick_callback=register_tick,
+        unregister_slate_post_tick_callback=lambda handle: tick_callbacks.pop(handle, None),
+    )
+    if clock_plugin:
+        clock = SimpleNamespace(enabled=None)
+
+        def enable_fixed_step(step):
+            clock.enabled = step
+            calls.append(("enable_fixed_step", step))
+            return True
+
+        def disable_fixed_step():
+            clock.enabled = None
+            calls.append(("disable_fixed_step",))
+
+        clock.enable_fixed_step = enable_fixed_step
+        clock.disable_fixed_step = disable_fixed_step
+        unreal.ExSimulationClockLibrary = clock
+    return unreal
+
+
+class _ScreenshotWriter:
+    """ExScreenshotWriterLibrary stub: tickets finish when finish() is called."""
+
+    MAX_IN_FLIGHT = 4
+
+    def __init__(self, unreal):
+        self._unreal = unreal
+        self.statuses = {}  # {ticket: (status, error)}
+        self.files = {}  # {ticket: filename}
+        self.last_ticket = 0
+
+    def capture_render_target_async(self, render_target, filename, file_format, quality):
+        in_flight = [t for t, (status, _) in self.statuses.items() if status == "PENDING"]
+        if len(in_flight) >= self.MAX_IN_FLIGHT:
+            return 0
+        self.last_ticket += 1
+        self.statuses[self.last_ticket] = ("PENDING", "")
+        self.files[self.last_ticket] = filename
+        return self.last_ticket
+
+    def finish(self, ticket, error=""):
+        self.statuses[ticket] = ("FAILED" if error else "COMPLETED", error)
+
+    def get_capture_status(self, ticket):
+        status, error = self.statuses.get(ticket, ("UNKNOWN", ""))
+        if status not in ("PENDING", "UNKNOWN"):
+            del self.statuses[ticket]
+        return getattr(self._unreal.ExScreenshotStatus, status), error
+
+    def wait_for_captures(self, timeout):
+        for ticket, (status, _) in list(self.statuses.items()):
+            if status == "PENDING":
+                self.finish(ticket)
+        return True
+
+
+def _add_screenshot_writer(unreal):
+    """Add the async screenshot writer and export_render_target to a stub unreal module."""
+    unreal.ExScreenshotStatus = SimpleNamespace(
+        PENDING="PENDING", COMPLETED="COMPLETED", FAILED="FAILED", UNKNOWN="UNKNOWN"
+    )
+    unreal.ExScreenshotFormat = SimpleNamespace(PNG="PNG", JPEG="JPEG")
+    unreal.ExScreenshotWriterLibrary = _ScreenshotWriter(unreal)
+
+    def export_render_target(world, render_target, output_dir, basename):
+        unreal.calls.append(("export", basename))
+        Path(output_dir, basename).write_bytes(b"png")
+
+    unreal.RenderingLibrary = SimpleNamespace(export_render_target=export_render_target)
+    return unreal.ExScreenshotWriterLibrary
+
+
+def _attached_rig(scene_capture):
+    """SceneCaptureRig attached to a stub PIE actor (create/attach need a real editor)."""
+    rig = scene_capture.SceneCaptureRig("Rig", (8, 8))
+    component = SimpleNamespace(capture_scene=lambda: None)
+    rig._pie_actor = SimpleNamespace(
+        capture_component2d=component,
+        set_actor_location_and_rotation=lambda location, rotation, sweep, teleport: None,
+    )
+    rig._render_target = object()
+    rig._pie_world = object()
+    return rig
+
+
+@pytest.fixture
+def editor_capture(monkeypatch):
+    """Load the PIE modules of editor_capture against a stub unreal module."""
+
+    def load(unreal):
+        monkeypatch.setitem(sys.modules, "unreal", unreal)
+        # Bare package, so the package __init__ (which needs more of unreal) is skipped
+        package = types.ModuleType("editor_capture_stub")
+        package.__path__ = [str(EDITOR_CAPTURE_DIR)]
+        monkeypatch.setitem(sys.modules, "editor_capture_stub", package)
+        modules = {}
+        for name in ("pie_tick_executor", "scene_capture", "trace_file", "pie_tracer"):
+            spec = importlib.util.spec_from_file_location(
+                f"editor_capture_stub.{name}", EDITOR_CAPTURE_DIR / f"{name}.py"
+            )
+            module = importlib.util.module_from_spec(spec)
+            monkeypatch.setitem(sys.modules, spec.name, module)
+            spec.loader.exec_module(module)
+            modules[name] = module
+        return SimpleNamespace(**modules)
+
+    return load
+
+
+def _tick(unreal, count=1):
+    for _ in range(count):
+        for fn in list(unreal.tick_callbacks.values()):
+            fn(1.0 / 60.0)
+
+
+class TestFixedStepClock:
+    """PIETracer._tick_delta and the fixed-step clock switch."""
+
+    def test_tick_delta(self, editor_capture, tmp_path):
+        unreal = _fake_unreal()
+        pie_tracer = editor_capture(unreal).pie_tracer
+        tracer = pie_tracer.PIETracer(str(tmp_path), ["Cube"], fixed_step=0.01)
+        assert tracer._tick_delta() == pytest.approx(1.0 / tracer.ASSUMED_FPS)
+
+        tracer._enable_fixed_step()
+        assert tracer._tick_delta() == 0.01
+        tracer._is_paused_for_screenshots = True
+        assert tracer._tick_delta() == 0.0
+
+    def test_enable_and_disable(self, editor_capture, tmp_path):
+        unreal = _fake_unreal()
+        pie_tracer = editor_capture(unreal).pie_tracer
+        tracer = pie_tracer.PIETracer(str(tmp_path), ["Cube"], fixed_step=0.02)
+        tracer._enable_fixed_step()
+        assert unreal.ExSimulationClockLibrary.enabled == 0.02
+        assert tracer._metadata["clock"] == "fixed_step"
+        assert tracer._metadata["fixed_step"] == 0.02
+
+        tracer._disable_fixed_step()
+        tracer._disable_fixed_step()
+        assert unreal.ExSimulationClockLibrary.enabled is None
+        assert unreal.calls.count(("disable_fixed_step",)) == 1
+
+    def test_without_plugin_traces_in_real_time(self, editor_capture, tmp_path):
+        unreal = _fake_unreal(clock_plugin=False)
+        pie_tracer = editor_capture(unreal).pie_tracer
+        tracer = pie_tracer.PIETracer(str(tmp_path), ["Cube"], fixed_step=0.02)
+        tracer._enable_fixed_step()
+        assert not tracer._fixed_step_active
+        assert "clock" not in tracer._metadata
+        assert tracer._tick_delta() == pytest.approx(1.0 / tracer.ASSUMED_FPS)
+        tracer._disable_fixed_step()
+
+    def test_invalid_step(self, editor_capture, tmp_path):
+        pie_tracer = editor_capture(_fake_unreal()).pie_tracer
+        with pytest.raises(ValueError):
+            pie_tracer.PIETracer(str(tmp_path), ["Cube"], fixed_step=0.0)
+
+
+class TestWorldTime:
+    """Both sampling paths measure time on the PIE world's clock."""
+
+    def test_tick_delta_follows_world_time(self, editor_capture, tmp_path):
+        unreal = _fake_unreal()
+        pie_tracer = editor_capture(unreal).pie_tracer
+        tracer = pie_tracer.PIETracer(str(tmp_path), ["Cube"])
+        world = SimpleNamespace(time_seconds=10.0)
+        unreal.pie_worlds.append(world)
+
+        # The first reading only sets the baseline
+        assert tracer._tick_delta() == 0.0
+        world.time_seconds = 10.05
+        assert tracer._tick_delta() == pytest.approx(0.05)
+        # Paused (or slow) frames advance by what the world advanced, not 1 / ASSUMED_FPS
+        assert tracer._tick_delta() == 0.0
+        world.time_seconds = 10.3
+        assert tracer._tick_delta() == pytest.approx(0.25)
+
+    def test_duration_is_world_time(self, editor_capture, tmp_path):
+        unreal = _fake_unreal()
+        pie_tracer = editor_capture(unreal).pie_tracer
+        tracer = pie_tracer.PIETracer(str(tmp_path), ["Cube"], duration=1.0, auto_stop_pie=False)
+        tracer.start()
+        world = SimpleNamespace(time_seconds=0.0)
+        unreal.pie_worlds.append(world)
+        unreal.editor_utility.on_begin_pie.broadcast(False)
+
+        # Eight long frames: the trace ends after one second of world time,
+        # not after ASSUMED_FPS frames
+        for _ in range(8):
+            _tick(unreal)
+            world.time_seconds += 0.125
+        assert not tracer.is_complete
+        _tick(unreal)
+        assert tracer.is_complete
+        assert tracer.get_result()["duration"] == 1.0
+
+    def test_new_pie_session_resets_the_baseline(self, editor_capture, tmp_path):
+        unreal = _fake_unreal()
+        pie_tracer = editor_capture(unreal).pie_tracer
+        tracer = pie_tracer.PIETracer(str(tmp_path), ["Cube"], duration=5.0)
+        tracer.start()
+        unreal.pie_worlds.append(SimpleNamespace(time_seconds=3.0))
+        assert tracer._tick_delta() == 0.0
+        tracer._on_pie_ended(None)
+
+        unreal.pie_worlds[:] = [SimpleNamespace(time_seconds=0.5)]
+        assert tracer._tick_delta() == 0.0
+        assert tracer._pie_world is unreal.pie_worlds[0]
+
+
+class TestClockRestore:
+    """The fixed step never outlives the trace."""
+
+    def test_restored_when_pie_ends_early(self, editor_capture, tmp_path):
+        unreal = _fake_unreal()
+        pie_tracer = editor_capture(unreal).pie_tracer
+        tracer = pie_tracer.PIETracer(str(tmp_path), ["Cube"], duration=5.0, fixed_step=0.01)
+        tracer.start()
+        assert unreal.ExSimulationClockLibrary.enabled == 0.01
+
+        unreal.editor_utility.on_begin_pie.broadcast(False)
+        unreal.editor_utility.on_end_pie.broadcast(False)
+        assert unreal.ExSimulationClockLibrary.enabled is None
+        assert not tracer.is_complete
+
+    def test_restored_when_start_fails(self, editor_capture, tmp_path, monkeypatch):
+        unreal = _fake_unreal()
+        modules = editor_capture(unreal)
+
+        def fail(self):
+            raise RuntimeError("bind failed")
+
+        monkeypatch.setattr(modules.pie_tick_executor.PIETickExecutor, "start", fail)
+        tracer = modules.pie_tracer.PIETracer(str(tmp_path), ["Cube"], duration=5.0, fixed_step=0.01)
+        with pytest.raises(RuntimeError):
+            tracer.start()
+        assert ("enable_fixed_step", 0.01) in unreal.calls
+        assert unreal.ExSimulationClockLibrary.enabled is None
+        assert not tracer._is_running
+
+    def test_restored_when_completion_fails(self, editor_capture, tmp_path, monkeypatch):
+        unreal = _fake_unreal()
+        pie_tracer = editor_capture(unreal).pie_tracer
+        tracer = pie_tracer.PIETracer(str(tmp_path), ["Cube"], duration=5.0, fixed_step=0.01)
+        tracer.start()
+
+        def fail():
+            raise OSError("disk full")
+
+        monkeypatch.setattr(tracer, "_close_trace_writer", fail)
+        with pytest.raises(OSError):
+            tracer._on_executor_complete(tracer._executor)
+        assert unreal.ExSimulationClockLibrary.enabled is None
+
+
+class TestTickBudget:
+    """A duration ends the trace on simulation time, not on a precomputed frame count."""
+
+    def test_duration_gives_open_budget(self, editor_capture, tmp_path):
+        unreal = _fake_unreal()
+        pie_tracer = editor_capture(unreal).pie_tracer
+        tracer = pie_tracer.PIETracer(
+            str(tmp_path), ["Cube"], duration=0.5, fixed_step=0.125, auto_stop_pie=False
+        )
+        tracer.start()
+        assert tracer._executor.total_ticks is None
+        executor = tracer._executor
+        unreal.editor_utility.on_begin_pie.broadcast(False)
+
+        # Paused frames do not advance simulation time, and do not use up a budget
+        tracer._is_paused_for_screenshots = True
+        _tick(unreal, 50)
+        assert not tracer.is_complete
+        tracer._is_paused_for_screenshots = False
+
+        _tick(unreal, 3)
+        assert not tracer.is_complete
+        _tick(unreal)
+        assert tracer.is_complete
+        assert tracer.get_result()["duration"] == 0.5
+        assert executor.is_complete
+        assert unreal.ExSimulationClockLibrary.enabled is None
+
+    def test_without_duration_budget_is_capped(self, editor_capture, tmp_path):
+        pie_tracer = editor_capture(_fake_unreal()).pie_tracer
+        tracer = pie_tracer.PIETracer(str(tmp_path), ["Cube"], fixed_step=0.5)
+        tracer.start()
+        assert tracer._executor.total_ticks == 10 * 60 * 2
+        tracer.stop()
+
+
+class TestOpenSchedule:
+    """PIETickExecutor with total_ticks=None and execution_count=None."""
+
+    def test_runs_until_a_snippet_completes(self, editor_capture):
+        unreal = _fake_unreal()
+        pie_tick_executor = editor_capture(unreal).pie_tick_executor
+        executor = pie_tick_executor.PIETickExecutor(
+            total_ticks=None,
+            code_snippets=[
+                {"code": "if __tick__ == 99: __executor__._auto_complete()", "execution_count": None},
+                {"code": "pass", "start_tick": 3, "execution_count": 2},
+            ],
+            auto_stop_pie=False,
+        )
+        executor.start()
+        unreal.editor_utility.on_begin_pie.broadcast(False)
+        _tick(unreal, 200)
+        assert executor.is_complete
+        assert executor.get_result()["executed_ticks"] == 99
+        timings = executor.get_snippet_timings()
+        assert timings[0]["exec_count"] == 100
+        assert timings[1]["exec_count"] == 2
+
+
+class TestSnippetCompilation:
+    """PIETickExecutor compiles each distinct snippet once and times each snippet."""
+
+    def _executor(self, editor_capture, snippets, total_ticks=4):
+        unreal = _fake_unreal()
+        pie_tick_executor = editor_capture(unreal).pie_tick_executor
+        executor = pie_tick_executor.PIETickExecutor(
+            total_ticks=total_ticks, code_snippets=snippets, auto_stop_pie=False
+        )
+        executor.start()
+        unreal.editor_utility.on_begin_pie.broadcast(False)
+        return executor, unreal
+
+    def test_identical_snippets_compile_once(self, editor_capture):
+        code = "def f():\n    return 1 / 0\nf()\n"
+        executor, unreal = self._executor(
+            editor_capture,
+            [
+                {"code": code, "start_tick": 0},
+                {"code": "x = 1", "start_tick": 1},
+                {"code": code, "start_tick": 2},
+            ],
+        )
+        assert len(executor._compiled) == 2
+        timings = executor.get_snippet_timings()
+        assert timings[2]["compile_ms"] == 0.0
+
+        # The shared code object is labelled with each snippet's own index
+        for index in (0, 2):
+            code_obj = executor._snippet_code[index][0]
+            nested = next(c for c in code_obj.co_consts if isinstance(c, types.CodeType))
+            assert code_obj.co_filename == nested.co_filename == f"<pie_snippet_{index}>"
+        assert executor._snippet_code[0][0] is not executor._snippet_code[2][0]
+
+        _tick(unreal, 4)
+        assert executor.is_complete
+        assert [error["snippet_index"] for error in executor.get_result()["errors"]] == [0, 2]
+
+    def test_per_snippet_timings(self, editor_capture):
+        executor, unreal = self._executor(
+            editor_capture,
+            [
+                {"code": "a = 1", "start_tick": 0, "execution_count": 3},
+                {"code": "b = 2", "start_tick": 2, "execution_count": 2},
+            ],
+        )
+        _tick(unreal, 4)
+        timings = {t["snippet_index"]: t for t in executor.get_result()["snippet_timings"]}
+        assert timings[0]["exec_count"] == 3
+        assert timings[1]["exec_count"] == 2
+        assert timings[0]["exec_max_ms"] >= timings[0]["exec_avg_ms"] >= 0.0
+
+    def test_compile_errors_reported_once(self, editor_capture):
+        executor, unreal = self._executor(
+            editor_capture,
+            [
+                {"code": "x = (", "start_tick": 0, "execution_count": 4},
+                {"code": "x = 1\0", "start_tick": 0, "execution_count": 4},
+                {"code": "ok = True", "start_tick": 0, "execution_count": 4},
+            ],
+        )
+        _tick(unreal, 4)
+        errors = executor.get_result()["errors"]
+        assert [error["snippet_index"] for error in errors] == [0, 1]
+        assert errors[0]["error"].startswith("SyntaxError")
+        # ValueError before Python 3.12, SyntaxError since
+        assert "null bytes" in errors[1]["error"]
+        timings = executor.get_snippet_timings()
+        assert timings[0]["exec_count"] == timings[1]["exec_count"] == 0
+        assert timings[2]["exec_count"] == 4
+        assert executor.get_context()["ok"] is True
+
+
+class TestSceneCaptureTickets:
+    """SceneCaptureRig with the async screenshot writer."""
+
+    def test_collects_finished_tickets(self, editor_capture, tmp_path):
+        unreal = _fake_unreal()
+        writer = _add_screenshot_writer(unreal)
+        rig = _attached_rig(editor_capture(unreal).scene_capture)
+        assert rig.backend == "async"
+
+        for view in ("front", "side", "back"):
+            assert rig.capture(None, None, str(tmp_path / f"{view}.png"), owner=view)
+        assert rig.pending() == 3
+
+        writer.finish(1)
+        writer.finish(2, error="disk full")
+        finished = rig.collect()
+        assert finished == [
+            (str(tmp_path / "front.png"), "front", None),
+            (str(tmp_path / "side.png"), "side", "disk full"),
+        ]
+        assert rig.pending() == 1
+
+        assert rig.collect(wait=True) == [(str(tmp_path / "back.png"), "back", None)]
+        assert rig.pending() == 0
+        assert rig.sync_fallbacks == 0
+
+    def test_refused_capture_drains_queue_and_retries(self, editor_capture, tmp_path):
+        unreal = _fake_unreal()
+        writer = _add_screenshot_writer(unreal)
+        rig = _attached_rig(editor_capture(unreal).scene_capture)
+        for index in range(writer.MAX_IN_FLIGHT):
+            assert rig.capture(None, None, str(tmp_path / f"{index}.png"), owner=index)
+
+        # The writer is full: the rig waits for the queue, keeps the finished writes
+        # for collect() and queues the capture instead of exporting it
+        assert rig.capture(None, None, str(tmp_path / "extra.png"), owner="extra")
+        assert rig.sync_fallbacks == 0
+        assert not any(call[0] == "export" for call in unreal.calls)
+        assert rig.pending() == writer.MAX_IN_FLIGHT + 1
+
+        finished = rig.collect()
+        assert [owner for _, owner, _ in finished] == list(range(writer.MAX_IN_FLIGHT))
+        assert rig.collect(wait=True) == [(str(tmp_path / "extra.png"), "extra", None)]
+        assert rig.pending() == 0
+
+    def test_refused_capture_is_exported_and_counted(self, editor_capture, tmp_path):
+        unreal = _fake_unreal()
+        writer = _add_screenshot_writer(unreal)
+        rig = _attached_rig(editor_capture(unreal).scene_capture)
+        for index in range(writer.MAX_IN_FLIGHT):
+            writer.capture_render_target_async(None, f"other_{index}.png", "PNG", 90)
+        # Writes that do not finish within the drain timeout
+        writer.wait_for_captures = lambda timeout: False
+
+        filename = tmp_path / "front.png"
+        assert rig.capture(None, None, str(filename))
+        assert filename.read_bytes() == b"png"
+        assert rig.sync_fallbacks == 1
+        assert ("export", "front") in unreal.calls
+        assert sum(1 for call in unreal.calls if call[0] == "warning") == 1
+
+    def test_tracer_metadata_reports_fallbacks(self, editor_capture, tmp_path):
+        unreal = _fake_unreal()
+        _add_screenshot_writer(unreal)
+        modules = editor_capture(unreal)
+        tracer = modules.pie_tracer.PIETracer(str(tmp_path), ["Cube"], duration=1.0)
+        tracer.start()
+        tracer._capture_rig = _attached_rig(modules.scene_capture)
+        tracer._capture_rig.sync_fallbacks = 2
+
+        tracer._on_executor_complete(tracer._executor)
+        with open(os.path.join(str(tmp_path), "metadata.json"), encoding="utf-8") as f:
+            assert json.load(f)["screenshot_sync_fallbacks"] == 2
+
+
+def _stub_actor(name, label, class_name="BP_Enemy_C"):
+    return SimpleNamespace(
+        get_name=lambda: name,
+        get_actor_label=lambda: label,
+        get_path_name=lambda: f"/Game/Map.Map:PersistentLevel.{name}",
+        get_class=lambda: SimpleNamespace(get_name=lambda: class_name),
+    )
+
+
+class TestColumnarActorKeys:
+    """Columnar traces key actors by object path, not by label."""
+
+    def _tracer(self, editor_capture, tmp_path, actor_names, actors):
+        unreal = _fake_unreal()
+        unreal.Actor = "Actor"
+        unreal.GameplayStatics.get_all_actors_of_class = lambda world, cls: actors
+        modules = editor_capture(unreal)
+        tracer = modules.pie_tracer.PIETracer(str(tmp_path), actor_names, output_format="columnar")
+        tracer._trace_writer = modules.trace_file.TraceFileWriter(str(tmp_path / "trace.uetrace"))
+        tracer._find_actors(object())
+        return unreal, tracer
+
+    @staticmethod
+    def _sample(x):
+        return {
+            "timestamp": 0.0,
+            "location": {"x": x, "y": 0.0, "z": 0.0},
+            "rotation": {"pitch": 0.0, "yaw": 0.0, "roll": 0.0},
+            "velocity": None,
+        }
+
+    @staticmethod
+    def _index_actors(path):
+        from ue_mcp.core.trace_file import TraceFile
+
+        with TraceFile(path) as trace:
+            return trace.summary()
+
+    def test_actors_sharing_a_label_get_separate_columns(self, editor_capture, tmp_path):
+        actors = [_stub_actor("BP_Enemy_C_0", "Enemy"), _stub_actor("BP_Enemy_C_1", "Enemy")]
+        _, tracer = self._tracer(editor_capture, tmp_path, ["BP_Enemy_C_0", "BP_Enemy_C_1"], actors)
+        for tick in (1, 2):
+            tracer._write_sample("BP_Enemy_C_0", tick, self._sample(1.0))
+            tracer._write_sample("BP_Enemy_C_1", tick, self._sample(2.0))
+
+        summary = self._index_actors(tracer._close_trace_writer())
+        assert [(a["name"], a["label"], a["count"]) for a in summary] == [
+            ("/Game/Map.Map:PersistentLevel.BP_Enemy_C_0", "Enemy", 2),
+            ("/Game/Map.Map:PersistentLevel.BP_Enemy_C_1", "Enemy", 2),
+        ]
+
+    def test_same_actor_requested_twice_is_tracked_once(self, editor_capture, tmp_path):
+        actors = [_stub_actor("BP_Enemy_C_0", "Enemy")]
+        unreal, tracer = self._tracer(editor_capture, tmp_path, ["BP_Enemy_C_0", "Enemy"], actors)
+
+        assert list(tracer._actor_refs) == ["BP_Enemy_C_0"]
+        assert any("tracking it once" in call[1] for call in unreal.calls if call[0] == "warning")
+
+
+class _NativeSampler:
+    """ExActorTransformSampler stub with the native tick contract: world_tick() runs once per
+    world tick, before that frame's Slate tick; paused ticks count but are not sampled."""
+
+    sampler = None
+
+    def __init__(self, world):
+        self._world = world
+        self._actors = []
+        self._frames = []
+        self._interval = None
+        self._tick_index = 0
+
+    @classmethod
+    def create_sampler(cls, world, capacity):
+        cls.sampler = cls(world)
+        return cls.sampler
+
+    def register_actors(self, actors):
+        self._actors = list(actors)
+        return len(self._actors)
+
+    def start_sampling(self, interval):
+        self._interval = interval
+        self._start = self._world.time_seconds
+        self._next = interval
+        return True
+
+    def stop_sampling(self):
+        self._interval = None
+
+    def world_tick(self):
+        if self._interval is None:
+            return
+        self._tick_index += 1
+        if self._world.paused:
+            return
+        elapsed = self._world.time_seconds - self._start
+        if elapsed >= self._next:
+            self._next += self._interval
+            self._frames.append((self._tick_index, elapsed))
+
+    def get_num_buffered_frames(self):
+        return len(self._frames)
+
+    def get_num_dropped_frames(self):
+        return 0
+
+    def drain_samples(self, max_frames):
+        frames, self._frames = self._frames, []
+        values = [0.0] * (9 * len(self._actors) * len(frames))
+        valid = [True] * (len(self._actors) * len(frames))
+        return len(frames), [t for t, _ in frames], [e for _, e in frames], values, valid
+
+
+class TestTickNumbering:
+    """Native and Python sampling number samples by the same executor tick."""
+
+    def _trace_ticks(self, editor_capture, tmp_path, native):
+        unreal = _fake_unreal(clock_plugin=False)
+        vector = SimpleNamespace(x=0.0, y=0.0, z=0.0)
+        actor = _stub_actor("Cube_0", "Cube", "StaticMeshActor")
+        actor.get_actor_location = lambda: vector
+        actor.get_actor_rotation = lambda: SimpleNamespace(pitch=0.0, yaw=0.0, roll=0.0)
+        actor.get_velocity = lambda: vector
+        unreal.Actor = "Actor"
+        unreal.GameplayStatics.get_all_actors_of_class = lambda world, cls: [actor]
+        if native:
+            unreal.ExActorTransformSampler = _NativeSampler
+        pie_tracer = editor_capture(unreal).pie_tracer
+        tracer = pie_tracer.PIETracer(
+            str(tmp_path),
+            ["Cube"],
+            interval_seconds=0.25,
+            duration=1.9,
+            auto_stop_pie=False,
+            output_format="columnar",
+        )
+        tracer.start()
+        world = SimpleNamespace(time_seconds=0.0, paused=False, get_name=lambda: "Map")
+        unreal.editor_utility.on_begin_pie.broadcast(False)
+
+        # The PIE world shows up on the third executor tick, and is paused for a while
+        for frame in range(40):
+            if frame == 2:
+                unreal.pie_worlds.append(world)
+            world.paused = 12 <= frame < 16
+            if frame >= 2 and not world.paused:
+                world.time_seconds += 0.0625
+            if native and _NativeSampler.sampler is not None:
+                _NativeSampler.sampler.world_tick()
+            _tick(unreal)
+            if tracer.is_complete:
+                break
+
+        assert tracer.is_complete
+        from ue_mcp.core.trace_file import TraceFile
+
+        with TraceFile(tmp_path / "trace.uetrace") as trace:
+            assert trace.metadata["sampling_backend"] == ("native" if native else "python")
+            return trace.read(trace.actor_names[0])["tick"]
+
+    def test_native_and_python_paths_agree(self, editor_capture, tmp_path):
+        python_ticks = self._trace_ticks(editor_capture, tmp_path / "python", native=False)
+        native_ticks = self._trace_ticks(editor_capture, tmp_path / "native", native=True)
+        assert python_ticks == [6, 10, 18, 22, 26, 30, 34]
+        assert native_ticks == python_ticks
@@ -0,0 +1,154 @@
+"""
+Unit tests for the RemoteExecutionClient command channel.
+
+Covers incremental decoding of the concatenated-JSON response stream and
+FIFO matching of pipelined commands to their responses, using a local socket
+pair in place of the UE5 command connection. No UE5 editor required.
+
+Usage:
+    pytest tests/test_remote_client.py -v
+"""
+
+import json
+import socket
+import threading
+import time
+
+from ue_mcp.remote_client import JsonStreamDecoder, RemoteExecutionClient
+
+
+def _result_message(output: str, success: bool = True) -> dict:
+    return {
+        "type": "command_result",
+        "source": "fake-node",
+        "data": {"success": success, "result": "None", "output": [{"type": "Info", "output": output}]},
+    }
+
+
+class FakeCommandPeer:
+    """Answers each command with its own command text, in small chunks, after an optional delay."""
+
+    def __init__(self, sock: socket.socket, delays: dict[str, float] | None = None):
+        self.sock = sock
+        self.delays = delays or {}
+        self.received: list[str] = []
+        self.thread = threading.Thread(target=self._run, daemon=True)
+        self.thread.start()
+
+    def _run(self):
+        decoder = JsonStreamDecoder()
+        while True:
+            try:
+                data = self.sock.recv(65536)
+            except OSError:
+                return
+            if not data:
+                return
+            for message in decoder.feed(data):
+                command = message["data"]["command"]
+                self.received.append(command)
+                time.sleep(self.delays.get(command, 0.0))
+                # Echo first, like the UE5 command channel, then the result in fragments
+                payload = json.dumps(message).encode() + json.dumps(_result_message(command)).encode()
+                for i in range(0, len(payload), 7):
+                    self.sock.sendall(payload[i : i + 7])
+
+
+def _connected_client(delays=None, max_in_flight=1):
+    client_sock, peer_sock = socket.socketpair()
+    client = RemoteExecutionClient(max_in_flight=max_in_flight)
+    client.unreal_node_id = "fake-node"
+    client.cmd_connection = client_sock
+    return client, FakeCommandPeer(peer_sock, delays), peer_sock
+
+
+class TestJsonStreamDecoder:
+    """Incremental stream splitting."""
+
+    def test_split_across_chunks(self):
+        payload = json.dumps({"a": "x{y}\"z\\", "b": [1, {"c": 2}]}).encode()
+        decoder = JsonStreamDecoder()
+        messages = []
+        for i in range(len(payload)):
+            messages += decoder.feed(payload[i : i + 1])
+        assert messages == [{"a": "x{y}\"z\\", "b": [1, {"c": 2}]}]
+        assert decoder.pending_bytes == 0
+
+    def test_multiple_messages_in_one_chunk(self):
+        payload = b'{"n": 1} \n{"n": 2}{"n": '
+        decoder = JsonStreamDecoder()
+        assert decoder.feed(payload) == [{"n": 1}, {"n": 2}]
+        assert decoder.feed(b"3}") == [{"n": 3}]
+
+    def test_unicode_and_escaped_backslash_at_chunk_end(self):
+        text = "café \\ end"
+        payload = json.dumps({"t": text}, ensure_ascii=False).encode("utf-8")
+        split = payload.index(b"\\") + 1  # split right after the escaping backslash
+        decoder = JsonStreamDecoder()
+        assert decoder.feed(payload[:split]) == []
+        assert decoder.feed(payload[split:]) == [{"t": text}]
+
+    def test_invalid_message_is_skipped(self):
+        decoder = JsonStreamDecoder()
+        assert decoder.feed(b'{"a": nope}{"b": 1}') == [{"b": 1}]
+
+
+class TestCommandChannel:
+    """Pipelined commands over one connection."""
+
+    def test_execute(self):
+        client, peer, peer_sock = _connected_client()
+        try:
+            result = client.execute("print(1)", exec_type="ExecuteStatement", timeout=5.0)
+            assert result["success"] is True
+            assert result["output"][0]["output"] == "print(1)"
+        finally:
+            client._cleanup_sockets()
+            peer_sock.close()
+
+    def test_execute_many_preserves_order(self):
+        for max_in_flight in (1, 4):
+            client, peer, peer_sock = _connected_client(max_in_flight=max_in_flight)
+            try:
+                commands = [f"cmd_{i}" for i in range(6)]
+                results = client.execute_many(commands, timeout=5.0)
+                assert [r["output"][0]["output"] for r in results] == commands
+                assert peer.received == commands
+            finally:
+                client._cleanup_sockets()
+                peer_sock.close()
+
+    def test_collect_out_of_order(self):
+        client, peer, peer_sock = _connected_client(max_in_flight=2)
+        try:
+            first = client.submit("first")
+            second = client.submit("second")
+            assert client.collect(second, timeout=5.0)["output"][0]["output"] == "second"
+            assert client.collect(first, timeout=5.0)["output"][0]["output"] == "first"
+        finally:
+            client._cleanup_sockets()
+            peer_sock.close()
+
+    def test_timed_out_response_is_not_reused(self):
+        client, peer, peer_sock = _connected_client(delays={"slow": 0.5})
+        try:
+            slow = client.execute("slow", timeout=0.1)
+            assert slow["success"] is False
+            assert slow["error"] == "No response from UE5"
+            # The late "slow" response must be discarded, not returned for "fast"
+            fast = client.execute("fast", timeout=5.0)
+            assert fast["output"][0]["output"] == "fast"
+        finally:
+            client._cleanup_sockets()
+            peer_sock.close()
+
+    def test_connection_closed(self):
+        client, peer, peer_sock = _connected_client()
+        peer_sock.shutdown(socket.SHUT_RDWR)
+        peer_sock.close()
+        try:
+            results = client.execute_many(["a", "b"], timeout=2.0)
+            assert all(r["crashed"] is True for r in results)
+            assert len(results) == 2
+        finally:
+            client._cleanup_sockets()
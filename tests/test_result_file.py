@@ -0,0 +1,128 @@
+"""
+Unit tests for the out-of-band script result file.
+
+Writes results with the editor-side writer (editor_capture.result_file) and reads
+them back with the server-side reader (ue_mcp.core.result_file). No UE5 editor required.
+
+Usage:
+    pytest tests/test_result_file.py -v
+"""
+
+import importlib.util
+from pathlib import Path
+
+import pytest
+
+from ue_mcp.core.result_file import (
+    ResultFileError,
+    new_result_file_path,
+    read_result_file,
+    take_result_file,
+)
+from ue_mcp.tools._helpers import build_env_injection_code, parse_json_result
+
+# Load the editor-side writer directly; importing the editor_capture package
+# would pull in modules that require the unreal module
+WRITER_PATH = (
+    Path(__file__).parent.parent
+    / "src"
+    / "ue_mcp"
+    / "extra"
+    / "site-packages"
+    / "editor_capture"
+    / "result_file.py"
+)
+_spec = importlib.util.spec_from_file_location("editor_result_file", WRITER_PATH)
+editor_result_file = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(editor_result_file)
+
+
+class TestResultFileFormat:
+    """Writer/reader format compatibility."""
+
+    def test_constants_match_writer(self):
+        from ue_mcp.core import result_file
+
+        assert result_file.RESULT_FILE_MAGIC == editor_result_file.RESULT_FILE_MAGIC
+        assert result_file.RESULT_FILE_VERSION == editor_result_file.RESULT_FILE_VERSION
+        assert result_file.RESULT_FILE_HEADER.format == editor_result_file.RESULT_FILE_HEADER.format
+        assert result_file.RESULT_ENCODING_JSON == editor_result_file.RESULT_ENCODING_JSON
+
+    def test_round_trip(self, tmp_path):
+        path = str(tmp_path / "result.bin")
+        data = {"success": True, "name": "Würfel", "values": [1, 2.5, None], "nested": {"a": []}}
+        editor_result_file.write_result_file(path, data)
+
+        assert read_result_file(path) == data
+        assert not Path(path + ".tmp").exists()
+
+    def test_default_stringifies_unknown_objects(self, tmp_path):
+        path = str(tmp_path / "result.bin")
+        editor_result_file.write_result_file(path, {"obj": object()}, default=lambda o: "obj")
+        assert read_result_file(path) == {"obj": "obj"}
+
+    def test_unserializable_writes_nothing(self, tmp_path):
+        path = str(tmp_path / "result.bin")
+        with pytest.raises(TypeError):
+            editor_result_file.write_result_file(path, {"obj": object()})
+        assert not Path(path).exists()
+
+
+class TestResultFileErrors:
+    """Truncated and foreign files."""
+
+    def test_truncated_payload(self, tmp_path):
+        path = tmp_path / "result.bin"
+        editor_result_file.write_result_file(str(path), {"key": "value"})
+        path.write_bytes(path.read_bytes()[:-3])
+        with pytest.raises(ResultFileError, match="truncated"):
+            read_result_file(path)
+
+    def test_bad_magic(self, tmp_path):
+        path = tmp_path / "result.bin"
+        path.write_bytes(b"NOTARESULTFILE" + b"\0" * 16)
+        with pytest.raises(ResultFileError, match="bad magic"):
+            read_result_file(path)
+
+    def test_take_removes_file(self, tmp_path):
+        path = str(tmp_path / "result.bin")
+        editor_result_file.write_result_file(path, [1, 2, 3])
+        assert take_result_file(path) == [1, 2, 3]
+        assert not Path(path).exists()
+        # Missing or invalid files read as "no result"
+        assert take_result_file(path) is None
+        Path(path).write_bytes(b"garbage")
+        assert take_result_file(path) is None
+        assert not Path(path).exists()
+
+
+class TestScriptResultIntegration:
+    """Server-side plumbing for script results."""
+
+    def test_new_paths_are_unique(self):
+        assert new_result_file_path() != new_result_file_path()
+
+    def test_env_injection_sets_result_file(self):
+        code = build_env_injection_code("/scripts/x.py", {"a": 1}, result_file="/tmp/r.bin")
+        assert "os.environ['UE_MCP_RESULT'] = '/tmp/r.bin'" in code
+        assert "UE_MCP_RESULT" not in build_env_injection_code("/scripts/x.py", {"a": 1})
+
+    def test_parse_json_result_prefers_result_file(self):
+        exec_result = {
+            "success": True,
+            "output": [{"type": "Info", "output": '{"from": "output"}'}],
+            "result": "None",
+            "script_result": {"from": "file"},
+        }
+        assert parse_json_result(exec_result) == {"from": "file"}
+        del exec_result["script_result"]
+        assert parse_json_result(exec_result) == {"from": "output"}
+
+    def test_parse_json_result_ignores_exec_result(self):
+        # The editor fills "result" for every exec call ("None" for scripts)
+        exec_result = {
+            "success": True,
+            "result": "None",
+            "output": [{"type": "Info", "output": '{"success": true, "count": 3}'}],
+        }
+        assert parse_json_result(exec_result) == {"success": True, "count": 3}
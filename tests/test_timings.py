@@ -0,0 +1,95 @@
+"""
+Unit tests for per-phase execution latency (ue_mcp.core.timings).
+
+Covers PhaseTimer, LatencyStats and the timings recorded by ExecutionManager
+against a fake editor. No UE5 editor required.
+
+Usage:
+    pytest tests/test_timings.py -v
+"""
+
+import asyncio
+
+from ue_mcp.core.timings import LatencyStats, PhaseTimer, percentile
+
+
+class TestPhaseTimer:
+    """Durations of one call."""
+
+    def test_phases_add_up(self):
+        timer = PhaseTimer()
+        timer.add("execution", 0.5)
+        with timer.phase("diff"):
+            pass
+        timer.add("execution", 0.25)
+        timings = timer.as_dict()
+        assert list(timings["phases_ms"]) == ["execution", "diff"]
+        assert timings["phases_ms"]["execution"] == 750.0
+        assert timings["total_ms"] >= 0.0
+
+    def test_split_moves_editor_reported_time(self):
+        timer = PhaseTimer()
+        timer.add("execution", 1.0)
+        timer.split("execution", {"pre_capture": 0.25, "post_capture": 0.5, "bogus": None})
+        assert timer.phases == {"execution": 0.25, "pre_capture": 0.25, "post_capture": 0.5}
+
+    def test_total_is_frozen_once_stopped(self):
+        timer = PhaseTimer()
+        assert timer.stop() == timer.stop()
+
+
+class TestLatencyStats:
+    """Rolling percentiles."""
+
+    def test_percentile(self):
+        values = list(range(1, 101))
+        assert percentile(values, 50) == 50
+        assert percentile(values, 99) == 99
+        assert percentile([7], 90) == 7
+
+    def test_summary_and_window(self):
+        stats = LatencyStats(window=10)
+        for ms in range(1, 21):
+            timer = PhaseTimer()
+            timer.add("execution", ms / 1000.0)
+            if ms % 2:
+                timer.add("import_probe", 0.001)
+            stats.record("execute_code", timer)
+
+        summary = stats.summary()["execute_code"]
+        assert summary["calls"] == 20
+        assert summary["window"] == 10
+        execution = summary["phases_ms"]["execution"]
+        # Only the last 10 calls (11..20 ms) are kept
+        assert execution["count"] == 10
+        assert execution["p50"] == 15.0
+        assert execution["p99"] == execution["max"] == 20.0
+        # Each phase keeps its own last 10 samples
+        assert summary["phases_ms"]["import_probe"]["count"] == 10
+        assert summary["phases_ms"]["total"]["count"] == 10
+
+        stats.reset()
+        assert stats.summary() == {}
+
+
+class TestExecutionManagerTimings:
+    """Phases recorded by checked executions."""
+
+    def test_checked_code_phases(self, fake_execution_manager):
+        manager = fake_execution_manager(skip_checks=True)
+        result = asyncio.run(manager.execute_code("import os\nx = 1", timings=True))
+        phases = result["timings"]["phases_ms"]
+        for phase in ("syntax", "inspection", "api_check", "import_probe", "execution"):
+            assert phase in phases
+
+        # The timings block is opt-in, the stats are always collected
+        assert "timings" not in asyncio.run(manager.execute_code("x = 2"))
+        summary = manager.latency_stats.summary()["execute_code"]
+        assert summary["calls"] == 2
+        assert summary["phases_ms"]["total"]["count"] == 2
+
+    def test_syntax_error_is_recorded(self, fake_execution_manager):
+        manager = fake_execution_manager(skip_checks=True)
+        result = asyncio.run(manager.execute_code("def (", timings=True))
+        assert result["success"] is False
+        assert list(result["timings"]["phases_ms"]) == ["syntax"]
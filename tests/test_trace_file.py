@@ -0,0 +1,241 @@
+"""
+Unit tests for the columnar trace file format.
+
+Writes traces with the editor-side writer (editor_capture.trace_file) and reads them
+back with the server-side reader (ue_mcp.core.trace_file). No UE5 editor required.
+
+Usage:
+    pytest tests/test_trace_file.py -v
+"""
+
+import importlib.util
+import json
+import math
+import struct
+from pathlib import Path
+
+import pytest
+
+from ue_mcp.core.trace_file import TRACE_FILE_NAME, TraceFile, TraceFileError, read_trace
+
+# Load the editor-side writer directly; importing the editor_capture package
+# would pull in modules that require the unreal module
+WRITER_PATH = (
+    Path(__file__).parent.parent
+    / "src"
+    / "ue_mcp"
+    / "extra"
+    / "site-packages"
+    / "editor_capture"
+    / "trace_file.py"
+)
+_spec = importlib.util.spec_from_file_location("editor_trace_file", WRITER_PATH)
+editor_trace_file = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(editor_trace_file)
+
+
+def _write_trace(path: Path, actors: dict[str, int], metadata=None) -> Path:
+    """Write a trace with `count` samples per actor at ticks 6, 12, 18, ..."""
+    writer = editor_trace_file.TraceFileWriter(str(path))
+    max_count = max(actors.values())
+    for i in range(max_count):
+        for actor_index, (name, count) in enumerate(actors.items()):
+            if i >= count:
+                continue
+            tick = (i + 1) * 6
+            writer.add_sample(
+                name,
+                tick,
+                tick / 60.0,
+                (float(i), float(actor_index), 100.0),
+                (0.0, float(i % 360), 0.0),
+                None if name == "NoVelocity" else (1.0, 2.0, 3.0),
+            )
+    writer.close(metadata=metadata)
+    return path
+
+
+def _rewrite_index(path: Path, index_bytes: bytes) -> None:
+    """Replace the JSON index of a written trace, keeping the sample data."""
+    data = bytearray(path.read_bytes())
+    magic, version, actor_count, index_offset, _ = struct.unpack_from("<8sIIQQ", data, 0)
+    del data[index_offset:]
+    data += index_bytes
+    struct.pack_into("<8sIIQQ", data, 0, magic, version, actor_count, index_offset, len(index_bytes))
+    path.write_bytes(bytes(data))
+
+
+def _load_index(path: Path) -> dict:
+    data = path.read_bytes()
+    _, _, _, index_offset, index_length = struct.unpack_from("<8sIIQQ", data, 0)
+    return json.loads(data[index_offset : index_offset + index_length])
+
+
+class TestTraceFileFormat:
+    """Writer/reader format compatibility."""
+
+    def test_constants_match_writer(self):
+        from ue_mcp.core import trace_file
+
+        assert trace_file.TRACE_FILE_MAGIC == editor_trace_file.TRACE_FILE_MAGIC
+        assert trace_file.TRACE_FILE_VERSION == editor_trace_file.TRACE_FILE_VERSION
+        assert trace_file.TRACE_FILE_HEADER.format == editor_trace_file.TRACE_FILE_HEADER.format
+        assert trace_file.TRACE_FILE_NAME == editor_trace_file.TRACE_FILE_NAME
+
+    def test_round_trip(self, tmp_path):
+        path = _write_trace(tmp_path / TRACE_FILE_NAME, {"Cube": 5, "Sphere": 3}, {"level": "L"})
+
+        with TraceFile(path) as trace:
+            assert trace.actor_names == ["Cube", "Sphere"]
+            assert trace.metadata == {"level": "L"}
+            assert trace.summary()[1] == {
+                "name": "Sphere",
+                "label": "Sphere",
+                "count": 3,
+                "tick_min": 6,
+                "tick_max": 18,
+            }
+
+            cube = trace.read("Cube")
+            assert cube["count"] == 5
+            assert cube["truncated"] is False
+            assert cube["tick"] == [6, 12, 18, 24, 30]
+            assert cube["location_x"] == [0.0, 1.0, 2.0, 3.0, 4.0]
+            assert cube["location_z"] == [100.0] * 5
+            assert cube["velocity_y"] == [2.0] * 5
+            assert math.isclose(cube["timestamp"][1], 0.2)
+
+    def test_columns_are_aligned(self, tmp_path):
+        path = _write_trace(tmp_path / TRACE_FILE_NAME, {"A": 3, "B": 1})
+        with TraceFile(path) as trace:
+            for actor in trace._index["actors"]:
+                for offset in actor["offsets"].values():
+                    assert offset % 8 == 0
+
+    def test_missing_velocity_reads_as_none(self, tmp_path):
+        path = _write_trace(tmp_path / TRACE_FILE_NAME, {"NoVelocity": 2})
+        with TraceFile(path) as trace:
+            data = trace.read("NoVelocity", columns=["velocity_x"])
+            assert data["velocity_x"] == [None, None]
+
+
+class TestTraceFileSlicing:
+    """Actor, tick range, column and max_samples slicing."""
+
+    def test_tick_range(self, tmp_path):
+        path = _write_trace(tmp_path / TRACE_FILE_NAME, {"Cube": 10})
+        with TraceFile(path) as trace:
+            assert trace.read("Cube", tick_start=12, tick_end=30)["tick"] == [12, 18, 24, 30]
+            # Bounds between samples
+            assert trace.read("Cube", tick_start=13, tick_end=29)["tick"] == [18, 24]
+            # Open-ended
+            assert trace.read("Cube", tick_start=55)["tick"] == [60]
+            assert trace.read("Cube", tick_end=6)["tick"] == [6]
+            # Empty range
+            assert trace.read("Cube", tick_start=100)["count"] == 0
+            assert trace.read("Cube", tick_start=30, tick_end=12)["count"] == 0
+
+    def test_columns_always_include_tick(self, tmp_path):
+        path = _write_trace(tmp_path / TRACE_FILE_NAME, {"Cube": 2})
+        with TraceFile(path) as trace:
+            data = trace.read("Cube", columns=["location_x"])
+            assert set(data) == {"count", "truncated", "tick", "location_x"}
+
+    def test_max_samples(self, tmp_path):
+        path = _write_trace(tmp_path / TRACE_FILE_NAME, {"Cube": 10})
+        with TraceFile(path) as trace:
+            data = trace.read("Cube", tick_start=12, max_samples=3)
+            assert data["tick"] == [12, 18, 24]
+            assert data["truncated"] is True
+            assert trace.read("Cube", max_samples=0)["count"] == 0
+            with pytest.raises(TraceFileError):
+                trace.read("Cube", max_samples=-1)
+
+    def test_actors_sharing_a_label_stay_separate(self, tmp_path):
+        writer = editor_trace_file.TraceFileWriter(str(tmp_path / TRACE_FILE_NAME))
+        first = "/Game/Map.Map:PersistentLevel.BP_Enemy_C_0"
+        second = "/Game/Map.Map:PersistentLevel.BP_Enemy_C_1"
+        for tick in (6, 12):
+            writer.add_sample(first, tick, 0.0, (1.0, 0.0, 0.0), (0.0, 0.0, 0.0), label="Enemy")
+            writer.add_sample(second, tick, 0.0, (2.0, 0.0, 0.0), (0.0, 0.0, 0.0), label="Enemy")
+        cube = "/Game/Map.Map:PersistentLevel.Cube_0"
+        writer.add_sample(cube, 6, 0.0, (0.0, 0.0, 0.0), (0.0, 0.0, 0.0), label="Cube")
+        path = Path(writer.close())
+
+        with TraceFile(path) as trace:
+            assert trace.actor_names[:2] == [first, second]
+            assert [a["label"] for a in trace.summary()] == ["Enemy", "Enemy", "Cube"]
+            assert trace.read(first)["tick"] == [6, 12]
+            assert trace.read(second)["location_x"] == [2.0, 2.0]
+            # A unique label selects its actor; a shared one is ambiguous
+            assert trace.read("Cube")["count"] == 1
+            with pytest.raises(TraceFileError, match="several actors"):
+                trace.read("Enemy")
+
+        result = read_trace(path, actor_names=["Cube"])
+        assert list(result["samples"]) == [cube]
+
+    def test_read_trace_accepts_directory(self, tmp_path):
+        _write_trace(tmp_path / TRACE_FILE_NAME, {"Cube": 2, "Sphere": 2})
+        result = read_trace(tmp_path, actor_names=["Sphere"], columns=["location_y"])
+        assert list(result["samples"]) == ["Sphere"]
+        assert result["samples"]["Sphere"]["location_y"] == [1.0, 1.0]
+        assert len(result["actors"]) == 2
+
+
+class TestTraceFileErrors:
+    """Invalid files and queries."""
+
+    def test_missing_file(self, tmp_path):
+        with pytest.raises(TraceFileError):
+            TraceFile(tmp_path / "missing.uetrace")
+
+    def test_empty_file(self, tmp_path):
+        path = tmp_path / "empty.uetrace"
+        path.write_bytes(b"")
+        with pytest.raises(TraceFileError):
+            TraceFile(path)
+
+    def test_bad_magic(self, tmp_path):
+        path = tmp_path / "bad.uetrace"
+        path.write_bytes(struct.pack("<8sIIQQ", b"NOTTRACE", 1, 0, 32, 0))
+        with pytest.raises(TraceFileError, match="bad magic"):
+            TraceFile(path)
+
+    def test_unknown_actor_and_column(self, tmp_path):
+        path = _write_trace(tmp_path / TRACE_FILE_NAME, {"Cube": 1})
+        with TraceFile(path) as trace:
+            with pytest.raises(TraceFileError):
+                trace.read("Nope")
+            with pytest.raises(TraceFileError):
+                trace.read("Cube", columns=["nope"])
+
+    def test_corrupt_index_json(self, tmp_path):
+        path = _write_trace(tmp_path / TRACE_FILE_NAME, {"Cube": 2})
+        _rewrite_index(path, b'{"columns": [')
+        with pytest.raises(TraceFileError, match="corrupt"):
+            TraceFile(path)
+
+        _rewrite_index(path, b"\xff\xfe")
+        with pytest.raises(TraceFileError, match="corrupt"):
+            read_trace(path)
+
+    def test_index_missing_fields(self, tmp_path):
+        path = _write_trace(tmp_path / TRACE_FILE_NAME, {"Cube": 2})
+        index = _load_index(path)
+        del index["actors"][0]["offsets"]
+        _rewrite_index(path, json.dumps(index).encode())
+        with pytest.raises(TraceFileError, match="offsets"):
+            TraceFile(path)
+
+        _rewrite_index(path, json.dumps({"columns": []}).encode())
+        with pytest.raises(TraceFileError):
+            TraceFile(path)
+
+    def test_column_past_end_of_file(self, tmp_path):
+        path = _write_trace(tmp_path / TRACE_FILE_NAME, {"Cube": 2})
+        index = _load_index(path)
+        index["actors"][0]["count"] = 1_000_000
+        _rewrite_index(path, json.dumps(index).encode())
+        with pytest.raises(TraceFileError, match="truncated"):
+            read_trace(path)